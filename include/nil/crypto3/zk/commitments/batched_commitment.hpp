@@ -30,6 +30,8 @@
 #include <vector>
 #include <utility>
 #include <map>
+#include <memory>
+#include <type_traits>
 
 #include <boost/property_tree/ptree.hpp>
 #include <boost/property_tree/json_parser.hpp>
@@ -40,6 +42,7 @@
 #include <nil/crypto3/zk/transcript/fiat_shamir.hpp>
 #include <nil/crypto3/zk/commitments/type_traits.hpp>
 #include <nil/crypto3/zk/commitments/detail/polynomial/eval_storage.hpp>
+#include <nil/crypto3/zk/commitments/detail/polynomial/barycentric_evaluator.hpp>
 
 #include <nil/actor/core/thread_pool.hpp>
 #include <nil/actor/core/parallelization_utils.hpp>
@@ -189,14 +192,67 @@ namespace nil {
                             for (std::size_t i = 0; i < poly.size(); ++i) {
                                 _z.set_poly_points_number(k, i, point[i].size());
                             }
+                        }
+
+                        if constexpr (std::is_same<poly_type, math::polynomial_dfs<typename field_type::value_type>>::value) {
+                            eval_polys_dfs();
+                        } else {
+                            for(auto it = _polys.begin(); it != _polys.end(); ++it) {
+                                std::size_t k = it->first;
+                                const auto& poly = it->second;
+                                auto const &point = _points.at(k);
+
+                                // We use HIGH level thread pool here, because "evaluate" may use the lower level one.
+                                parallel_for(0, poly.size(), [this, &point, k, &poly](std::size_t i) {
+                                    for (std::size_t j = 0; j < point[i].size(); j++) {
+                                        _z.set(k, i, j, poly[i].evaluate(point[i][j]));
+                                    }
+                                }, ThreadPool::PoolLevel::HIGH);
+                            }
+                        }
+                    }
+
+                    // Evaluates all polynomials of all batches. Most columns share a handful of points, so the
+                    // barycentric weights are computed once per distinct (point, domain size) and every
+                    // evaluation becomes a dot product with them.
+                    void eval_polys_dfs() {
+                        using weights_type = detail::barycentric_weights<field_type>;
+
+                        struct evaluation {
+                            std::size_t batch;
+                            std::size_t poly;
+                            std::size_t point;
+                            std::size_t weights;
+                        };
 
-                            // We use HIGH level thread pool here, because "evaluate" may use the lower level one.
-                            parallel_for(0, poly.size(), [this, &point, k, &poly](std::size_t i) {
+                        std::vector<std::pair<typename field_type::value_type, std::size_t>> weight_keys;
+                        std::vector<evaluation> evaluations;
+
+                        for (auto const &[k, poly] : _polys) {
+                            auto const &point = _points.at(k);
+                            for (std::size_t i = 0; i < poly.size(); ++i) {
                                 for (std::size_t j = 0; j < point[i].size(); j++) {
-                                    _z.set(k, i, j, poly[i].evaluate(point[i][j]));
+                                    auto key = std::make_pair(point[i][j], poly[i].size());
+                                    std::size_t weights_index =
+                                        std::find(weight_keys.begin(), weight_keys.end(), key) - weight_keys.begin();
+                                    if (weights_index == weight_keys.size()) {
+                                        weight_keys.push_back(key);
+                                    }
+                                    evaluations.push_back({k, i, j, weights_index});
                                 }
-                            }, ThreadPool::PoolLevel::HIGH); 
+                            }
                         }
+
+                        std::vector<std::unique_ptr<weights_type>> weights(weight_keys.size());
+                        parallel_for(0, weight_keys.size(), [&weights, &weight_keys](std::size_t i) {
+                            weights[i] = std::make_unique<weights_type>(weight_keys[i].first, weight_keys[i].second);
+                        }, ThreadPool::PoolLevel::HIGH);
+
+                        parallel_for(0, evaluations.size(), [this, &evaluations, &weights](std::size_t e) {
+                            const evaluation &eval = evaluations[e];
+                            _z.set(eval.batch, eval.poly, eval.point,
+                                   weights[eval.weights]->evaluate(_polys.at(eval.batch)[eval.poly]));
+                        }, ThreadPool::PoolLevel::HIGH);
                     }
 
                 public:
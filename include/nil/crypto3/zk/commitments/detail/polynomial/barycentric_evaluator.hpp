@@ -0,0 +1,135 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+//---------------------------------------------------------------------------//
+// @file Declaration of batched barycentric evaluation of polynomials given by
+// their values on a multiplicative subgroup.
+//
+// For the subgroup H = {w^0, ..., w^{n-1}} and a point x outside of H,
+//     p(x) = (x^n - 1) / n * sum_i p(w^i) * w^i / (x - w^i).
+// The weights (x^n - 1) / n * w^i / (x - w^i) depend on x and n only, so they are
+// computed once per point and shared by every polynomial evaluated there.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ZK_COMMITMENTS_BARYCENTRIC_EVALUATOR_HPP
+#define CRYPTO3_ZK_COMMITMENTS_BARYCENTRIC_EVALUATOR_HPP
+
+#include <vector>
+
+#include <boost/assert.hpp>
+
+#include <nil/crypto3/math/algorithms/unity_root.hpp>
+#include <nil/crypto3/math/polynomial/polynomial_dfs.hpp>
+
+#include <nil/crypto3/zk/math/polynomial_dfs_product.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace zk {
+            namespace commitments {
+                namespace detail {
+
+                    /**
+                     * Replaces every element by its inverse with a single field inversion.
+                     * All elements must be non-zero.
+                     */
+                    template<typename ValueType>
+                    void batch_inverse(std::vector<ValueType> &values) {
+                        math::batch_inverse(values.begin(), values.end());
+                    }
+
+                    /**
+                     * Barycentric weights of one evaluation point over the subgroup of a given size.
+                     */
+                    template<typename FieldType>
+                    class barycentric_weights {
+                    public:
+                        typedef typename FieldType::value_type value_type;
+                        typedef math::polynomial_dfs<value_type> polynomial_dfs_type;
+
+                        barycentric_weights(const value_type &point, std::size_t size) :
+                            _point(point), _size(size) {
+                            const value_type vanishing = point.pow(size) - value_type::one();
+                            // The formula divides by zero on the subgroup itself, see on_domain().
+                            if (vanishing.is_zero()) {
+                                return;
+                            }
+
+                            const value_type omega = math::unity_root<FieldType>(size);
+
+                            std::vector<value_type> domain_elements(size);
+                            _weights.resize(size);
+                            value_type omega_power = value_type::one();
+                            for (std::size_t i = 0; i < size; ++i) {
+                                domain_elements[i] = omega_power;
+                                _weights[i] = point - omega_power;
+                                omega_power *= omega;
+                            }
+                            batch_inverse(_weights);
+
+                            const value_type scale = vanishing * value_type(size).inversed();
+                            for (std::size_t i = 0; i < size; ++i) {
+                                _weights[i] *= domain_elements[i] * scale;
+                            }
+                        }
+
+                        const value_type &point() const {
+                            return _point;
+                        }
+
+                        std::size_t size() const {
+                            return _size;
+                        }
+
+                        // True if the point is an element of the subgroup; no weights are computed then.
+                        bool on_domain() const {
+                            return _weights.empty();
+                        }
+
+                        value_type evaluate(const polynomial_dfs_type &poly) const {
+                            BOOST_ASSERT(poly.size() == _size);
+                            if (on_domain()) {
+                                return poly.evaluate(_point);
+                            }
+
+                            value_type result = value_type::zero();
+                            auto value = poly.begin();
+                            for (std::size_t i = 0; i < _size; ++i, ++value) {
+                                result += *value * _weights[i];
+                            }
+                            return result;
+                        }
+
+                    private:
+                        value_type _point;
+                        std::size_t _size;
+                        std::vector<value_type> _weights;
+                    };
+
+                }    // namespace detail
+            }        // namespace commitments
+        }            // namespace zk
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ZK_COMMITMENTS_BARYCENTRIC_EVALUATOR_HPP
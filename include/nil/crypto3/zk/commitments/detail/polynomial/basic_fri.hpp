@@ -30,8 +30,15 @@
 #ifndef CRYPTO3_ZK_COMMITMENTS_BASIC_FRI_HPP
 #define CRYPTO3_ZK_COMMITMENTS_BASIC_FRI_HPP
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <memory>
+#include <mutex>
+#include <tuple>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 #include <map>
 #include <random>
 
@@ -51,6 +58,8 @@
 #include <nil/crypto3/zk/commitments/detail/polynomial/fold_polynomial.hpp>
 #include <nil/crypto3/zk/commitments/detail/polynomial/proof_of_work.hpp>
 #include <nil/crypto3/zk/detail/field_element_consumer.hpp>
+#include <nil/crypto3/zk/detail/mapped_storage.hpp>
+#include <nil/crypto3/zk/detail/merkle_multi_lane.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/detail/placeholder_scoped_profiler.hpp>
 
 #include <nil/actor/core/thread_pool.hpp>
@@ -298,6 +307,74 @@ namespace nil {
                             std::vector<query_proof_type>                       query_proofs;     // 0...lambda - 1
                             typename GrindingType::output_type                  proof_of_work;
                         };
+
+                        // Query of a compressed_proof_type, openings are referred to by index.
+                        struct compressed_query_proof_type {
+                            bool operator==(const compressed_query_proof_type &rhs) const {
+                                return initial_values == rhs.initial_values &&
+                                       initial_openings == rhs.initial_openings &&
+                                       round_values == rhs.round_values &&
+                                       round_openings == rhs.round_openings;
+                            }
+
+                            bool operator!=(const compressed_query_proof_type &rhs) const {
+                                return !(rhs == *this);
+                            }
+
+                            std::map<std::size_t, polynomials_values_type>      initial_values;
+                            std::map<std::size_t, std::size_t>                  initial_openings; // batch => index
+                            std::vector<polynomial_values_type>                 round_values;
+                            std::vector<std::size_t>                            round_openings;   // round => index
+                        };
+
+                        /**
+                         * Merkle openings of several leaves of one tree. The paths of different leaves meet
+                         * near the root, every sibling node is stored once: nodes holds the siblings of all
+                         * paths level by level from the leaves up, by increasing index on every level.
+                         * Siblings which are themselves on another path are stored as well, the openings are
+                         * rebuilt without the leaf values.
+                         */
+                        struct merkle_multiproof_type {
+                            bool operator==(const merkle_multiproof_type &rhs) const {
+                                return root == rhs.root && depth == rhs.depth &&
+                                       leaf_indices == rhs.leaf_indices && nodes == rhs.nodes;
+                            }
+
+                            bool operator!=(const merkle_multiproof_type &rhs) const {
+                                return !(rhs == *this);
+                            }
+
+                            commitment_type                                             root;
+                            std::size_t                                                 depth = 0;
+                            std::vector<std::size_t>                                    leaf_indices; // opening => leaf
+                            std::vector<commitment_type>                                nodes;
+                        };
+
+                        /**
+                         * proof_type with the Merkle openings of every tree stored as one multiproof. With
+                         * more queries than leaves, which is always the case for the trees of the last rounds,
+                         * many queries open the same leaf and refer to one shared opening instead.
+                         */
+                        struct compressed_proof_type {
+                            bool operator==(const compressed_proof_type &rhs) const {
+                                return fri_roots == rhs.fri_roots &&
+                                       final_polynomial == rhs.final_polynomial &&
+                                       initial_openings == rhs.initial_openings &&
+                                       round_openings == rhs.round_openings &&
+                                       query_proofs == rhs.query_proofs;
+                            }
+
+                            bool operator!=(const compressed_proof_type &rhs) const {
+                                return !(rhs == *this);
+                            }
+
+                            std::vector<commitment_type>                                fri_roots;
+                            math::polynomial<typename field_type::value_type>           final_polynomial;
+                            std::map<std::size_t, merkle_multiproof_type>               initial_openings; // batch => openings
+                            std::vector<merkle_multiproof_type>                         round_openings;   // round => openings
+                            std::vector<compressed_query_proof_type>                    query_proofs;
+                            typename GrindingType::output_type                          proof_of_work;
+                        };
                     };
                 }    // namespace detail
             }        // namespace commitments
@@ -310,6 +387,126 @@ namespace nil {
                         typename FRI::merkle_tree_hash_type::word_type,
                         typename FRI::field_element_type
                     >;
+
+                    /**
+                     * Merkle nodes of the trees of one FRI proof which were already verified against the
+                     * tree root, by tree and by (level, index), level 0 being the leaves. A path is hashed
+                     * from its leaf up to the first node already verified by another query, which is common
+                     * in the small trees of the last rounds and near the roots of all trees. Shared between
+                     * the queries verified in parallel.
+                     */
+                    template<typename FRI>
+                    class fri_merkle_opening_cache {
+                    public:
+                        typedef typename FRI::merkle_tree_hash_type hash_type;
+                        typedef typename hash_type::digest_type digest_type;
+                        // (is a round tree, batch or round index)
+                        typedef std::pair<bool, std::size_t> tree_key_type;
+                        // (level, index)
+                        typedef std::pair<std::size_t, std::size_t> node_key_type;
+
+                        fri_merkle_opening_cache() : _hashed_nodes(0), _hits(0) {
+                        }
+
+                        /**
+                         * Same as proof.validate(leaf_data) for the leaf leaf_index. The caller checks
+                         * proof.root() against the root of the tree identified by is_round and tree_index.
+                         */
+                        bool validate(bool is_round, std::size_t tree_index, std::size_t leaf_index,
+                                      const typename FRI::merkle_proof_type &proof,
+                                      const fri_field_element_consumer<FRI> &leaf_data) {
+                            const auto &path = proof.path();
+                            std::size_t index = leaf_index;
+                            for (const auto &layer : path) {
+                                if ((layer[0].position() == 0) != (index % 2 == 1)) {
+                                    // Siblings do not match the leaf index, such a path is not cached.
+                                    ++_hashed_nodes;
+                                    return proof.validate(leaf_data);
+                                }
+                                index /= 2;
+                            }
+
+                            tree_key_type tree_key(is_round, tree_index);
+                            std::vector<digest_type> nodes;
+                            nodes.reserve(path.size() + 1);
+                            nodes.emplace_back(static_cast<digest_type>(crypto3::hash<hash_type>(leaf_data)));
+                            ++_hashed_nodes;
+
+                            index = leaf_index;
+                            for (std::size_t level = 0;; level++, index /= 2) {
+                                {
+                                    std::lock_guard<std::mutex> lock(_mutex);
+                                    auto tree = _verified.find(tree_key);
+                                    if (tree != _verified.end()) {
+                                        if (tree->second.depth != path.size()) {
+                                            return false;
+                                        }
+                                        auto node = tree->second.nodes.find(node_key_type(level, index));
+                                        if (node != tree->second.nodes.end()) {
+                                            if (node->second != nodes.back()) {
+                                                return false;
+                                            }
+                                            ++_hits;
+                                            insert(tree->second, leaf_index, nodes);
+                                            return true;
+                                        }
+                                    }
+                                }
+                                if (level == path.size()) {
+                                    break;
+                                }
+
+                                const auto &sibling = path[level][0];
+                                std::array<digest_type, 2> children = sibling.position() == 0 ?
+                                    std::array<digest_type, 2>{sibling.hash(), nodes.back()} :
+                                    std::array<digest_type, 2>{nodes.back(), sibling.hash()};
+                                nodes.emplace_back(
+                                    containers::detail::generate_hash<hash_type>(children.begin(), children.end()));
+                                ++_hashed_nodes;
+                            }
+
+                            if (nodes.back() != proof.root()) {
+                                return false;
+                            }
+
+                            std::lock_guard<std::mutex> lock(_mutex);
+                            auto &tree = _verified[tree_key];
+                            if (tree.nodes.empty()) {
+                                tree.depth = path.size();
+                            }
+                            insert(tree, leaf_index, nodes);
+                            return true;
+                        }
+
+                        // Leaf and interior nodes hashed so far.
+                        std::size_t hashed_nodes() const {
+                            return _hashed_nodes.load();
+                        }
+
+                        // Paths which ended at a node verified by an earlier path.
+                        std::size_t hits() const {
+                            return _hits.load();
+                        }
+
+                    private:
+                        struct verified_tree {
+                            std::size_t depth = 0;
+                            std::map<node_key_type, digest_type> nodes;
+                        };
+
+                        // nodes[level] is the node of the path of leaf_index on level.
+                        static void insert(verified_tree &tree, std::size_t leaf_index,
+                                           const std::vector<digest_type> &nodes) {
+                            for (std::size_t level = 0; level < nodes.size(); level++) {
+                                tree.nodes.emplace(node_key_type(level, leaf_index >> level), nodes[level]);
+                            }
+                        }
+
+                        std::mutex _mutex;
+                        std::map<tree_key_type, verified_tree> _verified;
+                        std::atomic<std::size_t> _hashed_nodes;
+                        std::atomic<std::size_t> _hits;
+                    };
                 }    // namespace detail
 
                 template<typename FRI,
@@ -353,6 +550,34 @@ namespace nil {
                     return (x_index + domain_size / FRI::m) % domain_size;
                 }
 
+                namespace detail {
+                    /**
+                     * Indices of the domain elements stored in leaf x_index, by pairs, in the order
+                     * they are hashed. Every index is x_index plus a constant modulo the domain size.
+                     */
+                    template<typename FRI>
+                    std::vector<std::array<std::size_t, FRI::m>> fri_leaf_indices(
+                            std::size_t x_index, std::size_t domain_size, std::size_t coset_size) {
+                        std::vector<std::array<std::size_t, FRI::m>> s_indices(coset_size / FRI::m);
+                        s_indices[0][0] = x_index;
+                        s_indices[0][1] = get_paired_index<FRI>(x_index, domain_size);
+
+                        std::size_t base_index = domain_size / (FRI::m * FRI::m);
+                        std::size_t prev_half_size = 1;
+                        std::size_t i = 1;
+                        while (i < coset_size / FRI::m) {
+                            for (std::size_t j = 0; j < prev_half_size; j++) {
+                                s_indices[i][0] = (base_index + s_indices[j][0]) % domain_size;
+                                s_indices[i][1] = get_paired_index<FRI>(s_indices[i][0], domain_size);
+                                i++;
+                            }
+                            base_index /= FRI::m;
+                            prev_half_size <<= 1;
+                        }
+                        return s_indices;
+                    }
+                }    // namespace detail
+
                 template<typename FRI,
                     typename std::enable_if<
                         std::is_base_of<
@@ -407,8 +632,8 @@ namespace nil {
                         }
                     }
 
-                    return containers::make_merkle_tree<typename FRI::merkle_tree_hash_type, FRI::m>(y_data.begin(),
-                                                                                                     y_data.end());
+                    return zk::detail::make_merkle_tree_multi_lane<typename FRI::merkle_tree_hash_type, FRI::m>(
+                        y_data.begin(), y_data.end());
                 }
 
                 template<typename FRI,
@@ -433,6 +658,10 @@ namespace nil {
                     return precommit<FRI>(f_dfs, D, fri_step);
                 }
 
+                /**
+                 * Builds the Merkle tree of polynomials which are already evaluated over the whole of D.
+                 * Lets callers keep the extended evaluations, e.g. to reuse them in a later commitment.
+                 */
                 template<typename FRI, typename ContainerType,
                         typename std::enable_if<
                                 std::is_base_of<
@@ -445,19 +674,10 @@ namespace nil {
                 static typename std::enable_if<
                         (std::is_same<typename ContainerType::value_type, math::polynomial_dfs<typename FRI::field_type::value_type>>::value),
                         typename FRI::precommitment_type>::type
-                precommit(ContainerType poly,
-                          std::shared_ptr<math::evaluation_domain<typename FRI::field_type>> D,
-                          const std::size_t fri_step
+                precommit_extended(const ContainerType &poly,
+                                   std::shared_ptr<math::evaluation_domain<typename FRI::field_type>> D,
+                                   const std::size_t fri_step
                 ) {
-                    PROFILE_PLACEHOLDER_SCOPE("Basic FRI Precommit time");
-
-                    // Resize uses low level thread pool, so we need to use the high level one here.
-                    parallel_for(0, poly.size(), [&poly, &D](std::size_t i) {
-                        if (poly[i].size() != D->size()) {
-                            poly[i].resize(D->size(), nullptr, D);
-                        }
-                    }, ThreadPool::PoolLevel::HIGH);
-
                     std::size_t domain_size = D->size();
                     std::size_t list_size = poly.size();
                     std::size_t coset_size = 1 << fri_step;
@@ -469,34 +689,46 @@ namespace nil {
 
                     parallel_for(0, leafs_number, [&y_data, &poly, domain_size, coset_size, list_size](std::size_t x_index) {
                         auto& element_consumer = y_data[x_index].reset_cursor();
+                        std::vector<std::array<std::size_t, FRI::m>> s_indices =
+                            detail::fri_leaf_indices<FRI>(x_index, domain_size, coset_size);
                         for (std::size_t polynom_index = 0; polynom_index < list_size; polynom_index++) {
-                            std::vector<std::array<std::size_t, FRI::m>> s_indices(coset_size / FRI::m);
-                            s_indices[0][0] = x_index;
-                            s_indices[0][1] = get_paired_index<FRI>(x_index, domain_size);
-
-                            element_consumer.consume(poly[polynom_index][s_indices[0][0]]);
-                            element_consumer.consume(poly[polynom_index][s_indices[0][1]]);
-
-                            std::size_t base_index = domain_size / (FRI::m * FRI::m);
-                            std::size_t prev_half_size = 1;
-                            std::size_t i = 1;
-                            while (i < coset_size / FRI::m) {
-                                for (std::size_t j = 0; j < prev_half_size; j++) {
-                                    s_indices[i][0] = (base_index + s_indices[j][0]) % domain_size;
-                                    s_indices[i][1] = get_paired_index<FRI>(s_indices[i][0], domain_size);
-                                    element_consumer.consume(poly[polynom_index][s_indices[i][0]]);
-                                    element_consumer.consume(poly[polynom_index][s_indices[i][1]]);
-
-                                    i++;
-                                }
-                                base_index /= FRI::m;
-                                prev_half_size <<= 1;
+                            for (const auto &pair : s_indices) {
+                                element_consumer.consume(poly[polynom_index][pair[0]]);
+                                element_consumer.consume(poly[polynom_index][pair[1]]);
                             }
                         }
                     });
 
-                    return containers::make_merkle_tree<typename FRI::merkle_tree_hash_type, FRI::m>(y_data.begin(),
-                                                                                                     y_data.end());
+                    return zk::detail::make_merkle_tree_multi_lane<typename FRI::merkle_tree_hash_type, FRI::m>(
+                        y_data.begin(), y_data.end());
+                }
+
+                template<typename FRI, typename ContainerType,
+                        typename std::enable_if<
+                                std::is_base_of<
+                                        commitments::detail::basic_batched_fri<
+                                                typename FRI::field_type, typename FRI::merkle_tree_hash_type,
+                                                typename FRI::transcript_hash_type,
+                                                FRI::m, typename FRI::grinding_type>,
+                                        FRI>::value,
+                                bool>::type = true>
+                static typename std::enable_if<
+                        (std::is_same<typename ContainerType::value_type, math::polynomial_dfs<typename FRI::field_type::value_type>>::value),
+                        typename FRI::precommitment_type>::type
+                precommit(ContainerType poly,
+                          std::shared_ptr<math::evaluation_domain<typename FRI::field_type>> D,
+                          const std::size_t fri_step
+                ) {
+                    PROFILE_PLACEHOLDER_SCOPE("Basic FRI Precommit time");
+
+                    // Resize uses low level thread pool, so we need to use the high level one here.
+                    parallel_for(0, poly.size(), [&poly, &D](std::size_t i) {
+                        if (poly[i].size() != D->size()) {
+                            poly[i].resize(D->size(), nullptr, D);
+                        }
+                    }, ThreadPool::PoolLevel::HIGH);
+
+                    return precommit_extended<FRI>(poly, D, fri_step);
                 }
 
                 template<typename FRI, typename ContainerType,
@@ -527,6 +759,118 @@ namespace nil {
                     return precommit<FRI>(poly_dfs, D, fri_step);
                 }
 
+                /**
+                 * Same tree as precommit, for batches whose extended evaluations do not fit in memory.
+                 * The polynomials are extended a few at a time into a file-backed buffer, column after
+                 * column. The leaves are then assembled in row tiles, reading every column sequentially,
+                 * into a second file-backed buffer which the tree is hashed from. Only one tile is held
+                 * in memory at a time, as bounded by params.memory_budget.
+                 */
+                template<typename FRI, typename ContainerType,
+                        typename std::enable_if<
+                                std::is_base_of<
+                                        commitments::detail::basic_batched_fri<
+                                                typename FRI::field_type, typename FRI::merkle_tree_hash_type,
+                                                typename FRI::transcript_hash_type,
+                                                FRI::m, typename FRI::grinding_type>,
+                                        FRI>::value,
+                                bool>::type = true>
+                static typename std::enable_if<
+                        (std::is_same<typename ContainerType::value_type, math::polynomial_dfs<typename FRI::field_type::value_type>>::value),
+                        typename FRI::precommitment_type>::type
+                precommit_out_of_core(const ContainerType &poly,
+                                      std::shared_ptr<math::evaluation_domain<typename FRI::field_type>> D,
+                                      const std::size_t fri_step,
+                                      const zk::detail::out_of_core_commit_params &params
+                ) {
+                    PROFILE_PLACEHOLDER_SCOPE("Basic FRI out-of-core precommit time");
+
+                    typedef typename FRI::field_type::value_type value_type;
+                    typedef detail::fri_field_element_consumer<FRI> consumer_type;
+                    typedef typename consumer_type::base_class::value_type word_type;
+
+                    zk::detail::out_of_core_statistics &statistics = zk::detail::out_of_core_statistics::instance();
+                    const std::size_t domain_size = D->size();
+                    const std::size_t list_size = poly.size();
+                    const std::size_t coset_size = 1 << fri_step;
+                    const std::size_t leafs_number = domain_size / coset_size;
+                    const std::size_t leaf_words =
+                        coset_size * list_size * consumer_type::field_element_holder_size_multiplier;
+
+                    zk::detail::mapped_storage<word_type> leaves(leafs_number * leaf_words, params.directory);
+                    {
+                        zk::detail::mapped_storage<value_type> ldes(list_size * domain_size, params.directory);
+
+                        // An extended column is held once by its polynomial and once by the dirty pages of the file.
+                        const std::size_t column_bytes = 2 * domain_size * sizeof(value_type);
+                        const std::size_t columns_per_tile = params.tile_size(column_bytes, list_size);
+                        for (std::size_t first = 0; first < list_size; first += columns_per_tile) {
+                            std::size_t last = std::min(first + columns_per_tile, list_size);
+                            statistics.acquired((last - first) * column_bytes);
+                            // Resize uses low level thread pool, so we need to use the high level one here.
+                            parallel_for(first, last, [&poly, &ldes, &D, domain_size](std::size_t i) {
+                                typename ContainerType::value_type lde = poly[i];
+                                if (lde.size() != domain_size) {
+                                    lde.resize(domain_size, nullptr, D);
+                                }
+                                std::copy(lde.begin(), lde.end(), ldes.data() + i * domain_size);
+                            }, ThreadPool::PoolLevel::HIGH);
+                            ldes.evict(first * domain_size, last * domain_size);
+                            statistics.released((last - first) * column_bytes);
+                        }
+
+                        // Every index of a leaf is the leaf index plus one of these offsets, see fri_leaf_indices.
+                        std::vector<std::size_t> offsets;
+                        for (const auto &pair : detail::fri_leaf_indices<FRI>(0, domain_size, coset_size)) {
+                            offsets.push_back(pair[0]);
+                            offsets.push_back(pair[1]);
+                        }
+
+                        const std::size_t leaf_bytes =
+                            leaf_words * sizeof(word_type) + coset_size * list_size * sizeof(value_type);
+                        const std::size_t leaves_per_tile = params.tile_size(leaf_bytes, leafs_number);
+                        for (std::size_t first = 0; first < leafs_number; first += leaves_per_tile) {
+                            std::size_t last = std::min(first + leaves_per_tile, leafs_number);
+                            statistics.acquired((last - first) * leaf_bytes);
+                            parallel_for(first, last,
+                                [&ldes, &leaves, domain_size, coset_size, list_size, leaf_words](std::size_t x_index) {
+                                    consumer_type element_consumer(coset_size * list_size);
+                                    std::vector<std::array<std::size_t, FRI::m>> s_indices =
+                                        detail::fri_leaf_indices<FRI>(x_index, domain_size, coset_size);
+                                    for (std::size_t polynom_index = 0; polynom_index < list_size; polynom_index++) {
+                                        const value_type *column = ldes.data() + polynom_index * domain_size;
+                                        for (const auto &pair : s_indices) {
+                                            element_consumer.consume(column[pair[0]]);
+                                            element_consumer.consume(column[pair[1]]);
+                                        }
+                                    }
+                                    std::copy(element_consumer.begin(), element_consumer.end(),
+                                              leaves.data() + x_index * leaf_words);
+                                }, ThreadPool::PoolLevel::HIGH);
+
+                            leaves.evict(first * leaf_words, last * leaf_words);
+                            for (std::size_t polynom_index = 0; polynom_index < list_size; polynom_index++) {
+                                for (std::size_t offset : offsets) {
+                                    std::size_t begin = polynom_index * domain_size + offset + first;
+                                    std::size_t end = polynom_index * domain_size + std::min(offset + last, domain_size);
+                                    if (begin < end) {
+                                        ldes.evict(begin, end);
+                                    }
+                                }
+                            }
+                            statistics.released((last - first) * leaf_bytes);
+                        }
+                    }
+
+                    std::vector<typename zk::detail::mapped_storage<word_type>::const_range_type> leaf_ranges;
+                    leaf_ranges.reserve(leafs_number);
+                    for (std::size_t x_index = 0; x_index < leafs_number; x_index++) {
+                        leaf_ranges.push_back(leaves.range(x_index * leaf_words, (x_index + 1) * leaf_words));
+                    }
+                    return zk::detail::make_merkle_tree_multi_lane<typename FRI::merkle_tree_hash_type, FRI::m>(
+                        leaf_ranges.begin(), leaf_ranges.end());
+                }
+
                 template<typename FRI>
                 static inline typename FRI::merkle_proof_type
                 make_proof_specialized(const std::size_t x_index, const std::size_t domain_size,
@@ -545,6 +889,38 @@ namespace nil {
                     return x_index;
                 }
 
+                /**
+                 * Index k of x = omega^k in a domain of size 2^L with generator omega. The bits of k are
+                 * found one by one: with the lower i bits removed, x^{2^{L-1-i}} is -1 if bit i is set
+                 * and 1 otherwise. Takes O(L^2) squarings instead of a scan of the domain.
+                 */
+                template<typename FRI>
+                static inline std::size_t get_domain_element_index(
+                        const typename FRI::field_type::value_type &x,
+                        const std::shared_ptr<math::evaluation_domain<typename FRI::field_type>> &domain) {
+                    std::size_t log_size = 0;
+                    while ((std::size_t(1) << log_size) < domain->size()) {
+                        ++log_size;
+                    }
+
+                    typename FRI::field_type::value_type y = x;
+                    typename FRI::field_type::value_type omega_inversed = domain->get_domain_element(1).inversed();
+                    std::size_t index = 0;
+                    for (std::size_t i = 0; i < log_size; i++) {
+                        typename FRI::field_type::value_type sign = y;
+                        for (std::size_t j = 0; j + i + 1 < log_size; j++) {
+                            sign = sign.squared();
+                        }
+                        if (sign != FRI::field_type::value_type::one()) {
+                            index |= std::size_t(1) << i;
+                            y *= omega_inversed;
+                        }
+                        omega_inversed = omega_inversed.squared();
+                    }
+                    BOOST_ASSERT(domain->get_domain_element(index) == x);
+                    return index;
+                }
+
                 template<typename FRI>
                 static inline bool check_step_list(const typename FRI::params_type &fri_params) {
                     if (fri_params.step_list.empty()) {
@@ -790,12 +1166,7 @@ namespace nil {
                             std::size_t domain_size = fri_params.D[0]->size();
                             typename FRI::field_type::value_type x = challenges[query_id];
                             x = x.pow((FRI::field_type::modulus - 1)/domain_size);
-                            std::uint64_t x_index = 0;
-                            for( x_index = 0; x_index < domain_size; x_index++ ){
-                                if( fri_params.D[0]->get_domain_element(x_index) == x ){
-                                    break;
-                                }
-                            }
+                            std::uint64_t x_index = get_domain_element_index<FRI>(x, fri_params.D[0]);
                             std::size_t t = 0;
 
                             std::vector<std::array<typename FRI::field_type::value_type, FRI::m>> s;
@@ -940,6 +1311,391 @@ namespace nil {
                     return proof;
                 }
 
+                namespace detail {
+                    // Index of proof in openings, appending it if its leaf is not opened yet. indices maps the
+                    // leaf indices of one tree to their openings.
+                    template<typename MerkleProofType>
+                    std::size_t find_or_add_opening(std::vector<MerkleProofType> &openings,
+                                                    std::map<std::size_t, std::size_t> &indices,
+                                                    const MerkleProofType &proof) {
+                        auto [it, inserted] = indices.emplace(proof.leaf_index(), openings.size());
+                        if (inserted) {
+                            openings.push_back(proof);
+                        }
+                        BOOST_ASSERT(openings[it->second] == proof);
+                        return it->second;
+                    }
+
+                    // Indices of the siblings of the paths of leaf_indices on every level of a tree of the given
+                    // depth, in the order of merkle_multiproof_type::nodes.
+                    inline std::vector<std::vector<std::size_t>>
+                        merkle_multiproof_siblings(std::vector<std::size_t> indices, std::size_t depth) {
+                        std::vector<std::vector<std::size_t>> siblings(depth);
+                        for (std::size_t level = 0; level < depth; level++) {
+                            std::sort(indices.begin(), indices.end());
+                            indices.erase(std::unique(indices.begin(), indices.end()), indices.end());
+                            for (std::size_t &index : indices) {
+                                siblings[level].push_back(index ^ 1);
+                                index /= 2;
+                            }
+                            std::sort(siblings[level].begin(), siblings[level].end());
+                            siblings[level].erase(std::unique(siblings[level].begin(), siblings[level].end()),
+                                                  siblings[level].end());
+                        }
+                        return siblings;
+                    }
+
+                    // Multiproof of openings of distinct leaves of one tree.
+                    template<typename FRI>
+                    typename FRI::merkle_multiproof_type
+                        make_merkle_multiproof(const std::vector<typename FRI::merkle_proof_type> &openings) {
+                        typename FRI::merkle_multiproof_type multiproof;
+                        if (openings.empty()) {
+                            return multiproof;
+                        }
+                        multiproof.root = openings.front().root();
+                        multiproof.depth = openings.front().path().size();
+
+                        std::map<std::pair<std::size_t, std::size_t>, typename FRI::commitment_type> nodes;
+                        for (const auto &opening : openings) {
+                            BOOST_ASSERT(opening.root() == multiproof.root);
+                            BOOST_ASSERT(opening.path().size() == multiproof.depth);
+                            multiproof.leaf_indices.push_back(opening.leaf_index());
+                            for (std::size_t level = 0; level < multiproof.depth; level++) {
+                                const auto &sibling = opening.path()[level][0];
+                                std::size_t index = (opening.leaf_index() >> level) ^ 1;
+                                BOOST_ASSERT(sibling.position() == index % 2);
+                                nodes.emplace(std::make_pair(level, index), sibling.hash());
+                            }
+                        }
+
+                        auto siblings = merkle_multiproof_siblings(multiproof.leaf_indices, multiproof.depth);
+                        for (std::size_t level = 0; level < multiproof.depth; level++) {
+                            for (std::size_t index : siblings[level]) {
+                                multiproof.nodes.push_back(nodes.at(std::make_pair(level, index)));
+                            }
+                        }
+                        return multiproof;
+                    }
+
+                    // Openings stored in multiproof, by opening index.
+                    template<typename FRI>
+                    std::vector<typename FRI::merkle_proof_type>
+                        merkle_multiproof_openings(const typename FRI::merkle_multiproof_type &multiproof) {
+                        typedef typename FRI::merkle_proof_type merkle_proof_type;
+
+                        // (level, index) => node
+                        std::map<std::pair<std::size_t, std::size_t>, typename FRI::commitment_type> nodes;
+                        auto siblings = merkle_multiproof_siblings(multiproof.leaf_indices, multiproof.depth);
+                        std::size_t node = 0;
+                        for (std::size_t level = 0; level < multiproof.depth; level++) {
+                            for (std::size_t index : siblings[level]) {
+                                nodes.emplace(std::make_pair(level, index), multiproof.nodes.at(node++));
+                            }
+                        }
+
+                        std::vector<merkle_proof_type> openings;
+                        openings.reserve(multiproof.leaf_indices.size());
+                        for (std::size_t leaf_index : multiproof.leaf_indices) {
+                            typename merkle_proof_type::path_type path(multiproof.depth);
+                            for (std::size_t level = 0; level < multiproof.depth; level++) {
+                                std::size_t index = (leaf_index >> level) ^ 1;
+                                path[level][0] = typename merkle_proof_type::path_element_type(
+                                    nodes.at(std::make_pair(level, index)), index % 2);
+                            }
+                            openings.emplace_back(leaf_index, multiproof.root, path);
+                        }
+                        return openings;
+                    }
+                }    // namespace detail
+
+                /**
+                 * Stores the Merkle openings of every tree as one multiproof, see compressed_proof_type.
+                 */
+                template<typename FRI>
+                static typename FRI::compressed_proof_type compress_proof(const typename FRI::proof_type &proof) {
+                    typename FRI::compressed_proof_type result;
+                    result.fri_roots = proof.fri_roots;
+                    result.final_polynomial = proof.final_polynomial;
+                    result.proof_of_work = proof.proof_of_work;
+                    result.round_openings.resize(proof.fri_roots.size());
+                    result.query_proofs.resize(proof.query_proofs.size());
+
+                    // Distinct openings and leaf index => index of its opening, for every tree
+                    std::map<std::size_t, std::vector<typename FRI::merkle_proof_type>> initial_openings;
+                    std::vector<std::vector<typename FRI::merkle_proof_type>> round_openings(proof.fri_roots.size());
+                    std::map<std::size_t, std::map<std::size_t, std::size_t>> initial_indices;
+                    std::vector<std::map<std::size_t, std::size_t>> round_indices(proof.fri_roots.size());
+
+                    for (std::size_t query_id = 0; query_id < proof.query_proofs.size(); query_id++) {
+                        const typename FRI::query_proof_type &query_proof = proof.query_proofs[query_id];
+                        typename FRI::compressed_query_proof_type &compressed = result.query_proofs[query_id];
+
+                        for (const auto &[k, initial_proof] : query_proof.initial_proof) {
+                            compressed.initial_values[k] = initial_proof.values;
+                            compressed.initial_openings[k] = detail::find_or_add_opening(
+                                initial_openings[k], initial_indices[k], initial_proof.p);
+                        }
+
+                        BOOST_ASSERT(query_proof.round_proofs.size() == result.round_openings.size());
+                        compressed.round_values.resize(query_proof.round_proofs.size());
+                        compressed.round_openings.resize(query_proof.round_proofs.size());
+                        for (std::size_t i = 0; i < query_proof.round_proofs.size(); i++) {
+                            compressed.round_values[i] = query_proof.round_proofs[i].y;
+                            compressed.round_openings[i] = detail::find_or_add_opening(
+                                round_openings[i], round_indices[i], query_proof.round_proofs[i].p);
+                        }
+                    }
+
+                    for (const auto &[k, openings] : initial_openings) {
+                        result.initial_openings[k] = detail::make_merkle_multiproof<FRI>(openings);
+                    }
+                    for (std::size_t i = 0; i < round_openings.size(); i++) {
+                        result.round_openings[i] = detail::make_merkle_multiproof<FRI>(round_openings[i]);
+                    }
+                    return result;
+                }
+
+                template<typename FRI>
+                static typename FRI::proof_type decompress_proof(const typename FRI::compressed_proof_type &proof) {
+                    typename FRI::proof_type result;
+                    result.fri_roots = proof.fri_roots;
+                    result.final_polynomial = proof.final_polynomial;
+                    result.proof_of_work = proof.proof_of_work;
+                    result.query_proofs.resize(proof.query_proofs.size());
+
+                    std::map<std::size_t, std::vector<typename FRI::merkle_proof_type>> initial_openings;
+                    for (const auto &[k, multiproof] : proof.initial_openings) {
+                        initial_openings[k] = detail::merkle_multiproof_openings<FRI>(multiproof);
+                    }
+                    std::vector<std::vector<typename FRI::merkle_proof_type>> round_openings;
+                    for (const auto &multiproof : proof.round_openings) {
+                        round_openings.push_back(detail::merkle_multiproof_openings<FRI>(multiproof));
+                    }
+
+                    for (std::size_t query_id = 0; query_id < proof.query_proofs.size(); query_id++) {
+                        const typename FRI::compressed_query_proof_type &compressed = proof.query_proofs[query_id];
+                        typename FRI::query_proof_type &query_proof = result.query_proofs[query_id];
+
+                        for (const auto &[k, values] : compressed.initial_values) {
+                            query_proof.initial_proof[k].values = values;
+                            query_proof.initial_proof[k].p =
+                                initial_openings.at(k).at(compressed.initial_openings.at(k));
+                        }
+
+                        query_proof.round_proofs.resize(compressed.round_values.size());
+                        for (std::size_t i = 0; i < compressed.round_values.size(); i++) {
+                            query_proof.round_proofs[i].y = compressed.round_values[i];
+                            query_proof.round_proofs[i].p = round_openings.at(i).at(compressed.round_openings.at(i));
+                        }
+                    }
+                    return result;
+                }
+
+                /**
+                 * Checks the openings of one query. Merkle paths are hashed up to the first node already
+                 * verified for another query of the same proof, see fri_merkle_opening_cache.
+                 */
+                template<typename FRI>
+                static bool verify_query(
+                    const typename FRI::proof_type                                                      &proof,
+                    const typename FRI::query_proof_type                                                &query_proof,
+                    const typename FRI::params_type                                                     &fri_params,
+                    const std::map<std::size_t, typename FRI::commitment_type>                          &commitments,
+                    const typename FRI::field_type::value_type                                          theta,
+                    const std::vector<std::vector<std::tuple<std::size_t, std::size_t>>>                &poly_ids,
+                    const std::vector<typename FRI::field_type::value_type>                             &combined_U,
+                    const std::vector<math::polynomial<typename FRI::field_type::value_type>>           &denominators,
+                    const std::vector<typename FRI::field_type::value_type>                             &alphas,
+                    const typename FRI::field_type::value_type                                          &x_challenge,
+                    detail::fri_merkle_opening_cache<FRI>                                               &merkle_cache
+                ) {
+                    std::size_t domain_size = fri_params.D[0]->size();
+                    std::size_t coset_size = 1 << fri_params.step_list[0];
+                    typename FRI::field_type::value_type x = x_challenge.pow((FRI::field_type::modulus - 1)/domain_size);
+                    std::uint64_t x_index = get_domain_element_index<FRI>(x, fri_params.D[0]);
+
+                    std::vector<std::array<typename FRI::field_type::value_type, FRI::m>> s;
+                    std::vector<std::array<std::size_t, FRI::m>> s_indices;
+                    std::tie(s, s_indices) = calculate_s<FRI>(x, x_index, fri_params.step_list[0], fri_params.D[0]);
+                    auto correct_order_idx = get_correct_order<FRI>(x_index, domain_size, fri_params.step_list[0],
+                                                                    s_indices);
+
+                    // Check initial proof.
+                    for( auto const &it: query_proof.initial_proof ){
+                        auto k = it.first;
+                        if (query_proof.initial_proof.at(k).p.root() != commitments.at(k) ) {
+                            return false;
+                        }
+
+                        detail::fri_field_element_consumer<FRI> leaf_data(coset_size * query_proof.initial_proof.at(k).values.size());
+
+                        for (std::size_t i = 0; i < query_proof.initial_proof.at(k).values.size(); i++) {
+                            for (auto [idx, pair_idx] : correct_order_idx) {
+                                leaf_data.consume(query_proof.initial_proof.at(k).values[i][idx][0]);
+                                leaf_data.consume(query_proof.initial_proof.at(k).values[i][idx][1]);
+                            }
+                        }
+                        std::size_t leaf_index = get_folded_index<FRI>(x_index, domain_size, fri_params.step_list[0]);
+                        if (!merkle_cache.validate(
+                                false, k, std::min(leaf_index, get_paired_index<FRI>(leaf_index, domain_size)),
+                                query_proof.initial_proof.at(k).p, leaf_data)) {
+                            std::cout << "Wrong initial proof" << std::endl;
+                            return false;
+                        }
+                    }
+
+                    //Calculate combinedQ values
+                    typename FRI::field_type::value_type theta_acc = FRI::field_type::value_type::one();
+                    typename FRI::polynomial_values_type y;
+                    typename FRI::polynomial_values_type combined_eval_values;
+                    y.resize(coset_size / FRI::m);
+                    combined_eval_values.resize(coset_size / FRI::m);
+                    for (size_t j = 0; j < coset_size / FRI::m; j++) {
+                        y[j][0] = FRI::field_type::value_type::zero();
+                        y[j][1] = FRI::field_type::value_type::zero();
+                    }
+                    for( std::size_t p = 0; p < poly_ids.size(); p++){
+                        typename FRI::polynomial_values_type Q;
+                        Q.resize(coset_size / FRI::m);
+                        for( auto const &poly_id: poly_ids[p] ){
+                            for (size_t j = 0; j < coset_size / FRI::m; j++) {
+                                Q[j][0] += query_proof.initial_proof.at(std::get<0>(poly_id)).values[std::get<1>(poly_id)][j][0] * theta_acc;
+                                Q[j][1] += query_proof.initial_proof.at(std::get<0>(poly_id)).values[std::get<1>(poly_id)][j][1] * theta_acc;
+                            }
+                            theta_acc *= theta;
+                        }
+                        for (size_t j = 0; j < coset_size / FRI::m; j++) {
+                            std::size_t id0 = s_indices[j][0] < s_indices[j][1] ? 0 : 1;
+                            std::size_t id1 = s_indices[j][0] < s_indices[j][1] ? 1 : 0;
+                            Q[j][0] -= combined_U[p];
+                            Q[j][1] -= combined_U[p];
+                            Q[j][0] *= denominators[p].evaluate(s[j][id0]).inversed();
+                            Q[j][1] *= denominators[p].evaluate(s[j][id1]).inversed();
+                            y[j][0] += Q[j][0];
+                            y[j][1] += Q[j][1];
+                        }
+                    }
+                    // Check round proofs
+                    std::size_t t = 0;
+                    typename FRI::polynomial_values_type y_next;
+                    for (std::size_t i = 0; i < fri_params.step_list.size(); i++) {
+                        coset_size = 1 << fri_params.step_list[i];
+                        if (query_proof.round_proofs[i].p.root() != proof.fri_roots[i]) return false;
+
+                        std::tie(s, s_indices) = calculate_s<FRI>(x, x_index, fri_params.step_list[i],
+                                                                  fri_params.D[t]);
+                        detail::fri_field_element_consumer<FRI> leaf_data(coset_size);
+                        auto correct_order_idx =
+                                get_correct_order<FRI>(x_index, domain_size, fri_params.step_list[i], s_indices);
+                        for (auto [idx, pair_idx]: correct_order_idx) {
+                            leaf_data.consume(y[idx][0]);
+                            leaf_data.consume(y[idx][1]);
+                        }
+                        std::size_t leaf_index = get_folded_index<FRI>(x_index, domain_size, fri_params.step_list[i]);
+                        if (!merkle_cache.validate(
+                                true, i, std::min(leaf_index, get_paired_index<FRI>(leaf_index, domain_size)),
+                                query_proof.round_proofs[i].p, leaf_data)) {
+                            std::cout << "Wrong round merkle proof on " << i << "-th round" << std::endl;
+                            return false;
+                        }
+
+                        // colinear check
+                        for (std::size_t step_i = 0; step_i < fri_params.step_list[i] - 1; step_i++, t++) {
+                            y_next.resize(y.size() / FRI::m);
+
+                            domain_size = fri_params.D[t]->size();
+                            x_index %= domain_size;
+                            x = fri_params.D[t]->get_domain_element(x_index);
+                            auto [s_next, s_indices_next] = calculate_s<FRI>(
+                                x *x , x_index% fri_params.D[t+1]->size(),
+                                fri_params.step_list[i], fri_params.D[t+1]
+                            );
+                            std::tie(s, s_indices) = calculate_s<FRI>(x, x_index, fri_params.step_list[i],
+                                                                      fri_params.D[t]);
+                            std::size_t new_domain_size = domain_size;
+                            for (std::size_t y_ind = 0; y_ind < y_next.size(); y_ind++) {
+                                std::size_t ind0 = s_indices[2 * y_ind][0] < s_indices[2 * y_ind][1] ? 0 : 1;
+                                auto s_ch = s[2*y_ind][ind0];
+
+                                std::vector<std::pair<typename FRI::field_type::value_type, typename FRI::field_type::value_type>> interpolation_points_l{
+                                    std::make_pair(s_ch, y[2 * y_ind][0]),
+                                    std::make_pair(-s_ch, y[2 * y_ind][1]),
+                                };
+                                math::polynomial<typename FRI::field_type::value_type> interpolant_l =
+                                        math::lagrange_interpolation(interpolation_points_l);
+
+                                ind0 = s_indices[2 * y_ind + 1][0] < s_indices[2 * y_ind + 1][1] ? 0 : 1;
+                                s_ch = s[2*y_ind + 1][ind0];
+                                std::vector<std::pair<typename FRI::field_type::value_type, typename FRI::field_type::value_type>> interpolation_points_r{
+                                    std::make_pair(s_ch, y[2 * y_ind + 1][0]),
+                                    std::make_pair(-s_ch, y[2 * y_ind + 1][1]),
+                                };
+                                math::polynomial<typename FRI::field_type::value_type> interpolant_r =
+                                        math::lagrange_interpolation(interpolation_points_r);
+
+                                new_domain_size /= FRI::m;
+
+                                std::size_t interpolant_index_l = s_indices_next[y_ind][0];
+                                std::size_t interpolant_index_r = s_indices_next[y_ind][1];
+
+                                if( interpolant_index_l < interpolant_index_r){
+                                    y_next[y_ind][0] = interpolant_l.evaluate(alphas[t]);
+                                    y_next[y_ind][1] = interpolant_r.evaluate(alphas[t]);
+                                } else {
+                                    y_next[y_ind][0] = interpolant_r.evaluate(alphas[t]);
+                                    y_next[y_ind][1] = interpolant_l.evaluate(alphas[t]);
+                                }
+                            }
+                            x = x * x;
+                            y = y_next;
+                        }
+                        domain_size = fri_params.D[t]->size();
+                        x_index %= domain_size;
+                        x = fri_params.D[t]->get_domain_element(x_index);
+                        std::tie(s, s_indices) = calculate_s<FRI>(x, x_index, fri_params.step_list[i],
+                                                                  fri_params.D[t]);
+
+                        std::size_t ind0 = s_indices[0][0] < s_indices[0][1] ? 0 : 1;
+                        auto s_ch = s[0][ind0];
+                        std::vector<std::pair<typename FRI::field_type::value_type, typename FRI::field_type::value_type>> interpolation_points{
+                            std::make_pair(s_ch, y[0][0]),
+                            std::make_pair(-s_ch, y[0][1]),
+                        };
+                        math::polynomial<typename FRI::field_type::value_type> interpolant_poly =
+                                math::lagrange_interpolation(interpolation_points);
+                        auto interpolant = interpolant_poly.evaluate(alphas[t]);
+
+                        std::size_t ind = s_indices[0][ind0] % (fri_params.D[t]->size()/2) < fri_params.D[t]->size() / 4 ? 0 : 1;
+                        if (interpolant != query_proof.round_proofs[i].y[0][ind]) {
+                            return false;
+                        }
+
+                        // For the last round we check final polynomial nor colinear_check
+                        y = query_proof.round_proofs[i].y;
+                        if (i < fri_params.step_list.size() - 1) {
+                            t++;
+                            domain_size = fri_params.D[t]->size();
+                            x_index %= domain_size;
+                            x = fri_params.D[t]->get_domain_element(x_index);
+                        }
+                    }
+
+                    // Final polynomial check
+                    x_index %= fri_params.D[t]->size();
+                    x = fri_params.D[t]->get_domain_element(x_index);
+                    x = x * x;
+                    std::size_t ind = x_index % (fri_params.D[t]->size() / 2) < fri_params.D[t]->size() / 4 ? 0 : 1;
+                    if (y[0][ind] != proof.final_polynomial.evaluate(x)) {
+                        return false;
+                    }
+                    if (y[0][1-ind] != proof.final_polynomial.evaluate(-x)) {
+                        return false;
+                    }
+
+                    return true;
+                }
+
                 template<typename FRI>
                 static bool verify_eval(
                     const typename FRI::proof_type                                                      &proof,
@@ -975,194 +1731,47 @@ namespace nil {
                     if(fri_params.use_grinding && !FRI::grinding_type::verify(transcript, proof.proof_of_work, fri_params.grinding_parameter)){
                         return false;
                     }
-                    for (std::size_t query_id = 0; query_id < fri_params.lambda; query_id++) {
-                        const typename FRI::query_proof_type &query_proof = proof.query_proofs[query_id];
-
-                        std::size_t domain_size = fri_params.D[0]->size();
-                        std::size_t coset_size = 1 << fri_params.step_list[0];
-                        typename FRI::field_type::value_type x_challenge = transcript.template challenge<typename FRI::field_type>();
-                        typename FRI::field_type::value_type x = x_challenge.pow((FRI::field_type::modulus - 1)/domain_size);
-                        std::uint64_t x_index = 0;
-                        for( x_index = 0; x_index < domain_size; x_index++ ){
-                            if( fri_params.D[0]->get_domain_element(x_index) == x ){
-                                break;
-                            }
-                        }
-
-                        std::vector<std::array<typename FRI::field_type::value_type, FRI::m>> s;
-                        std::vector<std::array<std::size_t, FRI::m>> s_indices;
-                        std::tie(s, s_indices) = calculate_s<FRI>(x, x_index, fri_params.step_list[0], fri_params.D[0]);
-                        auto correct_order_idx = get_correct_order<FRI>(x_index, domain_size, fri_params.step_list[0],
-                                                                        s_indices);
-
-                        // Check initial proof.
-                        for( auto const &it: query_proof.initial_proof ){
-                            auto k = it.first;
-                            if (query_proof.initial_proof.at(k).p.root() != commitments.at(k) ) {
-                                return false;
-                            }
-
-                            detail::fri_field_element_consumer<FRI> leaf_data(coset_size * query_proof.initial_proof.at(k).values.size());
-
-                            for (std::size_t i = 0; i < query_proof.initial_proof.at(k).values.size(); i++) {
-                                for (auto [idx, pair_idx] : correct_order_idx) {
-                                    leaf_data.consume(query_proof.initial_proof.at(k).values[i][idx][0]);
-                                    leaf_data.consume(query_proof.initial_proof.at(k).values[i][idx][1]);
-                                }
-                            }
-                            if (!query_proof.initial_proof.at(k).p.validate(leaf_data)) {
-                                std::cout << "Wrong initial proof" << std::endl;
-                                return false;
-                            }
-                        }
-
-                        //Calculate combinedQ values
-                        typename FRI::field_type::value_type theta_acc = FRI::field_type::value_type::one();
-                        typename FRI::polynomial_values_type y;
-                        typename FRI::polynomial_values_type combined_eval_values;
-                        y.resize(coset_size / FRI::m);
-                        combined_eval_values.resize(coset_size / FRI::m);
-                        for (size_t j = 0; j < coset_size / FRI::m; j++) {
-                            y[j][0] = FRI::field_type::value_type::zero();
-                            y[j][1] = FRI::field_type::value_type::zero();
-                        }
-                        for( std::size_t p = 0; p < poly_ids.size(); p++){
-                            typename FRI::polynomial_values_type Q;
-                            Q.resize(coset_size / FRI::m);
-                            for( auto const &poly_id: poly_ids[p] ){
-                                for (size_t j = 0; j < coset_size / FRI::m; j++) {
-                                    Q[j][0] += query_proof.initial_proof.at(std::get<0>(poly_id)).values[std::get<1>(poly_id)][j][0] * theta_acc;
-                                    Q[j][1] += query_proof.initial_proof.at(std::get<0>(poly_id)).values[std::get<1>(poly_id)][j][1] * theta_acc;
-                                }
-                                theta_acc *= theta;
-                            }
-                            for (size_t j = 0; j < coset_size / FRI::m; j++) {
-                                std::size_t id0 = s_indices[j][0] < s_indices[j][1] ? 0 : 1;
-                                std::size_t id1 = s_indices[j][0] < s_indices[j][1] ? 1 : 0;
-                                Q[j][0] -= combined_U[p];
-                                Q[j][1] -= combined_U[p];
-                                Q[j][0] *= denominators[p].evaluate(s[j][id0]).inversed();
-                                Q[j][1] *= denominators[p].evaluate(s[j][id1]).inversed();
-                                y[j][0] += Q[j][0];
-                                y[j][1] += Q[j][1];
-                            }
-                        }
-                        // Check round proofs
-                        std::size_t t = 0;
-                        typename FRI::polynomial_values_type y_next;
-                        for (std::size_t i = 0; i < fri_params.step_list.size(); i++) {
-                            coset_size = 1 << fri_params.step_list[i];
-                            if (query_proof.round_proofs[i].p.root() != proof.fri_roots[i]) return false;
-
-                            std::tie(s, s_indices) = calculate_s<FRI>(x, x_index, fri_params.step_list[i],
-                                                                      fri_params.D[t]);
-                            detail::fri_field_element_consumer<FRI> leaf_data(coset_size);
-                            auto correct_order_idx =
-                                    get_correct_order<FRI>(x_index, domain_size, fri_params.step_list[i], s_indices);
-                            for (auto [idx, pair_idx]: correct_order_idx) {
-                                leaf_data.consume(y[idx][0]);
-                                leaf_data.consume(y[idx][1]);
-                            }
-                            if (!query_proof.round_proofs[i].p.validate(leaf_data)) {
-                                std::cout << "Wrong round merkle proof on " << i << "-th round" << std::endl;
-                                return false;
-                            }
-
-                            // colinear check
-                            for (std::size_t step_i = 0; step_i < fri_params.step_list[i] - 1; step_i++, t++) {
-                                y_next.resize(y.size() / FRI::m);
+                    // All query challenges are drawn first, the queries are then independent.
+                    std::vector<typename FRI::field_type::value_type> challenges(fri_params.lambda);
+                    for (std::size_t query_id = 0; query_id < fri_params.lambda; ++query_id) {
+                        challenges[query_id] = transcript.template challenge<typename FRI::field_type>();
+                    }
 
-                                domain_size = fri_params.D[t]->size();
-                                x_index %= domain_size;
-                                x = fri_params.D[t]->get_domain_element(x_index);
-                                auto [s_next, s_indices_next] = calculate_s<FRI>(
-                                    x *x , x_index% fri_params.D[t+1]->size(),
-                                    fri_params.step_list[i], fri_params.D[t+1]
-                                );
-                                std::tie(s, s_indices) = calculate_s<FRI>(x, x_index, fri_params.step_list[i],
-                                                                          fri_params.D[t]);
-                                std::size_t new_domain_size = domain_size;
-                                for (std::size_t y_ind = 0; y_ind < y_next.size(); y_ind++) {
-                                    std::size_t ind0 = s_indices[2 * y_ind][0] < s_indices[2 * y_ind][1] ? 0 : 1;
-                                    auto s_ch = s[2*y_ind][ind0];
-
-                                    std::vector<std::pair<typename FRI::field_type::value_type, typename FRI::field_type::value_type>> interpolation_points_l{
-                                        std::make_pair(s_ch, y[2 * y_ind][0]),
-                                        std::make_pair(-s_ch, y[2 * y_ind][1]),
-                                    };
-                                    math::polynomial<typename FRI::field_type::value_type> interpolant_l =
-                                            math::lagrange_interpolation(interpolation_points_l);
-
-                                    ind0 = s_indices[2 * y_ind + 1][0] < s_indices[2 * y_ind + 1][1] ? 0 : 1;
-                                    s_ch = s[2*y_ind + 1][ind0];
-                                    std::vector<std::pair<typename FRI::field_type::value_type, typename FRI::field_type::value_type>> interpolation_points_r{
-                                        std::make_pair(s_ch, y[2 * y_ind + 1][0]),
-                                        std::make_pair(-s_ch, y[2 * y_ind + 1][1]),
-                                    };
-                                    math::polynomial<typename FRI::field_type::value_type> interpolant_r =
-                                            math::lagrange_interpolation(interpolation_points_r);
-
-                                    new_domain_size /= FRI::m;
-
-                                    std::size_t interpolant_index_l = s_indices_next[y_ind][0];
-                                    std::size_t interpolant_index_r = s_indices_next[y_ind][1];
-
-                                    if( interpolant_index_l < interpolant_index_r){
-                                        y_next[y_ind][0] = interpolant_l.evaluate(alphas[t]);
-                                        y_next[y_ind][1] = interpolant_r.evaluate(alphas[t]);
-                                    } else {
-                                        y_next[y_ind][0] = interpolant_r.evaluate(alphas[t]);
-                                        y_next[y_ind][1] = interpolant_l.evaluate(alphas[t]);
-                                    }
-                                }
-                                x = x * x;
-                                y = y_next;
+                    detail::fri_merkle_opening_cache<FRI> merkle_cache;
+                    std::atomic<bool> valid(true);
+                    parallel_for(0, fri_params.lambda,
+                        [&valid, &proof, &fri_params, &commitments, &theta, &poly_ids, &combined_U, &denominators,
+                         &alphas, &challenges, &merkle_cache](std::size_t query_id) {
+                            if (!valid) {
+                                return;
                             }
-                            domain_size = fri_params.D[t]->size();
-                            x_index %= domain_size;
-                            x = fri_params.D[t]->get_domain_element(x_index);
-                            std::tie(s, s_indices) = calculate_s<FRI>(x, x_index, fri_params.step_list[i],
-                                                                      fri_params.D[t]);
-
-                            std::size_t ind0 = s_indices[0][0] < s_indices[0][1] ? 0 : 1;
-                            auto s_ch = s[0][ind0];
-                            std::vector<std::pair<typename FRI::field_type::value_type, typename FRI::field_type::value_type>> interpolation_points{
-                                std::make_pair(s_ch, y[0][0]),
-                                std::make_pair(-s_ch, y[0][1]),
-                            };
-                            math::polynomial<typename FRI::field_type::value_type> interpolant_poly =
-                                    math::lagrange_interpolation(interpolation_points);
-                            auto interpolant = interpolant_poly.evaluate(alphas[t]);
-
-                            std::size_t ind = s_indices[0][ind0] % (fri_params.D[t]->size()/2) < fri_params.D[t]->size() / 4 ? 0 : 1;
-                            if (interpolant != query_proof.round_proofs[i].y[0][ind]) {
-                                return false;
+                            if (!verify_query<FRI>(proof, proof.query_proofs[query_id], fri_params, commitments, theta,
+                                                   poly_ids, combined_U, denominators, alphas, challenges[query_id],
+                                                   merkle_cache)) {
+                                valid = false;
                             }
+                        }, ThreadPool::PoolLevel::HIGH);
 
-                            // For the last round we check final polynomial nor colinear_check
-                            y = query_proof.round_proofs[i].y;
-                            if (i < fri_params.step_list.size() - 1) {
-                                t++;
-                                domain_size = fri_params.D[t]->size();
-                                x_index %= domain_size;
-                                x = fri_params.D[t]->get_domain_element(x_index);
-                            }
-                        }
-
-                        // Final polynomial check
-                        x_index %= fri_params.D[t]->size();
-                        x = fri_params.D[t]->get_domain_element(x_index);
-                        x = x * x;
-                        std::size_t ind = x_index % (fri_params.D[t]->size() / 2) < fri_params.D[t]->size() / 4 ? 0 : 1;
-                        if (y[0][ind] != proof.final_polynomial.evaluate(x)) {
-                            return false;
-                        }
-                        if (y[0][1-ind] != proof.final_polynomial.evaluate(-x)) {
-                            return false;
-                        }
-                    }
+                    return valid;
+                }
 
-                    return true;
+                /**
+                 * Verifies a proof produced by compress_proof. Paths shared by several queries are
+                 * hashed up to their first verified node, by the opening cache of verify_eval.
+                 */
+                template<typename FRI>
+                static bool verify_eval(
+                    const typename FRI::compressed_proof_type                                           &proof,
+                    const typename FRI::params_type                                                     &fri_params,
+                    const std::map<std::size_t, typename FRI::commitment_type>                          &commitments,
+                    const typename FRI::field_type::value_type                                          theta,
+                    const std::vector<std::vector<std::tuple<std::size_t, std::size_t>>>                &poly_ids,
+                    const std::vector<typename FRI::field_type::value_type>                             &combined_U,
+                    const std::vector<math::polynomial<typename FRI::field_type::value_type>>           &denominators,
+                    typename FRI::transcript_type &transcript
+                ) {
+                    return verify_eval<FRI>(decompress_proof<FRI>(proof), fri_params, commitments, theta, poly_ids,
+                                            combined_U, denominators, transcript);
                 }
             }    // namespace algorithms
         }        // namespace zk
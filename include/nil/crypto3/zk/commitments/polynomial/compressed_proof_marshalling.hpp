@@ -0,0 +1,424 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+// @file Serialization of compressed FRI and LPC proofs, see basic_fri::compressed_proof_type.
+//
+// Sizes and indices are written as 64-bit integers, query values are flattened into one list of
+// field elements per polynomial batch.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ZK_COMMITMENTS_COMPRESSED_PROOF_MARSHALLING_HPP
+#define CRYPTO3_ZK_COMMITMENTS_COMPRESSED_PROOF_MARSHALLING_HPP
+
+#include <cstdint>
+#include <tuple>
+#include <vector>
+
+#include <nil/marshalling/types/bundle.hpp>
+#include <nil/marshalling/types/array_list.hpp>
+#include <nil/marshalling/types/integral.hpp>
+#include <nil/marshalling/options.hpp>
+#include <nil/marshalling/field_type.hpp>
+
+#include <nil/crypto3/marshalling/algebra/types/field_element.hpp>
+#include <nil/crypto3/marshalling/containers/types/merkle_node.hpp>
+
+#include <nil/crypto3/math/polynomial/polynomial.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace marshalling {
+            namespace types {
+                namespace detail {
+                    template<typename TTypeBase>
+                    using compressed_size = nil::marshalling::types::integral<TTypeBase, std::uint64_t>;
+
+                    template<typename TTypeBase, typename ElementType>
+                    using compressed_list = nil::marshalling::types::array_list<
+                        TTypeBase, ElementType,
+                        nil::marshalling::option::sequence_size_field_prefix<compressed_size<TTypeBase>>>;
+
+                    template<typename TTypeBase, typename FieldValueType>
+                    using compressed_field_list =
+                        compressed_list<TTypeBase, field_element<TTypeBase, FieldValueType>>;
+                }    // namespace detail
+
+                // Values of one polynomial at the points of a query, FRI::m values per point.
+                template<typename TTypeBase, typename FRI>
+                struct compressed_fri_values {
+                    using type = detail::compressed_field_list<TTypeBase, typename FRI::field_type::value_type>;
+                };
+
+                // Values of a batch of polynomials at the points of a query, preceded by the number of polynomials.
+                template<typename TTypeBase, typename FRI>
+                struct compressed_fri_batch_values {
+                    using type = nil::marshalling::types::bundle<
+                        TTypeBase,
+                        std::tuple<detail::compressed_size<TTypeBase>,
+                                   typename compressed_fri_values<TTypeBase, FRI>::type>>;
+                };
+
+                template<typename TTypeBase, typename FRI>
+                struct compressed_fri_query_proof {
+                    using type = nil::marshalling::types::bundle<
+                        TTypeBase,
+                        std::tuple<
+                            // batch, index of its opening, values
+                            detail::compressed_list<
+                                TTypeBase,
+                                nil::marshalling::types::bundle<
+                                    TTypeBase,
+                                    std::tuple<detail::compressed_size<TTypeBase>,
+                                               detail::compressed_size<TTypeBase>,
+                                               typename compressed_fri_batch_values<TTypeBase, FRI>::type>>>,
+                            // round values
+                            detail::compressed_list<TTypeBase, typename compressed_fri_values<TTypeBase, FRI>::type>,
+                            // round opening indices
+                            detail::compressed_list<TTypeBase, detail::compressed_size<TTypeBase>>>>;
+                };
+
+                // Openings of one tree, see basic_fri::merkle_multiproof_type.
+                template<typename TTypeBase, typename FRI>
+                struct compressed_fri_merkle_multiproof {
+                    using node_type = typename merkle_node_value<TTypeBase, typename FRI::merkle_proof_type>::type;
+
+                    using type = nil::marshalling::types::bundle<
+                        TTypeBase,
+                        std::tuple<
+                            // root
+                            node_type,
+                            // depth
+                            detail::compressed_size<TTypeBase>,
+                            // leaf_indices
+                            detail::compressed_list<TTypeBase, detail::compressed_size<TTypeBase>>,
+                            // nodes
+                            detail::compressed_list<TTypeBase, node_type>>>;
+                };
+
+                template<typename TTypeBase, typename FRI>
+                struct compressed_fri_proof {
+                    using merkle_multiproof_marshalling_type =
+                        typename compressed_fri_merkle_multiproof<TTypeBase, FRI>::type;
+
+                    using type = nil::marshalling::types::bundle<
+                        TTypeBase,
+                        std::tuple<
+                            // fri_roots
+                            detail::compressed_list<
+                                TTypeBase, typename merkle_node_value<TTypeBase, typename FRI::merkle_proof_type>::type>,
+                            // final_polynomial
+                            detail::compressed_field_list<TTypeBase, typename FRI::field_type::value_type>,
+                            // batch, its openings
+                            detail::compressed_list<
+                                TTypeBase,
+                                nil::marshalling::types::bundle<
+                                    TTypeBase,
+                                    std::tuple<detail::compressed_size<TTypeBase>, merkle_multiproof_marshalling_type>>>,
+                            // openings of every round
+                            detail::compressed_list<TTypeBase, merkle_multiproof_marshalling_type>,
+                            // query_proofs
+                            detail::compressed_list<TTypeBase,
+                                                    typename compressed_fri_query_proof<TTypeBase, FRI>::type>,
+                            // proof_of_work
+                            nil::marshalling::types::integral<TTypeBase,
+                                                              typename FRI::grinding_type::output_type>>>;
+                };
+
+                template<typename TTypeBase, typename LPC>
+                struct compressed_lpc_proof {
+                    using type = nil::marshalling::types::bundle<
+                        TTypeBase,
+                        std::tuple<
+                            // z: batch, values of every polynomial at its points
+                            detail::compressed_list<
+                                TTypeBase,
+                                nil::marshalling::types::bundle<
+                                    TTypeBase,
+                                    std::tuple<detail::compressed_size<TTypeBase>,
+                                               detail::compressed_list<
+                                                   TTypeBase,
+                                                   detail::compressed_field_list<
+                                                       TTypeBase, typename LPC::field_type::value_type>>>>>,
+                            // fri_proof
+                            typename compressed_fri_proof<TTypeBase, typename LPC::fri_type>::type>>;
+                };
+
+                template<typename Endianness, typename FRI>
+                typename compressed_fri_values<nil::marshalling::field_type<Endianness>, FRI>::type
+                    fill_compressed_fri_values(const typename FRI::polynomial_values_type &values) {
+                    using TTypeBase = nil::marshalling::field_type<Endianness>;
+                    using field_element_type = field_element<TTypeBase, typename FRI::field_type::value_type>;
+
+                    typename compressed_fri_values<TTypeBase, FRI>::type filled;
+                    filled.value().reserve(values.size() * FRI::m);
+                    for (const auto &point_values : values) {
+                        for (const auto &value : point_values) {
+                            filled.value().push_back(field_element_type(value));
+                        }
+                    }
+                    return filled;
+                }
+
+                template<typename Endianness, typename FRI>
+                typename FRI::polynomial_values_type make_compressed_fri_values(
+                    const typename compressed_fri_values<nil::marshalling::field_type<Endianness>, FRI>::type &filled) {
+                    const auto &elements = filled.value();
+                    typename FRI::polynomial_values_type values(elements.size() / FRI::m);
+                    for (std::size_t i = 0; i < values.size(); i++) {
+                        for (std::size_t j = 0; j < FRI::m; j++) {
+                            values[i][j] = elements[i * FRI::m + j].value();
+                        }
+                    }
+                    return values;
+                }
+
+                template<typename Endianness, typename FRI>
+                typename compressed_fri_batch_values<nil::marshalling::field_type<Endianness>, FRI>::type
+                    fill_compressed_fri_batch_values(const typename FRI::polynomials_values_type &values) {
+                    using TTypeBase = nil::marshalling::field_type<Endianness>;
+                    using field_element_type = field_element<TTypeBase, typename FRI::field_type::value_type>;
+
+                    typename compressed_fri_values<TTypeBase, FRI>::type filled_values;
+                    for (const auto &polynomial_values : values) {
+                        for (const auto &point_values : polynomial_values) {
+                            for (const auto &value : point_values) {
+                                filled_values.value().push_back(field_element_type(value));
+                            }
+                        }
+                    }
+                    return typename compressed_fri_batch_values<TTypeBase, FRI>::type(
+                        std::make_tuple(detail::compressed_size<TTypeBase>(values.size()), filled_values));
+                }
+
+                template<typename Endianness, typename FRI>
+                typename FRI::polynomials_values_type make_compressed_fri_batch_values(
+                    const typename compressed_fri_batch_values<nil::marshalling::field_type<Endianness>, FRI>::type
+                        &filled) {
+                    std::size_t polynomials = std::get<0>(filled.value()).value();
+                    const auto &elements = std::get<1>(filled.value()).value();
+                    std::size_t points = polynomials == 0 ? 0 : elements.size() / (polynomials * FRI::m);
+
+                    typename FRI::polynomials_values_type values(polynomials,
+                                                                 typename FRI::polynomial_values_type(points));
+                    std::size_t e = 0;
+                    for (auto &polynomial_values : values) {
+                        for (auto &point_values : polynomial_values) {
+                            for (auto &value : point_values) {
+                                value = elements[e++].value();
+                            }
+                        }
+                    }
+                    return values;
+                }
+
+                template<typename Endianness, typename FRI>
+                typename compressed_fri_merkle_multiproof<nil::marshalling::field_type<Endianness>, FRI>::type
+                    fill_compressed_fri_merkle_multiproof(const typename FRI::merkle_multiproof_type &multiproof) {
+                    using TTypeBase = nil::marshalling::field_type<Endianness>;
+
+                    typename compressed_fri_merkle_multiproof<TTypeBase, FRI>::type filled;
+                    std::get<0>(filled.value()) =
+                        fill_merkle_node_value<typename FRI::commitment_type, Endianness>(multiproof.root);
+                    std::get<1>(filled.value()).value() = multiproof.depth;
+                    for (std::size_t leaf_index : multiproof.leaf_indices) {
+                        std::get<2>(filled.value()).value().push_back(detail::compressed_size<TTypeBase>(leaf_index));
+                    }
+                    for (const auto &node : multiproof.nodes) {
+                        std::get<3>(filled.value()).value().push_back(
+                            fill_merkle_node_value<typename FRI::commitment_type, Endianness>(node));
+                    }
+                    return filled;
+                }
+
+                template<typename Endianness, typename FRI>
+                typename FRI::merkle_multiproof_type make_compressed_fri_merkle_multiproof(
+                    const typename compressed_fri_merkle_multiproof<nil::marshalling::field_type<Endianness>,
+                                                                    FRI>::type &filled) {
+                    typename FRI::merkle_multiproof_type multiproof;
+                    multiproof.root =
+                        make_merkle_node_value<typename FRI::commitment_type, Endianness>(std::get<0>(filled.value()));
+                    multiproof.depth = std::get<1>(filled.value()).value();
+                    for (const auto &leaf_index : std::get<2>(filled.value()).value()) {
+                        multiproof.leaf_indices.push_back(leaf_index.value());
+                    }
+                    for (const auto &node : std::get<3>(filled.value()).value()) {
+                        multiproof.nodes.push_back(make_merkle_node_value<typename FRI::commitment_type, Endianness>(node));
+                    }
+                    return multiproof;
+                }
+
+                template<typename Endianness, typename FRI>
+                typename compressed_fri_query_proof<nil::marshalling::field_type<Endianness>, FRI>::type
+                    fill_compressed_fri_query_proof(const typename FRI::compressed_query_proof_type &proof) {
+                    using TTypeBase = nil::marshalling::field_type<Endianness>;
+                    using filled_type = typename compressed_fri_query_proof<TTypeBase, FRI>::type;
+
+                    filled_type filled;
+                    auto &initial = std::get<0>(filled.value()).value();
+                    for (const auto &[k, values] : proof.initial_values) {
+                        initial.emplace_back(std::make_tuple(
+                            detail::compressed_size<TTypeBase>(k),
+                            detail::compressed_size<TTypeBase>(proof.initial_openings.at(k)),
+                            fill_compressed_fri_batch_values<Endianness, FRI>(values)));
+                    }
+                    for (const auto &values : proof.round_values) {
+                        std::get<1>(filled.value()).value().push_back(
+                            fill_compressed_fri_values<Endianness, FRI>(values));
+                    }
+                    for (std::size_t index : proof.round_openings) {
+                        std::get<2>(filled.value()).value().push_back(detail::compressed_size<TTypeBase>(index));
+                    }
+                    return filled;
+                }
+
+                template<typename Endianness, typename FRI>
+                typename FRI::compressed_query_proof_type make_compressed_fri_query_proof(
+                    const typename compressed_fri_query_proof<nil::marshalling::field_type<Endianness>, FRI>::type
+                        &filled) {
+                    typename FRI::compressed_query_proof_type proof;
+                    for (const auto &initial : std::get<0>(filled.value()).value()) {
+                        std::size_t k = std::get<0>(initial.value()).value();
+                        proof.initial_openings[k] = std::get<1>(initial.value()).value();
+                        proof.initial_values[k] =
+                            make_compressed_fri_batch_values<Endianness, FRI>(std::get<2>(initial.value()));
+                    }
+                    for (const auto &values : std::get<1>(filled.value()).value()) {
+                        proof.round_values.push_back(make_compressed_fri_values<Endianness, FRI>(values));
+                    }
+                    for (const auto &index : std::get<2>(filled.value()).value()) {
+                        proof.round_openings.push_back(index.value());
+                    }
+                    return proof;
+                }
+
+                template<typename Endianness, typename FRI>
+                typename compressed_fri_proof<nil::marshalling::field_type<Endianness>, FRI>::type
+                    fill_compressed_fri_proof(const typename FRI::compressed_proof_type &proof) {
+                    using TTypeBase = nil::marshalling::field_type<Endianness>;
+                    using filled_type = typename compressed_fri_proof<TTypeBase, FRI>::type;
+                    using field_element_type = field_element<TTypeBase, typename FRI::field_type::value_type>;
+
+                    filled_type filled;
+                    for (const auto &root : proof.fri_roots) {
+                        std::get<0>(filled.value()).value().push_back(
+                            fill_merkle_node_value<typename FRI::commitment_type, Endianness>(root));
+                    }
+                    for (const auto &coefficient : proof.final_polynomial) {
+                        std::get<1>(filled.value()).value().push_back(field_element_type(coefficient));
+                    }
+                    for (const auto &[k, openings] : proof.initial_openings) {
+                        std::get<2>(filled.value()).value().emplace_back(
+                            std::make_tuple(detail::compressed_size<TTypeBase>(k),
+                                            fill_compressed_fri_merkle_multiproof<Endianness, FRI>(openings)));
+                    }
+                    for (const auto &openings : proof.round_openings) {
+                        std::get<3>(filled.value()).value().push_back(
+                            fill_compressed_fri_merkle_multiproof<Endianness, FRI>(openings));
+                    }
+                    for (const auto &query_proof : proof.query_proofs) {
+                        std::get<4>(filled.value()).value().push_back(
+                            fill_compressed_fri_query_proof<Endianness, FRI>(query_proof));
+                    }
+                    std::get<5>(filled.value()).value() = proof.proof_of_work;
+                    return filled;
+                }
+
+                template<typename Endianness, typename FRI>
+                typename FRI::compressed_proof_type make_compressed_fri_proof(
+                    const typename compressed_fri_proof<nil::marshalling::field_type<Endianness>, FRI>::type &filled) {
+                    typename FRI::compressed_proof_type proof;
+                    for (const auto &root : std::get<0>(filled.value()).value()) {
+                        proof.fri_roots.push_back(
+                            make_merkle_node_value<typename FRI::commitment_type, Endianness>(root));
+                    }
+                    std::vector<typename FRI::field_type::value_type> coefficients;
+                    for (const auto &coefficient : std::get<1>(filled.value()).value()) {
+                        coefficients.push_back(coefficient.value());
+                    }
+                    proof.final_polynomial = math::polynomial<typename FRI::field_type::value_type>(coefficients);
+                    for (const auto &batch : std::get<2>(filled.value()).value()) {
+                        proof.initial_openings[std::get<0>(batch.value()).value()] =
+                            make_compressed_fri_merkle_multiproof<Endianness, FRI>(std::get<1>(batch.value()));
+                    }
+                    for (const auto &round : std::get<3>(filled.value()).value()) {
+                        proof.round_openings.push_back(make_compressed_fri_merkle_multiproof<Endianness, FRI>(round));
+                    }
+                    for (const auto &query_proof : std::get<4>(filled.value()).value()) {
+                        proof.query_proofs.push_back(make_compressed_fri_query_proof<Endianness, FRI>(query_proof));
+                    }
+                    proof.proof_of_work = std::get<5>(filled.value()).value();
+                    return proof;
+                }
+
+                template<typename Endianness, typename LPC>
+                typename compressed_lpc_proof<nil::marshalling::field_type<Endianness>, LPC>::type
+                    fill_compressed_lpc_proof(const typename LPC::compressed_proof_type &proof) {
+                    using TTypeBase = nil::marshalling::field_type<Endianness>;
+                    using value_type = typename LPC::field_type::value_type;
+                    using field_element_type = field_element<TTypeBase, value_type>;
+                    using batch_values_type =
+                        detail::compressed_list<TTypeBase, detail::compressed_field_list<TTypeBase, value_type>>;
+
+                    typename compressed_lpc_proof<TTypeBase, LPC>::type filled;
+                    for (std::size_t batch : proof.z.get_batches()) {
+                        batch_values_type filled_batch;
+                        for (const auto &poly_values : proof.z.get(batch)) {
+                            detail::compressed_field_list<TTypeBase, value_type> filled_poly;
+                            for (const auto &value : poly_values) {
+                                filled_poly.value().push_back(field_element_type(value));
+                            }
+                            filled_batch.value().push_back(filled_poly);
+                        }
+                        std::get<0>(filled.value()).value().emplace_back(
+                            std::make_tuple(detail::compressed_size<TTypeBase>(batch), filled_batch));
+                    }
+                    std::get<1>(filled.value()) =
+                        fill_compressed_fri_proof<Endianness, typename LPC::fri_type>(proof.fri_proof);
+                    return filled;
+                }
+
+                template<typename Endianness, typename LPC>
+                typename LPC::compressed_proof_type make_compressed_lpc_proof(
+                    const typename compressed_lpc_proof<nil::marshalling::field_type<Endianness>, LPC>::type &filled) {
+                    typename LPC::compressed_proof_type proof;
+                    for (const auto &batch : std::get<0>(filled.value()).value()) {
+                        std::size_t batch_id = std::get<0>(batch.value()).value();
+                        const auto &polys = std::get<1>(batch.value()).value();
+                        proof.z.set_batch_size(batch_id, polys.size());
+                        for (std::size_t i = 0; i < polys.size(); i++) {
+                            proof.z.set_poly_points_number(batch_id, i, polys[i].value().size());
+                            for (std::size_t j = 0; j < polys[i].value().size(); j++) {
+                                proof.z.set(batch_id, i, j, polys[i].value()[j].value());
+                            }
+                        }
+                    }
+                    proof.fri_proof =
+                        make_compressed_fri_proof<Endianness, typename LPC::fri_type>(std::get<1>(filled.value()));
+                    return proof;
+                }
+            }    // namespace types
+        }        // namespace marshalling
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ZK_COMMITMENTS_COMPRESSED_PROOF_MARSHALLING_HPP
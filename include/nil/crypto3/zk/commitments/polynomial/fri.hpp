@@ -85,6 +85,7 @@ namespace nil {
                     using merkle_tree_type = typename basic_fri::merkle_tree_type;
                     using merkle_proof_type = typename basic_fri::merkle_proof_type;
                     using proof_type = typename basic_fri::proof_type;
+                    using compressed_proof_type = typename basic_fri::compressed_proof_type;
                     using params_type = typename basic_fri::params_type;
                     using transcript_type = typename basic_fri::transcript_type;
 
@@ -116,8 +116,8 @@ namespace nil {
                         poly_comm(std::vector<value_type> &unshifted, value_type &shifted) :
                                 unshifted(unshifted), shifted(shifted) {}
 
-                        static poly_comm<value_type> multi_scalar_mul(std::vector<poly_comm<value_type>> &commits,
-                                                                      std::vector<typename scalar_field_type::value_type> &elm) {
+                        static poly_comm<value_type> multi_scalar_mul(const std::vector<poly_comm<value_type>> &commits,
+                                                                      const std::vector<typename scalar_field_type::value_type> &elm) {
 
                             if (commits.empty()) {
                                 return poly_comm<value_type>();
@@ -158,7 +158,7 @@ namespace nil {
                             return poly_comm<value_type>(unshifted, shifted);
                         }
 
-                        poly_comm_type chunk_commitment(typename scalar_field_type::value_type &zeta_n) {
+                        poly_comm_type chunk_commitment(const typename scalar_field_type::value_type &zeta_n) const {
                             value_type res;
                             for (auto iter = unshifted.rbegin(); iter < unshifted.rend(); ++iter) {
                                 res = res * zeta_n;
@@ -275,7 +275,7 @@ namespace nil {
                         typename group_type::value_type sg;
 
                         std::tuple<std::vector<typename scalar_field_type::value_type>, std::vector<typename scalar_field_type::value_type> >
-                        challenges(typename scalar_field_type::value_type &endo_r, sponge_type &sponge) {
+                        challenges(const typename scalar_field_type::value_type &endo_r, sponge_type &sponge) const {
                             std::vector<typename scalar_field_type::value_type> chal, chal_invs;
                             for (auto &[l, r]: lr) {
                                 sponge.absorb_g(l);
@@ -298,7 +298,7 @@ namespace nil {
                         int bound = -1;
 
                         evaluation_type(commitment_type commit,
-                                        std::vector<std::vector<typename scalar_field_type::value_type>> &evaluations,
+                                        const std::vector<std::vector<typename scalar_field_type::value_type>> &evaluations,
                                         int bound) :
                                 commit(commit), evaluations(evaluations), bound(bound) {}
                     };
@@ -642,7 +642,7 @@ namespace nil {
                         return s;
                     }
 
-                    static bool verify_eval(params_type &params, group_map_type &group_map,
+                    static bool verify_eval(const params_type &params, group_map_type &group_map,
                                             std::vector<batchproof_type> &batches) {
 
                         std::size_t power_of_two = 1;
@@ -50,10 +50,16 @@
 // The second commitment scheme enables to save some KZG verification in the
 // verifier of the Groth16 verification protocol since we pack two vectors in
 // one commitment.
+//
+// The G2 commitment key $v$ is fixed by the SRS, so its Miller-loop line
+// coefficients can be computed once (see prepare()) and reused by every
+// commitment against it. Only the G1 side is then prepared per call.
 
 #ifndef CRYPTO3_ZK_COMMITMENTS_KZG_IPP2_HPP
 #define CRYPTO3_ZK_COMMITMENTS_KZG_IPP2_HPP
 
+#include <future>
+#include <iterator>
 #include <tuple>
 #include <vector>
 #include <type_traits>
@@ -66,6 +72,9 @@
 
 #include <nil/crypto3/algebra/algorithms/pair.hpp>
 
+#include <nil/actor/core/thread_pool.hpp>
+#include <nil/actor/core/parallelization_utils.hpp>
+
 namespace nil {
     namespace crypto3 {
         namespace zk {
@@ -195,6 +204,23 @@ namespace nil {
                     typedef typename vkey_type::group_value_type g2_value_type;
                     typedef typename curve_type::gt_type::value_type gt_value_type;
 
+                    typedef typename pairing::g1_precomputed_type g1_precomputed_type;
+                    typedef typename pairing::g2_precomputed_type g2_precomputed_type;
+
+                    /// Commitment key $v$ with the Miller-loop line coefficients of every element
+                    /// precomputed. It replaces vkey_type in pair() and single() whenever the same key
+                    /// is used for many commitments, at the cost of one line table per G2 element.
+                    struct prepared_vkey_type {
+                        /// Line coefficients of $\{h^a^i\}_{i=1}^n$
+                        std::vector<g2_precomputed_type> a;
+                        /// Line coefficients of $\{h^b^i\}_{i=1}^n$
+                        std::vector<g2_precomputed_type> b;
+
+                        inline bool has_correct_len(std::size_t n) const {
+                            return a.size() == n && n == b.size();
+                        }
+                    };
+
                     /// KZGOpening represents the KZG opening of a commitment key (which is a tuple
                     /// given commitment keys are a tuple).
                     template<typename GroupType>
@@ -204,6 +230,78 @@ namespace nil {
                     using output_type =
                         std::pair<typename CurveType::gt_type::value_type, typename CurveType::gt_type::value_type>;
 
+                    /// Precomputes the Miller-loop line coefficients of both halves of the commitment key.
+                    static prepared_vkey_type prepare(const vkey_type &vkey) {
+                        BOOST_ASSERT(vkey.a.size() == vkey.b.size());
+
+                        prepared_vkey_type result;
+                        result.a.resize(vkey.a.size());
+                        result.b.resize(vkey.b.size());
+                        parallel_for(0, vkey.a.size(), [&result, &vkey](std::size_t i) {
+                            result.a[i] = algebra::precompute_g2<curve_type>(vkey.a[i]);
+                            result.b[i] = algebra::precompute_g2<curve_type>(vkey.b[i]);
+                        });
+
+                        return result;
+                    }
+
+                    /// Computes $\prod_{i=0}^n ML(P_i, Q_i)$ without the final exponentiation. $Q_i$ are
+                    /// either G2 values or prepared line coefficients. The product is split into chunks
+                    /// which are processed in parallel.
+                    template<typename InputG1Iterator, typename InputG2Iterator>
+                    static gt_value_type multi_miller_loop(InputG1Iterator g1_first, InputG1Iterator g1_last,
+                                                           InputG2Iterator g2_first) {
+                        std::vector<std::future<gt_value_type>> partial_products =
+                            parallel_run_in_chunks<gt_value_type>(
+                                std::distance(g1_first, g1_last),
+                                [&g1_first, &g2_first](std::size_t begin, std::size_t end) {
+                                    gt_value_type acc = gt_value_type::one();
+                                    for (std::size_t i = begin; i < end; ++i) {
+                                        acc = acc * miller_loop_term(*(g1_first + i), *(g2_first + i));
+                                    }
+                                    return acc;
+                                });
+
+                        gt_value_type result = gt_value_type::one();
+                        for (auto &partial_product : partial_products) {
+                            result = result * partial_product.get();
+                        }
+                        return result;
+                    }
+
+                    /// Same as pair(), with the commitment keys given by the iterators to their first
+                    /// elements. v1_first and v2_first may point either to G2 values or to prepared
+                    /// line coefficients.
+                    template<typename VKeyIterator, typename WKeyIterator, typename InputG1Iterator,
+                             typename InputG2Iterator>
+                    static output_type pair_with_keys(VKeyIterator v1_first, VKeyIterator v2_first,
+                                                      WKeyIterator w1_first, WKeyIterator w2_first,
+                                                      InputG1Iterator a_first, InputG1Iterator a_last,
+                                                      InputG2Iterator b_first) {
+                        const std::size_t n = std::distance(a_first, a_last);
+
+                        // (A * v)
+                        gt_value_type t1 = multi_miller_loop(a_first, a_last, v1_first);
+                        // (B * v)
+                        gt_value_type t2 = multi_miller_loop(w1_first, w1_first + n, b_first);
+                        gt_value_type u1 = multi_miller_loop(a_first, a_last, v2_first);
+                        gt_value_type u2 = multi_miller_loop(w2_first, w2_first + n, b_first);
+
+                        // (A * v)(w * B)
+                        return std::make_pair(algebra::final_exponentiation<curve_type>(t1 * t2),
+                                              algebra::final_exponentiation<curve_type>(u1 * u2));
+                    }
+
+                    /// Same as single(), with the commitment key given by the iterators to its first
+                    /// elements.
+                    template<typename VKeyIterator, typename InputG1Iterator>
+                    static output_type single_with_keys(VKeyIterator v1_first, VKeyIterator v2_first,
+                                                        InputG1Iterator a_first, InputG1Iterator a_last) {
+                        return std::make_pair(
+                            algebra::final_exponentiation<curve_type>(multi_miller_loop(a_first, a_last, v1_first)),
+                            algebra::final_exponentiation<curve_type>(multi_miller_loop(a_first, a_last, v2_first)));
+                    }
+
                     /// Commits to a tuple of G1 vector and G2 vector in the following way:
                     /// $T = \prod_{i=0}^n e(A_i, v_{1,i})e(B_i,w_{1,i})$
                     /// $U = \prod_{i=0}^n e(A_i, v_{2,i})e(B_i,w_{2,i})$
@@ -219,39 +317,25 @@ namespace nil {
                         BOOST_ASSERT(wkey.has_correct_len(std::distance(b_first, b_last)));
                         BOOST_ASSERT(std::distance(a_first, a_last) == std::distance(b_first, b_last));
 
-                        // (A * v)
-                        gt_value_type t1 = gt_value_type::one();
-                        std::for_each(boost::make_zip_iterator(boost::make_tuple(a_first, vkey.a.begin())),
-                                      boost::make_zip_iterator(boost::make_tuple(a_last, vkey.a.end())),
-                                      [&](const boost::tuple<const g1_value_type &, const g2_value_type &> &t) {
-                                          t1 = t1 * algebra::pair<curve_type>(t.template get<0>(), t.template get<1>());
-                                      });
+                        return pair_with_keys(vkey.a.begin(), vkey.b.begin(), wkey.a.begin(), wkey.b.begin(), a_first,
+                                              a_last, b_first);
+                    }
 
-                        // (B * v)
-                        gt_value_type t2 = gt_value_type::one();
-                        std::for_each(boost::make_zip_iterator(boost::make_tuple(wkey.a.begin(), b_first)),
-                                      boost::make_zip_iterator(boost::make_tuple(wkey.a.end(), b_last)),
-                                      [&](const boost::tuple<const g1_value_type &, const g2_value_type &> &t) {
-                                          t2 = t2 * algebra::pair<curve_type>(t.template get<0>(), t.template get<1>());
-                                      });
-
-                        gt_value_type u1 = gt_value_type::one();
-                        std::for_each(boost::make_zip_iterator(boost::make_tuple(a_first, vkey.b.begin())),
-                                      boost::make_zip_iterator(boost::make_tuple(a_last, vkey.b.end())),
-                                      [&](const boost::tuple<const g1_value_type &, const g2_value_type &> &t) {
-                                          u1 = u1 * algebra::pair<curve_type>(t.template get<0>(), t.template get<1>());
-                                      });
-
-                        gt_value_type u2 = gt_value_type::one();
-                        std::for_each(boost::make_zip_iterator(boost::make_tuple(wkey.b.begin(), b_first)),
-                                      boost::make_zip_iterator(boost::make_tuple(wkey.b.end(), b_last)),
-                                      [&](const boost::tuple<const g1_value_type &, const g2_value_type &> &t) {
-                                          u2 = u2 * algebra::pair<curve_type>(t.template get<0>(), t.template get<1>());
-                                      });
+                    /// Same as above, against a commitment key prepared with prepare().
+                    template<typename InputG1Iterator, typename InputG2Iterator,
+                             typename ValueType1 = typename std::iterator_traits<InputG1Iterator>::value_type,
+                             typename ValueType2 = typename std::iterator_traits<InputG2Iterator>::value_type,
+                             typename std::enable_if<std::is_same<g1_value_type, ValueType1>::value, bool>::type = true,
+                             typename std::enable_if<std::is_same<g2_value_type, ValueType2>::value, bool>::type = true>
+                    static output_type pair(const prepared_vkey_type &vkey, const wkey_type &wkey,
+                                            InputG1Iterator a_first, InputG1Iterator a_last, InputG2Iterator b_first,
+                                            InputG2Iterator b_last) {
+                        BOOST_ASSERT(vkey.has_correct_len(std::distance(a_first, a_last)));
+                        BOOST_ASSERT(wkey.has_correct_len(std::distance(b_first, b_last)));
+                        BOOST_ASSERT(std::distance(a_first, a_last) == std::distance(b_first, b_last));
 
-                        // (A * v)(w * B)
-                        return std::make_pair(algebra::final_exponentiation<curve_type>(t1 * t2),
-                                              algebra::final_exponentiation<curve_type>(u1 * u2));
+                        return pair_with_keys(vkey.a.begin(), vkey.b.begin(), wkey.a.begin(), wkey.b.begin(), a_first,
+                                              a_last, b_first);
                     }
 
                     /// Commits to a single vector of G1 elements in the following way:
@@ -264,22 +348,27 @@ namespace nil {
                     static output_type single(const vkey_type &vkey, InputG1Iterator a_first, InputG1Iterator a_last) {
                         BOOST_ASSERT(vkey.has_correct_len(std::distance(a_first, a_last)));
 
-                        gt_value_type t1 = gt_value_type::one();
-                        std::for_each(boost::make_zip_iterator(boost::make_tuple(a_first, vkey.a.begin())),
-                                      boost::make_zip_iterator(boost::make_tuple(a_last, vkey.a.end())),
-                                      [&](const boost::tuple<const g1_value_type &, const g2_value_type &> &t) {
-                                          t1 = t1 * algebra::pair<curve_type>(t.template get<0>(), t.template get<1>());
-                                      });
-
-                        gt_value_type u1 = gt_value_type::one();
-                        std::for_each(boost::make_zip_iterator(boost::make_tuple(a_first, vkey.b.begin())),
-                                      boost::make_zip_iterator(boost::make_tuple(a_last, vkey.b.end())),
-                                      [&](const boost::tuple<const g1_value_type &, const g2_value_type &> &t) {
-                                          u1 = u1 * algebra::pair<curve_type>(t.template get<0>(), t.template get<1>());
-                                      });
-
-                        return std::make_pair(algebra::final_exponentiation<curve_type>(t1),
-                                              algebra::final_exponentiation<curve_type>(u1));
+                        return single_with_keys(vkey.a.begin(), vkey.b.begin(), a_first, a_last);
+                    }
+
+                    /// Same as above, against a commitment key prepared with prepare().
+                    template<typename InputG1Iterator,
+                             typename ValueType1 = typename std::iterator_traits<InputG1Iterator>::value_type,
+                             typename std::enable_if<std::is_same<g1_value_type, ValueType1>::value, bool>::type = true>
+                    static output_type single(const prepared_vkey_type &vkey, InputG1Iterator a_first,
+                                              InputG1Iterator a_last) {
+                        BOOST_ASSERT(vkey.has_correct_len(std::distance(a_first, a_last)));
+
+                        return single_with_keys(vkey.a.begin(), vkey.b.begin(), a_first, a_last);
+                    }
+
+                private:
+                    static gt_value_type miller_loop_term(const g1_value_type &p, const g2_value_type &q) {
+                        return algebra::pair<curve_type>(p, q);
+                    }
+
+                    static gt_value_type miller_loop_term(const g1_value_type &p, const g2_precomputed_type &q) {
+                        return algebra::miller_loop<curve_type>(algebra::precompute_g1<curve_type>(p), q);
                     }
                 };
             }    // namespace commitments
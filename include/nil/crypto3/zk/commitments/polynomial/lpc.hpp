@@ -30,6 +30,14 @@
 #ifndef CRYPTO3_ZK_LIST_POLYNOMIAL_COMMITMENT_SCHEME_HPP
 #define CRYPTO3_ZK_LIST_POLYNOMIAL_COMMITMENT_SCHEME_HPP
 
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
 #include <nil/crypto3/math/polynomial/polynomial.hpp>
 #include <nil/crypto3/math/polynomial/lagrange_interpolation.hpp>
 
@@ -63,6 +71,7 @@ namespace nil {
                     using fri_type = typename LPCScheme::fri_type;
                     using basic_fri = typename LPCScheme::fri_type;
                     using proof_type = typename LPCScheme::proof_type;
+                    using compressed_proof_type = typename LPCScheme::compressed_proof_type;
                     using transcript_type = typename LPCScheme::transcript_type;
                     using transcript_hash_type = typename LPCScheme::transcript_hash_type;
                     using poly_type = PolynomialType;
@@ -70,12 +79,34 @@ namespace nil {
                     using eval_storage_type = typename LPCScheme::eval_storage_type;
                     using preprocessed_data_type = std::map<std::size_t, std::vector<value_type>>;
 
+                    /**
+                     * Work reused by incremental commitments, see enable_incremental_commit.
+                     */
+                    struct incremental_commit_statistics {
+                        std::size_t reused_polys = 0;
+                        std::size_t extended_polys = 0;
+                        std::size_t reused_trees = 0;
+                    };
+
                 private:
+                    // Extended evaluations and trees of the previous commitment of every incremental batch.
+                    // Shared between copies, so the cache outlives the per-proof copy made by the prover.
+                    // Copies may commit concurrently, every access holds mutex.
+                    struct incremental_commit_cache {
+                        std::mutex mutex;
+                        std::map<std::size_t, std::vector<poly_type>> ldes;
+                        std::map<std::size_t, precommitment_type> trees;
+                        std::map<std::size_t, std::vector<std::pair<std::size_t, std::size_t>>> unchanged;
+                        incremental_commit_statistics statistics;
+                    };
+
                     std::map<std::size_t, precommitment_type> _trees;
                     typename fri_type::params_type _fri_params;
                     value_type _etha;
                     std::map<std::size_t, bool> _batch_fixed;
                     preprocessed_data_type _fixed_polys_values;
+                    std::shared_ptr<incremental_commit_cache> _commit_cache;
+                    std::optional<zk::detail::out_of_core_commit_params> _out_of_core_commit;
 
                 public:
                     lpc_commitment_scheme(const typename fri_type::params_type &fri_params)
@@ -103,11 +134,68 @@ namespace nil {
 
                     commitment_type commit(std::size_t index) {
                         this->state_commited(index);
+                        // Evaluations are only cached for polynomials in the point-value form.
+                        if constexpr (std::is_same<poly_type, math::polynomial_dfs<value_type>>::value) {
+                            if (is_incremental(index)) {
+                                _trees[index] = incremental_precommit(index);
+                                return _trees[index].root();
+                            }
+                            if (_out_of_core_commit) {
+                                _trees[index] = nil::crypto3::zk::algorithms::precommit_out_of_core<fri_type>(
+                                    this->_polys[index], _fri_params.D[0], _fri_params.step_list.front(), *_out_of_core_commit);
+                                return _trees[index].root();
+                            }
+                        }
                         _trees[index] = nil::crypto3::zk::algorithms::precommit<fri_type>(
                             this->_polys[index], _fri_params.D[0], _fri_params.step_list.front());
                         return _trees[index].root();
                     }
 
+                    /**
+                     * Keeps the extended evaluations and the tree of every commitment of batch index,
+                     * so that later commitments of the same batch can reuse them for the polynomials
+                     * marked with mark_unchanged. Costs one extended evaluation per polynomial of memory.
+                     */
+                    void enable_incremental_commit(std::size_t index) {
+                        if (!_commit_cache) {
+                            _commit_cache = std::make_shared<incremental_commit_cache>();
+                        }
+                        std::lock_guard<std::mutex> lock(_commit_cache->mutex);
+                        _commit_cache->ldes[index];
+                    }
+
+                    /**
+                     * Declares polynomials [first, last) of batch index equal to the ones of the previous
+                     * commitment of that batch. The caller is responsible for this being true: the cached
+                     * evaluations are used without any check. Applies to the next commitment only.
+                     */
+                    void mark_unchanged(std::size_t index, std::size_t first, std::size_t last) {
+                        BOOST_ASSERT(is_incremental(index));
+                        BOOST_ASSERT(first <= last);
+                        std::lock_guard<std::mutex> lock(_commit_cache->mutex);
+                        _commit_cache->unchanged[index].emplace_back(first, last);
+                    }
+
+                    /**
+                     * Builds the extended evaluations and the leaves of every following commit of a batch
+                     * in point-value form in file-backed storage, in tiles bounded by params.memory_budget,
+                     * instead of holding them all in memory. The trees are the same. Batches with
+                     * incremental commitment enabled keep their evaluations in memory regardless.
+                     * Nothing else is out of core: proof_eval, the FRI rounds and a prover using the
+                     * scheme for the gate argument and the quotient keep their data in memory.
+                     */
+                    void enable_out_of_core_commit(const zk::detail::out_of_core_commit_params &params) {
+                        _out_of_core_commit = params;
+                    }
+
+                    incremental_commit_statistics incremental_statistics() const {
+                        if (!_commit_cache) {
+                            return incremental_commit_statistics();
+                        }
+                        std::lock_guard<std::mutex> lock(_commit_cache->mutex);
+                        return _commit_cache->statistics;
+                    }
+
                     // Should be done after commitment.
                     void mark_batch_as_fixed(std::size_t index) {
                         _batch_fixed[index] = true;
@@ -238,6 +326,24 @@ namespace nil {
                         return proof_type({this->_z, fri_proof});
                     }
 
+                    static compressed_proof_type compress_proof(const proof_type &proof) {
+                        return compressed_proof_type(
+                            {proof.z, nil::crypto3::zk::algorithms::compress_proof<fri_type>(proof.fri_proof)});
+                    }
+
+                    static proof_type decompress_proof(const compressed_proof_type &proof) {
+                        return proof_type(
+                            {proof.z, nil::crypto3::zk::algorithms::decompress_proof<fri_type>(proof.fri_proof)});
+                    }
+
+                    bool verify_eval(
+                        const compressed_proof_type &proof,
+                        const std::map<std::size_t, commitment_type> &commitments,
+                        transcript_type &transcript
+                    ) {
+                        return verify_eval(decompress_proof(proof), commitments, transcript);
+                    }
+
                     bool verify_eval(
                         const proof_type &proof,
                         const std::map<std::size_t, commitment_type> &commitments,
@@ -335,6 +441,74 @@ namespace nil {
                         params.add_child("D_omegas", D_omegas_node);
                         return params;
                     }
+
+                private:
+                    bool is_incremental(std::size_t index) const {
+                        if (!_commit_cache) {
+                            return false;
+                        }
+                        std::lock_guard<std::mutex> lock(_commit_cache->mutex);
+                        return _commit_cache->ldes.count(index) > 0;
+                    }
+
+                    // Holds the cache lock for the whole commitment, the cached evaluations are moved out and back.
+                    precommitment_type incremental_precommit(std::size_t index) {
+                        PROFILE_PLACEHOLDER_SCOPE("LPC incremental precommit time");
+                        std::lock_guard<std::mutex> lock(_commit_cache->mutex);
+
+                        const std::vector<poly_type> &polys = this->_polys[index];
+                        std::vector<poly_type> &cached = _commit_cache->ldes[index];
+                        std::vector<std::pair<std::size_t, std::size_t>> unchanged =
+                            std::move(_commit_cache->unchanged[index]);
+                        _commit_cache->unchanged.erase(index);
+                        incremental_commit_statistics &statistics = _commit_cache->statistics;
+
+                        // Cached evaluations are only valid for the same batch layout.
+                        std::vector<bool> reuse(polys.size(), false);
+                        std::size_t reused = 0;
+                        if (cached.size() == polys.size()) {
+                            for (const auto &[first, last] : unchanged) {
+                                for (std::size_t i = first; i < std::min(last, polys.size()); ++i) {
+                                    reused += reuse[i] ? 0 : 1;
+                                    reuse[i] = true;
+                                }
+                            }
+                        }
+
+                        if (reused == polys.size() && _commit_cache->trees.count(index) > 0) {
+                            statistics.reused_polys += reused;
+                            ++statistics.reused_trees;
+                            PROFILE_PLACEHOLDER_COUNTER("LPC incremental commit, reused extensions", reused);
+                            PROFILE_PLACEHOLDER_COUNTER("LPC incremental commit, reused trees", 1);
+                            return _commit_cache->trees[index];
+                        }
+
+                        auto D = _fri_params.D[0];
+                        std::vector<poly_type> ldes(polys.size());
+                        // Resize uses low level thread pool, so we need to use the high level one here.
+                        parallel_for(0, polys.size(), [&polys, &cached, &reuse, &ldes, &D](std::size_t i) {
+                            if (reuse[i]) {
+                                ldes[i] = std::move(cached[i]);
+                            } else {
+                                ldes[i] = polys[i];
+                                if (ldes[i].size() != D->size()) {
+                                    ldes[i].resize(D->size(), nullptr, D);
+                                }
+                            }
+                        }, ThreadPool::PoolLevel::HIGH);
+
+                        statistics.reused_polys += reused;
+                        statistics.extended_polys += polys.size() - reused;
+                        PROFILE_PLACEHOLDER_COUNTER("LPC incremental commit, reused extensions", reused);
+                        PROFILE_PLACEHOLDER_COUNTER("LPC incremental commit, computed extensions",
+                                                    polys.size() - reused);
+
+                        precommitment_type tree = nil::crypto3::zk::algorithms::precommit_extended<fri_type>(
+                            ldes, D, _fri_params.step_list.front());
+                        cached = std::move(ldes);
+                        _commit_cache->trees[index] = tree;
+                        return tree;
+                    }
                 };
 
                 template<typename MerkleTreeHashType, typename TranscriptHashType,
@@ -413,6 +587,20 @@ namespace nil {
                         eval_storage_type z;
                         typename basic_fri::proof_type fri_proof;
                     };
+
+                    // proof_type with the FRI Merkle openings stored as multiproofs, see basic_fri::compressed_proof_type.
+                    struct compressed_proof_type {
+                        bool operator==(const compressed_proof_type &rhs) const {
+                            return fri_proof == rhs.fri_proof && z == rhs.z;
+                        }
+
+                        bool operator!=(const compressed_proof_type &rhs) const {
+                            return !(rhs == *this);
+                        }
+
+                        eval_storage_type z;
+                        typename basic_fri::compressed_proof_type fri_proof;
+                    };
                 };
 
                 template<typename FieldType, typename LPCParams>
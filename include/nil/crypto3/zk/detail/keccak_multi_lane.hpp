@@ -0,0 +1,313 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+// @file Declaration of multi-lane Keccak-256 for hashing many messages of the same length.
+//
+// Merkle leaves and nodes are all of the same length, so several of them can run through
+// Keccak-f[1600] side by side: every state word becomes a vector holding that word of 4
+// (AVX2) or 8 (AVX-512) independent states. The widest kernel supported by the CPU is
+// picked at runtime, the scalar one is always available.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ZK_DETAIL_KECCAK_MULTI_LANE_HPP
+#define CRYPTO3_ZK_DETAIL_KECCAK_MULTI_LANE_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+#define CRYPTO3_ZK_KECCAK_MULTI_LANE_X86
+#include <immintrin.h>
+#endif
+
+namespace nil {
+    namespace crypto3 {
+        namespace zk {
+            namespace detail {
+
+                enum class keccak_lanes { scalar = 1, avx2 = 4, avx512 = 8 };
+
+                /**
+                 * The widest Keccak kernel the CPU runs.
+                 */
+                inline keccak_lanes detect_keccak_lanes() {
+#ifdef CRYPTO3_ZK_KECCAK_MULTI_LANE_X86
+                    static const keccak_lanes lanes = []() {
+                        __builtin_cpu_init();
+                        if (__builtin_cpu_supports("avx512f")) {
+                            return keccak_lanes::avx512;
+                        }
+                        if (__builtin_cpu_supports("avx2")) {
+                            return keccak_lanes::avx2;
+                        }
+                        return keccak_lanes::scalar;
+                    }();
+                    return lanes;
+#else
+                    return keccak_lanes::scalar;
+#endif
+                }
+
+                struct keccak_constants {
+                    static constexpr std::size_t rate_bytes = 136;
+                    static constexpr std::size_t rate_words = rate_bytes / 8;
+                    static constexpr std::size_t digest_bytes = 32;
+
+                    static constexpr std::uint64_t round_constants[24] = {
+                        0x0000000000000001ULL, 0x0000000000008082ULL, 0x800000000000808AULL, 0x8000000080008000ULL,
+                        0x000000000000808BULL, 0x0000000080000001ULL, 0x8000000080008081ULL, 0x8000000000008009ULL,
+                        0x000000000000008AULL, 0x0000000000000088ULL, 0x0000000080008009ULL, 0x000000008000000AULL,
+                        0x000000008000808BULL, 0x800000000000008BULL, 0x8000000000008089ULL, 0x8000000000008003ULL,
+                        0x8000000000008002ULL, 0x8000000000000080ULL, 0x000000000000800AULL, 0x800000008000000AULL,
+                        0x8000000080008081ULL, 0x8000000000008080ULL, 0x0000000080000001ULL, 0x8000000080008008ULL};
+
+                    // Rotation of the word x + 5 * y.
+                    static constexpr unsigned rotations[25] = {
+                        0,  1,  62, 28, 27,
+                        36, 44, 6,  55, 20,
+                        3,  10, 43, 25, 39,
+                        41, 45, 15, 21, 8,
+                        18, 2,  61, 56, 14};
+
+                    // Word x + 5 * y moves to y + 5 * ((2 * x + 3 * y) % 5).
+                    static constexpr unsigned destinations[25] = {
+                        0,  10, 20, 5,  15,
+                        16, 1,  11, 21, 6,
+                        7,  17, 2,  12, 22,
+                        23, 8,  18, 3,  13,
+                        14, 24, 9,  19, 4};
+                };
+
+                inline void keccak_f1600(std::uint64_t *a) {
+                    for (std::size_t round = 0; round < 24; round++) {
+                        std::uint64_t c[5], b[25];
+                        for (std::size_t x = 0; x < 5; x++) {
+                            c[x] = a[x] ^ a[x + 5] ^ a[x + 10] ^ a[x + 15] ^ a[x + 20];
+                        }
+                        for (std::size_t x = 0; x < 5; x++) {
+                            std::uint64_t d = c[(x + 4) % 5] ^ ((c[(x + 1) % 5] << 1) | (c[(x + 1) % 5] >> 63));
+                            for (std::size_t y = 0; y < 25; y += 5) {
+                                a[x + y] ^= d;
+                            }
+                        }
+                        for (std::size_t i = 0; i < 25; i++) {
+                            unsigned r = keccak_constants::rotations[i];
+                            b[keccak_constants::destinations[i]] = r == 0 ? a[i] : (a[i] << r) | (a[i] >> (64 - r));
+                        }
+                        for (std::size_t y = 0; y < 25; y += 5) {
+                            for (std::size_t x = 0; x < 5; x++) {
+                                a[x + y] = b[x + y] ^ (~b[(x + 1) % 5 + y] & b[(x + 2) % 5 + y]);
+                            }
+                        }
+                        a[0] ^= keccak_constants::round_constants[round];
+                    }
+                }
+
+#ifdef CRYPTO3_ZK_KECCAK_MULTI_LANE_X86
+                __attribute__((target("avx2"))) inline void keccak_f1600_x4(__m256i *a) {
+                    for (std::size_t round = 0; round < 24; round++) {
+                        __m256i c[5], b[25];
+                        for (std::size_t x = 0; x < 5; x++) {
+                            c[x] = _mm256_xor_si256(_mm256_xor_si256(_mm256_xor_si256(a[x], a[x + 5]),
+                                                                     _mm256_xor_si256(a[x + 10], a[x + 15])),
+                                                    a[x + 20]);
+                        }
+                        for (std::size_t x = 0; x < 5; x++) {
+                            __m256i rotated = _mm256_or_si256(_mm256_slli_epi64(c[(x + 1) % 5], 1),
+                                                              _mm256_srli_epi64(c[(x + 1) % 5], 63));
+                            __m256i d = _mm256_xor_si256(c[(x + 4) % 5], rotated);
+                            for (std::size_t y = 0; y < 25; y += 5) {
+                                a[x + y] = _mm256_xor_si256(a[x + y], d);
+                            }
+                        }
+                        for (std::size_t i = 0; i < 25; i++) {
+                            int r = keccak_constants::rotations[i];
+                            b[keccak_constants::destinations[i]] =
+                                _mm256_or_si256(_mm256_sll_epi64(a[i], _mm_cvtsi32_si128(r)),
+                                                _mm256_srl_epi64(a[i], _mm_cvtsi32_si128(64 - r)));
+                        }
+                        for (std::size_t y = 0; y < 25; y += 5) {
+                            for (std::size_t x = 0; x < 5; x++) {
+                                a[x + y] = _mm256_xor_si256(
+                                    b[x + y], _mm256_andnot_si256(b[(x + 1) % 5 + y], b[(x + 2) % 5 + y]));
+                            }
+                        }
+                        a[0] = _mm256_xor_si256(
+                            a[0], _mm256_set1_epi64x(static_cast<long long>(keccak_constants::round_constants[round])));
+                    }
+                }
+
+                __attribute__((target("avx512f"))) inline void keccak_f1600_x8(__m512i *a) {
+                    for (std::size_t round = 0; round < 24; round++) {
+                        __m512i c[5], b[25];
+                        for (std::size_t x = 0; x < 5; x++) {
+                            // 0x96 is the three-way xor.
+                            c[x] = _mm512_ternarylogic_epi64(
+                                _mm512_ternarylogic_epi64(a[x], a[x + 5], a[x + 10], 0x96), a[x + 15], a[x + 20], 0x96);
+                        }
+                        for (std::size_t x = 0; x < 5; x++) {
+                            __m512i d = _mm512_xor_si512(c[(x + 4) % 5], _mm512_rol_epi64(c[(x + 1) % 5], 1));
+                            for (std::size_t y = 0; y < 25; y += 5) {
+                                a[x + y] = _mm512_xor_si512(a[x + y], d);
+                            }
+                        }
+                        for (std::size_t i = 0; i < 25; i++) {
+                            b[keccak_constants::destinations[i]] =
+                                _mm512_rolv_epi64(a[i], _mm512_set1_epi64(keccak_constants::rotations[i]));
+                        }
+                        for (std::size_t y = 0; y < 25; y += 5) {
+                            for (std::size_t x = 0; x < 5; x++) {
+                                // 0xD2 is b0 ^ (~b1 & b2).
+                                a[x + y] = _mm512_ternarylogic_epi64(b[x + y], b[(x + 1) % 5 + y], b[(x + 2) % 5 + y],
+                                                                     0xD2);
+                            }
+                        }
+                        a[0] = _mm512_xor_si512(
+                            a[0], _mm512_set1_epi64(static_cast<long long>(keccak_constants::round_constants[round])));
+                    }
+                }
+#endif
+
+                /**
+                 * Block block_index of a message of length bytes, padded as Keccak-256 (not SHA3) does.
+                 * Returns the words of the block in words.
+                 */
+                inline void keccak_block_words(const std::uint8_t *message, std::size_t length, std::size_t block_index,
+                                               std::uint64_t *words) {
+                    std::size_t offset = block_index * keccak_constants::rate_bytes;
+                    if (offset + keccak_constants::rate_bytes <= length) {
+                        std::memcpy(words, message + offset, keccak_constants::rate_bytes);
+                    } else {
+                        std::uint8_t block[keccak_constants::rate_bytes] = {0};
+                        std::size_t tail = length - offset;
+                        std::memcpy(block, message + offset, tail);
+                        block[tail] ^= 0x01;
+                        block[keccak_constants::rate_bytes - 1] ^= 0x80;
+                        std::memcpy(words, block, keccak_constants::rate_bytes);
+                    }
+                }
+
+                inline std::size_t keccak_blocks_number(std::size_t length) {
+                    return length / keccak_constants::rate_bytes + 1;
+                }
+
+                inline void keccak_256_scalar(const std::uint8_t *message, std::size_t length, std::uint8_t *digest) {
+                    std::uint64_t state[25] = {0};
+                    std::uint64_t words[keccak_constants::rate_words];
+                    for (std::size_t block = 0; block < keccak_blocks_number(length); block++) {
+                        keccak_block_words(message, length, block, words);
+                        for (std::size_t w = 0; w < keccak_constants::rate_words; w++) {
+                            state[w] ^= words[w];
+                        }
+                        keccak_f1600(state);
+                    }
+                    std::memcpy(digest, state, keccak_constants::digest_bytes);
+                }
+
+#ifdef CRYPTO3_ZK_KECCAK_MULTI_LANE_X86
+                __attribute__((target("avx2"))) inline void keccak_256_x4(
+                        const std::uint8_t *const *messages, std::size_t length, std::uint8_t *const *digests) {
+                    __m256i state[25];
+                    for (auto &word : state) {
+                        word = _mm256_setzero_si256();
+                    }
+                    std::uint64_t words[4][keccak_constants::rate_words];
+                    for (std::size_t block = 0; block < keccak_blocks_number(length); block++) {
+                        for (std::size_t lane = 0; lane < 4; lane++) {
+                            keccak_block_words(messages[lane], length, block, words[lane]);
+                        }
+                        for (std::size_t w = 0; w < keccak_constants::rate_words; w++) {
+                            state[w] = _mm256_xor_si256(
+                                state[w], _mm256_set_epi64x(words[3][w], words[2][w], words[1][w], words[0][w]));
+                        }
+                        keccak_f1600_x4(state);
+                    }
+                    alignas(32) std::uint64_t out[4];
+                    for (std::size_t w = 0; w < keccak_constants::digest_bytes / 8; w++) {
+                        _mm256_store_si256(reinterpret_cast<__m256i *>(out), state[w]);
+                        for (std::size_t lane = 0; lane < 4; lane++) {
+                            std::memcpy(digests[lane] + 8 * w, &out[lane], 8);
+                        }
+                    }
+                }
+
+                __attribute__((target("avx512f"))) inline void keccak_256_x8(
+                        const std::uint8_t *const *messages, std::size_t length, std::uint8_t *const *digests) {
+                    __m512i state[25];
+                    for (auto &word : state) {
+                        word = _mm512_setzero_si512();
+                    }
+                    std::uint64_t words[8][keccak_constants::rate_words];
+                    for (std::size_t block = 0; block < keccak_blocks_number(length); block++) {
+                        for (std::size_t lane = 0; lane < 8; lane++) {
+                            keccak_block_words(messages[lane], length, block, words[lane]);
+                        }
+                        for (std::size_t w = 0; w < keccak_constants::rate_words; w++) {
+                            state[w] = _mm512_xor_si512(
+                                state[w], _mm512_set_epi64(words[7][w], words[6][w], words[5][w], words[4][w],
+                                                           words[3][w], words[2][w], words[1][w], words[0][w]));
+                        }
+                        keccak_f1600_x8(state);
+                    }
+                    alignas(64) std::uint64_t out[8];
+                    for (std::size_t w = 0; w < keccak_constants::digest_bytes / 8; w++) {
+                        _mm512_store_si512(out, state[w]);
+                        for (std::size_t lane = 0; lane < 8; lane++) {
+                            std::memcpy(digests[lane] + 8 * w, &out[lane], 8);
+                        }
+                    }
+                }
+#endif
+
+                /**
+                 * Keccak-256 of count messages of the same length, written to digests. Runs the widest
+                 * kernel allowed by lanes over groups of messages and the scalar one over the rest.
+                 */
+                inline void keccak_256_batch(const std::uint8_t *const *messages, std::size_t length,
+                                             std::uint8_t *const *digests, std::size_t count,
+                                             keccak_lanes lanes = detect_keccak_lanes()) {
+                    std::size_t i = 0;
+#ifdef CRYPTO3_ZK_KECCAK_MULTI_LANE_X86
+                    if (lanes == keccak_lanes::avx512) {
+                        for (; i + 8 <= count; i += 8) {
+                            keccak_256_x8(messages + i, length, digests + i);
+                        }
+                    }
+                    if (lanes == keccak_lanes::avx512 || lanes == keccak_lanes::avx2) {
+                        for (; i + 4 <= count; i += 4) {
+                            keccak_256_x4(messages + i, length, digests + i);
+                        }
+                    }
+#endif
+                    for (; i < count; i++) {
+                        keccak_256_scalar(messages[i], length, digests[i]);
+                    }
+                }
+            }    // namespace detail
+        }        // namespace zk
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ZK_DETAIL_KECCAK_MULTI_LANE_HPP
@@ -0,0 +1,274 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+// @file Declaration of file-backed arrays for out-of-core commitments.
+//
+// A mapped_storage is an array living in a memory-mapped temporary file. The file is
+// unlinked right after it is created, so it disappears with the mapping, even on a
+// crash. Pages of the array are written back and dropped from memory with evict, so
+// a producer streaming through it in tiles keeps only the current tile resident.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ZK_DETAIL_MAPPED_STORAGE_HPP
+#define CRYPTO3_ZK_DETAIL_MAPPED_STORAGE_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+#include <boost/assert.hpp>
+#include <boost/range/iterator_range.hpp>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace nil {
+    namespace crypto3 {
+        namespace zk {
+            namespace detail {
+
+                /**
+                 * Configuration of out-of-core commits, see lpc_commitment_scheme::enable_out_of_core_commit.
+                 * Only the extended evaluations and the leaves of a commit are out of core.
+                 */
+                struct out_of_core_commit_params {
+                    // Directory of the temporary files. They are unlinked as soon as created.
+                    std::string directory = "/tmp";
+                    // Bytes of working data kept in memory at once. A tile never gets smaller than
+                    // one extended polynomial, so that is the lowest budget which is respected.
+                    std::size_t memory_budget = std::size_t(1) << 30;
+
+                    out_of_core_commit_params() = default;
+
+                    out_of_core_commit_params(std::size_t memory_budget, const std::string &directory = "/tmp") :
+                        directory(directory), memory_budget(memory_budget) {
+                    }
+
+                    // Number of items of item_size bytes fitting the budget, in [1, total].
+                    std::size_t tile_size(std::size_t item_size, std::size_t total) const {
+                        std::size_t size = item_size == 0 ? total : memory_budget / item_size;
+                        return std::max<std::size_t>(1, std::min(size, total));
+                    }
+                };
+
+                /**
+                 * Counters of the out-of-core working set. The resident bytes are the tiles which the
+                 * out-of-core code holds in memory, not the pages of the mapped files, which the kernel
+                 * can always write back.
+                 */
+                struct out_of_core_statistics {
+                    std::atomic<std::size_t> files {0};
+                    std::atomic<std::size_t> mapped_bytes {0};
+                    std::atomic<std::size_t> resident_bytes {0};
+                    std::atomic<std::size_t> peak_resident_bytes {0};
+
+                    void reset() {
+                        files = 0;
+                        mapped_bytes = 0;
+                        resident_bytes = 0;
+                        peak_resident_bytes = 0;
+                    }
+
+                    void acquired(std::size_t size) {
+                        std::size_t current = resident_bytes += size;
+                        std::size_t peak = peak_resident_bytes.load();
+                        while (current > peak && !peak_resident_bytes.compare_exchange_weak(peak, current)) {
+                        }
+                    }
+
+                    void released(std::size_t size) {
+                        resident_bytes -= size;
+                    }
+
+                    static out_of_core_statistics &instance() {
+                        static out_of_core_statistics statistics;
+                        return statistics;
+                    }
+                };
+
+                template<typename ValueType>
+                class mapped_storage {
+                public:
+                    typedef ValueType value_type;
+                    typedef boost::iterator_range<const ValueType *> const_range_type;
+
+                    constexpr static const std::size_t fill_chunk_bytes = std::size_t(64) << 20;
+
+                    mapped_storage() : _data(nullptr), _size(0), _bytes(0), _fd(-1) {
+                    }
+
+                    /**
+                     * Maps size default-constructed elements in a new temporary file of directory.
+                     */
+                    mapped_storage(std::size_t size, const std::string &directory) :
+                        _data(nullptr), _size(size), _bytes(size * sizeof(ValueType)), _fd(-1) {
+                        if (_bytes == 0) {
+                            return;
+                        }
+
+                        std::string path = directory + "/zk_mapped_storage_XXXXXX";
+                        std::vector<char> path_buffer(path.begin(), path.end());
+                        path_buffer.push_back('\0');
+                        _fd = mkstemp(path_buffer.data());
+                        if (_fd < 0) {
+                            throw std::system_error(errno, std::generic_category(), "mapped_storage: mkstemp");
+                        }
+                        unlink(path_buffer.data());
+
+                        if (ftruncate(_fd, _bytes) != 0) {
+                            int error = errno;
+                            close(_fd);
+                            throw std::system_error(error, std::generic_category(), "mapped_storage: ftruncate");
+                        }
+                        void *memory = mmap(nullptr, _bytes, PROT_READ | PROT_WRITE, MAP_SHARED, _fd, 0);
+                        if (memory == MAP_FAILED) {
+                            int error = errno;
+                            close(_fd);
+                            throw std::system_error(error, std::generic_category(), "mapped_storage: mmap");
+                        }
+                        _data = static_cast<ValueType *>(memory);
+                        madvise(memory, _bytes, MADV_SEQUENTIAL);
+
+                        /* Constructed chunk by chunk, so the whole file is never resident. */
+                        std::size_t chunk = std::max<std::size_t>(1, fill_chunk_bytes / sizeof(ValueType));
+                        for (std::size_t first = 0; first < _size; first += chunk) {
+                            std::size_t last = std::min(first + chunk, _size);
+                            std::uninitialized_fill(_data + first, _data + last, ValueType());
+                            evict(first, last);
+                        }
+
+                        out_of_core_statistics::instance().files++;
+                        out_of_core_statistics::instance().mapped_bytes += _bytes;
+                    }
+
+                    mapped_storage(const mapped_storage &) = delete;
+                    mapped_storage &operator=(const mapped_storage &) = delete;
+
+                    mapped_storage(mapped_storage &&other) noexcept :
+                        _data(other._data), _size(other._size), _bytes(other._bytes), _fd(other._fd) {
+                        other._data = nullptr;
+                        other._size = 0;
+                        other._bytes = 0;
+                        other._fd = -1;
+                    }
+
+                    mapped_storage &operator=(mapped_storage &&other) noexcept {
+                        if (this != &other) {
+                            release();
+                            std::swap(_data, other._data);
+                            std::swap(_size, other._size);
+                            std::swap(_bytes, other._bytes);
+                            std::swap(_fd, other._fd);
+                        }
+                        return *this;
+                    }
+
+                    ~mapped_storage() {
+                        release();
+                    }
+
+                    std::size_t size() const {
+                        return _size;
+                    }
+
+                    ValueType *data() {
+                        return _data;
+                    }
+
+                    const ValueType *data() const {
+                        return _data;
+                    }
+
+                    ValueType &operator[](std::size_t index) {
+                        BOOST_ASSERT(index < _size);
+                        return _data[index];
+                    }
+
+                    const ValueType &operator[](std::size_t index) const {
+                        BOOST_ASSERT(index < _size);
+                        return _data[index];
+                    }
+
+                    const_range_type range(std::size_t first, std::size_t last) const {
+                        BOOST_ASSERT(first <= last && last <= _size);
+                        return const_range_type(_data + first, _data + last);
+                    }
+
+                    /**
+                     * Writes elements [first, last) back to the file and drops their pages, both from
+                     * the mapping and from the page cache. Only whole pages inside the range are dropped.
+                     */
+                    void evict(std::size_t first, std::size_t last) {
+                        BOOST_ASSERT(first <= last && last <= _size);
+                        std::size_t page = sysconf(_SC_PAGESIZE);
+                        std::size_t begin = (first * sizeof(ValueType) + page - 1) / page * page;
+                        std::size_t end = last * sizeof(ValueType) / page * page;
+                        if (_data == nullptr || begin >= end) {
+                            return;
+                        }
+                        char *memory = reinterpret_cast<char *>(_data);
+                        msync(memory + begin, end - begin, MS_SYNC);
+                        madvise(memory + begin, end - begin, MADV_DONTNEED);
+#if defined(POSIX_FADV_DONTNEED)
+                        posix_fadvise(_fd, begin, end - begin, POSIX_FADV_DONTNEED);
+#endif
+                    }
+
+                private:
+                    void release() {
+                        if (_data != nullptr) {
+                            if constexpr (!std::is_trivially_destructible<ValueType>::value) {
+                                for (std::size_t i = 0; i < _size; ++i) {
+                                    _data[i].~ValueType();
+                                }
+                            }
+                            munmap(_data, _bytes);
+                            out_of_core_statistics::instance().mapped_bytes -= _bytes;
+                            _data = nullptr;
+                        }
+                        if (_fd >= 0) {
+                            close(_fd);
+                            _fd = -1;
+                        }
+                        _size = 0;
+                        _bytes = 0;
+                    }
+
+                    ValueType *_data;
+                    std::size_t _size;
+                    std::size_t _bytes;
+                    int _fd;
+                };
+            }    // namespace detail
+        }        // namespace zk
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ZK_DETAIL_MAPPED_STORAGE_HPP
@@ -0,0 +1,210 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+// @file Declaration of Merkle tree construction with batched leaf and node hashing.
+//
+// Binary Keccak-256 trees over byte leaves of the same length run the multi-lane Keccak
+// kernel, binary Poseidon trees run the Poseidon permutation directly on pairs of nodes.
+// Every row is hashed in parallel blocks and appended to the tree as it is built. The tree
+// is the same as the one of containers::make_merkle_tree, which is used for all other trees.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ZK_DETAIL_MERKLE_MULTI_LANE_HPP
+#define CRYPTO3_ZK_DETAIL_MERKLE_MULTI_LANE_HPP
+
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+#include <nil/crypto3/hash/algorithm/hash.hpp>
+#include <nil/crypto3/hash/keccak.hpp>
+#include <nil/crypto3/hash/poseidon.hpp>
+
+#include <nil/crypto3/container/merkle/tree.hpp>
+
+#include <nil/crypto3/zk/detail/keccak_multi_lane.hpp>
+
+#include <nil/actor/core/thread_pool.hpp>
+#include <nil/actor/core/parallelization_utils.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace zk {
+            namespace detail {
+
+                template<typename Hash, std::size_t Arity, typename LeafIterator>
+                struct is_multi_lane_merkle_tree {
+                    typedef typename std::iterator_traits<LeafIterator>::value_type leaf_type;
+                    typedef decltype(std::begin(std::declval<const leaf_type &>())) word_iterator;
+                    typedef typename std::iterator_traits<word_iterator>::value_type word_type;
+
+                    constexpr static const bool value = std::is_same<Hash, hashes::keccak_1600<256>>::value &&
+                                                        Arity == 2 && std::is_same<word_type, std::uint8_t>::value;
+                };
+
+                template<typename Hash, std::size_t Arity, typename Enable = void>
+                struct is_batched_poseidon_merkle_tree {
+                    constexpr static const bool value = false;
+                };
+
+                // Poseidon with a width of 3 compresses two nodes in one permutation.
+                template<typename Hash, std::size_t Arity>
+                struct is_batched_poseidon_merkle_tree<
+                        Hash, Arity,
+                        typename std::enable_if<hashes::is_specialization_of<hashes::poseidon, Hash>::value>::type> {
+                    constexpr static const bool value = Arity == 2 && Hash::policy_type::state_words == 3;
+                };
+
+                // Digests hashed per block, bounds the buffers next to the tree.
+                constexpr std::size_t merkle_row_block_size = 1 << 16;
+
+                /**
+                 * Appends the rows of a binary tree over leafs_number leaves to tree, starting from the leaves.
+                 * hash_leaves(begin, end, digests) hashes leaves [begin, end), hash_nodes(tree, begin, end,
+                 * children_begin, digests) hashes parents [begin, end) of a row whose children start at
+                 * children_begin. Both are called on parallel chunks of a block.
+                 */
+                template<typename Hash, typename LeafHasher, typename NodeHasher>
+                void append_merkle_rows(containers::merkle_tree<Hash, 2> &tree, std::size_t leafs_number,
+                                        LeafHasher hash_leaves, NodeHasher hash_nodes) {
+                    typedef typename Hash::digest_type digest_type;
+                    std::vector<digest_type> block(std::min(leafs_number, merkle_row_block_size));
+
+                    auto append_row = [&tree, &block](std::size_t row_size, auto hash_range) {
+                        for (std::size_t block_begin = 0; block_begin < row_size; block_begin += block.size()) {
+                            std::size_t block_end = std::min(row_size, block_begin + block.size());
+                            wait_for_all(parallel_run_in_chunks<void>(
+                                block_end - block_begin,
+                                [block_begin, &block, &hash_range](std::size_t begin, std::size_t end) {
+                                    hash_range(block_begin + begin, block_begin + end, block.data() + begin);
+                                }));
+                            for (std::size_t i = 0; i < block_end - block_begin; i++) {
+                                tree.emplace_back(std::move(block[i]));
+                            }
+                        }
+                    };
+
+                    append_row(leafs_number, hash_leaves);
+                    std::size_t row_begin = 0;
+                    for (std::size_t row_size = leafs_number; row_size > 1; row_size /= 2) {
+                        append_row(row_size / 2, [&tree, &hash_nodes, row_begin](
+                                std::size_t begin, std::size_t end, digest_type *digests) {
+                            hash_nodes(tree, begin, end, row_begin, digests);
+                        });
+                        row_begin += row_size;
+                    }
+                }
+
+                /**
+                 * Same as containers::make_merkle_tree<Hash, Arity>(first, last). Binary Keccak-256 trees over
+                 * byte leaves of the same length are hashed with the multi-lane kernel given by lanes, binary
+                 * Poseidon trees with the Poseidon permutation.
+                 */
+                template<typename Hash, std::size_t Arity, typename LeafIterator>
+                containers::merkle_tree<Hash, Arity> make_merkle_tree_multi_lane(
+                        LeafIterator first, LeafIterator last, keccak_lanes lanes = detect_keccak_lanes()) {
+                    typedef typename Hash::digest_type digest_type;
+                    const std::size_t leafs_number = std::distance(first, last);
+                    if (leafs_number < 2 || (leafs_number & (leafs_number - 1)) != 0) {
+                        return containers::make_merkle_tree<Hash, Arity>(first, last);
+                    }
+
+                    if constexpr (is_multi_lane_merkle_tree<Hash, Arity, LeafIterator>::value) {
+                        static_assert(sizeof(digest_type) == keccak_constants::digest_bytes,
+                                      "Digests must be stored back to back");
+
+                        const std::size_t leaf_size = std::distance(std::begin(*first), std::end(*first));
+                        for (LeafIterator it = first; it != last; ++it) {
+                            if (std::size_t(std::distance(std::begin(*it), std::end(*it))) != leaf_size) {
+                                return containers::make_merkle_tree<Hash, Arity>(first, last);
+                            }
+                        }
+
+                        containers::merkle_tree<Hash, Arity> tree(leafs_number);
+                        append_merkle_rows<Hash>(tree, leafs_number,
+                            [first, leaf_size, lanes](std::size_t begin, std::size_t end, digest_type *digests) {
+                                std::vector<const std::uint8_t *> messages(end - begin);
+                                std::vector<std::uint8_t *> digest_pointers(end - begin);
+                                LeafIterator it = std::next(first, begin);
+                                for (std::size_t i = begin; i < end; i++, ++it) {
+                                    messages[i - begin] = leaf_size == 0 ? nullptr : &*std::begin(*it);
+                                    digest_pointers[i - begin] = digests[i - begin].data();
+                                }
+                                keccak_256_batch(messages.data(), leaf_size, digest_pointers.data(), end - begin,
+                                                 lanes);
+                            },
+                            [lanes](const containers::merkle_tree<Hash, Arity> &tree, std::size_t begin,
+                                    std::size_t end, std::size_t children_begin, digest_type *digests) {
+                                /* A parent hashes the concatenation of its two children. */
+                                constexpr std::size_t message_size = 2 * keccak_constants::digest_bytes;
+                                std::vector<std::uint8_t> messages((end - begin) * message_size);
+                                std::vector<const std::uint8_t *> message_pointers(end - begin);
+                                std::vector<std::uint8_t *> digest_pointers(end - begin);
+                                for (std::size_t i = begin; i < end; i++) {
+                                    std::uint8_t *message = messages.data() + (i - begin) * message_size;
+                                    const digest_type &left = tree[children_begin + 2 * i];
+                                    const digest_type &right = tree[children_begin + 2 * i + 1];
+                                    std::copy(left.begin(), left.end(), message);
+                                    std::copy(right.begin(), right.end(), message + keccak_constants::digest_bytes);
+                                    message_pointers[i - begin] = message;
+                                    digest_pointers[i - begin] = digests[i - begin].data();
+                                }
+                                keccak_256_batch(message_pointers.data(), message_size, digest_pointers.data(),
+                                                 end - begin, lanes);
+                            });
+                        return tree;
+                    } else if constexpr (is_batched_poseidon_merkle_tree<Hash, Arity>::value) {
+                        typedef hashes::detail::poseidon_permutation<typename Hash::policy_type> permutation_type;
+
+                        containers::merkle_tree<Hash, Arity> tree(leafs_number);
+                        append_merkle_rows<Hash>(tree, leafs_number,
+                            [first](std::size_t begin, std::size_t end, digest_type *digests) {
+                                LeafIterator it = std::next(first, begin);
+                                for (std::size_t i = begin; i < end; i++, ++it) {
+                                    digests[i - begin] = static_cast<digest_type>(hash<Hash>(*it));
+                                }
+                            },
+                            [](const containers::merkle_tree<Hash, Arity> &tree, std::size_t begin,
+                               std::size_t end, std::size_t children_begin, digest_type *digests) {
+                                /* A parent is the last word of the permuted state [0, left, right]. */
+                                typename permutation_type::state_type state;
+                                for (std::size_t i = begin; i < end; i++) {
+                                    state[0] = digest_type::zero();
+                                    state[1] = tree[children_begin + 2 * i];
+                                    state[2] = tree[children_begin + 2 * i + 1];
+                                    permutation_type::permute(state);
+                                    digests[i - begin] = state[2];
+                                }
+                            });
+                        return tree;
+                    } else {
+                        return containers::make_merkle_tree<Hash, Arity>(first, last);
+                    }
+                }
+            }    // namespace detail
+        }        // namespace zk
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ZK_DETAIL_MERKLE_MULTI_LANE_HPP
@@ -24,11 +24,17 @@
 // @file Classes for mathematical expressions:
 // - a term (i.e.,  a * x_i1 * x_i2 * ... * x_in)
 // - an expression - stores any mathematical expression with -+* operatos and 'pow' in a form of a tree.
+//
+// Operation nodes are immutable and hold their operands by shared pointers, so copying an expression
+// or building a bigger one out of it never copies the subtrees. Every node caches its hash and degree.
 //---------------------------------------------------------------------------//
 
 #ifndef CRYPTO3_ZK_MATH_EXPRESSION_HPP
 #define CRYPTO3_ZK_MATH_EXPRESSION_HPP
 
+#include <algorithm>
+#include <cstdint>
+#include <memory>
 #include <ostream>
 #include <vector>
 #include <unordered_map>
@@ -149,6 +155,19 @@ namespace nil {
                     return hash;
                 }
 
+                // Degree in the variables, i.e. what expression_max_degree_visitor returns.
+                std::uint32_t get_degree() const {
+                    switch (expr.which()) {
+                        case 0:
+                            return boost::get<term<VariableType>>(expr).get_degree();
+                        case 1:
+                            return boost::get<pow_operation<VariableType>>(expr).get_degree();
+                        case 2:
+                            return boost::get<binary_arithmetic_operation<VariableType>>(expr).get_degree();
+                    }
+                    return 0;
+                }
+
                 // This function must be called by all the non-const member functions
                 // to make sure a fresh hash value is maintained.
                 void update_hash() {
@@ -251,6 +270,10 @@ namespace nil {
                     return hash;
                 }
 
+                std::uint32_t get_degree() const {
+                    return vars.size();
+                }
+
                 void update_hash() {
                     std::hash<VariableType> vars_hasher;
                     std::hash<typename VariableType::assignment_type> coeff_hasher;
@@ -288,9 +311,16 @@ namespace nil {
             {
             public:
                 typedef VariableType variable_type;
+                typedef std::shared_ptr<const expression<VariableType>> expression_ptr_type;
 
                 pow_operation(const expression<VariableType>& expr, int power)
-                    : expr(expr)
+                    : expr(std::make_shared<const expression<VariableType>>(expr))
+                    , power(power) {
+                    update_hash();
+                }
+
+                pow_operation(expression_ptr_type expr, int power)
+                    : expr(std::move(expr))
                     , power(power) {
                     update_hash();
                 }
@@ -305,6 +335,11 @@ namespace nil {
                 bool operator!=(const pow_operation<VariableType>& other) const;
 
                 const expression<VariableType>& get_expr() const {
+                    return *expr;
+                }
+
+                // The operand node, shared with every other expression built out of it.
+                const expression_ptr_type& get_expr_ptr() const {
                     return expr;
                 }
 
@@ -316,21 +351,27 @@ namespace nil {
                     return hash;
                 }
 
+                std::uint32_t get_degree() const {
+                    return degree;
+                }
+
                 void update_hash() {
-                    std::size_t result = expr.get_hash();
+                    std::size_t result = expr->get_hash();
                     boost::hash_combine(result, power);
                     hash = result;
+                    degree = expr->get_degree() * power;
                 }
 
             private:
                 // This is private, and we need to be very careful to make sure we recompute the hash value every time this
                 // is changed through a non-const function.
-                expression<VariableType> expr;
+                expression_ptr_type expr;
                 int power;
 
                 // We will store the hash value. This is faster that computing it
                 // whenever it's needed, because we need to iterate over subexpressions to compute it.
                 std::size_t hash;
+                std::uint32_t degree;
             };
 
             // One of +, -, *, / operations. We build an expression tree using this class.
@@ -339,13 +380,24 @@ namespace nil {
             {
             public:
                 using ArithmeticOperatorType = ArithmeticOperator;
+                typedef std::shared_ptr<const expression<VariableType>> expression_ptr_type;
 
                 binary_arithmetic_operation(
                         const expression<VariableType>& expr_left,
                         const expression<VariableType>& expr_right,
                         ArithmeticOperator op)
-                    : expr_left(expr_left)
-                    , expr_right(expr_right)
+                    : expr_left(std::make_shared<const expression<VariableType>>(expr_left))
+                    , expr_right(std::make_shared<const expression<VariableType>>(expr_right))
+                    , op(op) {
+                    update_hash();
+                }
+
+                binary_arithmetic_operation(
+                        expression_ptr_type expr_left,
+                        expression_ptr_type expr_right,
+                        ArithmeticOperator op)
+                    : expr_left(std::move(expr_left))
+                    , expr_right(std::move(expr_right))
                     , op(op) {
                     update_hash();
                 }
@@ -378,10 +430,18 @@ namespace nil {
                 }
 
                 const expression<VariableType>& get_expr_left() const {
-                    return expr_left;
+                    return *expr_left;
                 }
 
                 const expression<VariableType>& get_expr_right() const {
+                    return *expr_right;
+                }
+
+                const expression_ptr_type& get_expr_left_ptr() const {
+                    return expr_left;
+                }
+
+                const expression_ptr_type& get_expr_right_ptr() const {
                     return expr_right;
                 }
 
@@ -393,23 +453,34 @@ namespace nil {
                     return hash;
                 }
 
+                std::uint32_t get_degree() const {
+                    return degree;
+                }
+
                 void update_hash() {
-                    std::size_t result = expr_left.get_hash();
-                    boost::hash_combine(result, expr_right.get_hash());
+                    std::size_t result = expr_left->get_hash();
+                    boost::hash_combine(result, expr_right->get_hash());
                     boost::hash_combine(result, (std::size_t)op);
                     hash = result;
+
+                    if (op == ArithmeticOperator::MULT) {
+                        degree = expr_left->get_degree() + expr_right->get_degree();
+                    } else {
+                        degree = std::max(expr_left->get_degree(), expr_right->get_degree());
+                    }
                 }
 
             private:
                 // This is private, and we need to be very careful to make sure we recompute the hash value every time this
                 // is changed through a non-const function.
-                expression<VariableType> expr_left;
-                expression<VariableType> expr_right;
+                expression_ptr_type expr_left;
+                expression_ptr_type expr_right;
                 ArithmeticOperator op;
 
                 // We will store the hash value. This is faster that computing it
                 // whenever it's needed, because we need to iterate over subexpressions to compute it.
                 std::size_t hash;
+                std::uint32_t degree;
 
             };
 
@@ -583,6 +654,9 @@ namespace nil {
 
             template<typename VariableType>
             bool term<VariableType>::operator==(const term<VariableType>& other) const {
+                if (this->hash != other.hash) {
+                    return false;
+                }
                 if (this->coeff != other.coeff) {
                     return false;
                 }
@@ -672,7 +746,8 @@ namespace nil {
             template<typename VariableType>
             bool pow_operation<VariableType>::operator==(
                     const pow_operation<VariableType>& other) const {
-                return this->power == other.get_power() && this->expr == other.get_expr();
+                return this->power == other.get_power() &&
+                       (this->expr == other.get_expr_ptr() || *this->expr == other.get_expr());
             }
 
             // Used for testing purposes.
@@ -686,9 +761,10 @@ namespace nil {
             template<typename VariableType>
             bool binary_arithmetic_operation<VariableType>::operator==(
                     const binary_arithmetic_operation<VariableType>& other) const {
+                // Shared operands are equal without walking them.
                 return this->op == other.get_op() &&
-                       this->expr_left == other.get_expr_left() &&
-                       this->expr_right == other.get_expr_right();
+                       (this->expr_left == other.get_expr_left_ptr() || *this->expr_left == other.get_expr_left()) &&
+                       (this->expr_right == other.get_expr_right_ptr() || *this->expr_right == other.get_expr_right());
             }
 
             // Used for testing purposes. Checks for EXACT EQUALITY ONLY, no isomorphism!!!
@@ -701,13 +777,16 @@ namespace nil {
             // Used for testing purposes and hashmaps. Checks for EXACT EQUALITY ONLY, no isomorphism!!!
             template<typename VariableType>
             bool expression<VariableType>::operator==(const expression<VariableType>& other) const {
+                if (this->hash != other.get_hash()) {
+                    return false;
+                }
                 return this->expr == other.get_expr();
             }
 
             // Used for testing purposes and hashmaps. Checks for EXACT EQUALITY ONLY, no isomorphism!!!
             template<typename VariableType>
             bool expression<VariableType>::operator!=(const expression<VariableType>& other) const {
-                return this->expr != other.get_expr();
+                return !(*this == other);
             }
         }    // namespace math
     }    // namespace crypto3
@@ -0,0 +1,162 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+// @file Hash-consing arena for expressions.
+//
+// Interning an expression rebuilds it so that every subexpression equal to one seen
+// before is replaced by the node already stored in the arena. Circuits repeat the same
+// subexpressions across thousands of constraints, after interning each of them exists
+// once, and visitors which memoize by subexpression do their work once per unique node.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ZK_MATH_EXPRESSION_ARENA_HPP
+#define CRYPTO3_ZK_MATH_EXPRESSION_ARENA_HPP
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
+#include <boost/variant/static_visitor.hpp>
+#include <boost/variant/apply_visitor.hpp>
+
+#include <nil/crypto3/zk/math/expression.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace math {
+
+            /**
+             * A set of unique expression nodes. Interning is thread-safe: the nodes are split
+             * into shards by hash, each guarded by its own mutex, so constraints of different
+             * gates can be interned in parallel.
+             */
+            template<typename VariableType>
+            class expression_arena {
+            public:
+                typedef VariableType variable_type;
+                typedef expression<VariableType> expression_type;
+                typedef std::shared_ptr<const expression_type> node_type;
+
+                explicit expression_arena(std::size_t shards_amount = 64)
+                    : _shards(shards_amount == 0 ? 1 : shards_amount)
+                    , _requests(0) {
+                }
+
+                expression_arena(const expression_arena&) = delete;
+                expression_arena& operator=(const expression_arena&) = delete;
+
+                /**
+                 * Returns the node of the arena equal to expr, adding it and all of its
+                 * subexpressions first if needed.
+                 */
+                node_type intern_node(const expression_type &expr) {
+                    intern_visitor visitor(*this);
+                    return boost::apply_visitor(visitor, expr.get_expr());
+                }
+
+                /**
+                 * Returns an expression equal to expr, whose subexpressions are shared with
+                 * everything else interned in this arena.
+                 */
+                expression_type intern(const expression_type &expr) {
+                    return *intern_node(expr);
+                }
+
+                // Number of unique nodes stored.
+                std::size_t size() const {
+                    std::size_t result = 0;
+                    for (const auto &shard : _shards) {
+                        std::lock_guard<std::mutex> lock(shard.mutex);
+                        result += shard.nodes.size();
+                    }
+                    return result;
+                }
+
+                // Number of nodes looked up, i.e. the total size of all the interned trees.
+                std::size_t requests() const {
+                    return _requests.load();
+                }
+
+            private:
+                struct node_hash {
+                    std::size_t operator()(const node_type &node) const {
+                        return node->get_hash();
+                    }
+                };
+
+                struct node_equal {
+                    bool operator()(const node_type &left, const node_type &right) const {
+                        return left == right || *left == *right;
+                    }
+                };
+
+                struct shard_type {
+                    mutable std::mutex mutex;
+                    std::unordered_set<node_type, node_hash, node_equal> nodes;
+                };
+
+                // Rebuilds a node out of already interned operands, then looks it up.
+                class intern_visitor : public boost::static_visitor<node_type> {
+                public:
+                    intern_visitor(expression_arena &arena) : _arena(arena) {
+                    }
+
+                    node_type operator()(const term<VariableType> &t) {
+                        return _arena.find_or_insert(expression_type(t));
+                    }
+
+                    node_type operator()(const pow_operation<VariableType> &pow) {
+                        node_type base = boost::apply_visitor(*this, pow.get_expr().get_expr());
+                        return _arena.find_or_insert(pow_operation<VariableType>(std::move(base), pow.get_power()));
+                    }
+
+                    node_type operator()(const binary_arithmetic_operation<VariableType> &op) {
+                        node_type left = boost::apply_visitor(*this, op.get_expr_left().get_expr());
+                        node_type right = boost::apply_visitor(*this, op.get_expr_right().get_expr());
+                        return _arena.find_or_insert(binary_arithmetic_operation<VariableType>(
+                            std::move(left), std::move(right), op.get_op()));
+                    }
+
+                private:
+                    expression_arena &_arena;
+                };
+
+                node_type find_or_insert(expression_type &&expr) {
+                    ++_requests;
+                    node_type node = std::make_shared<const expression_type>(std::move(expr));
+                    shard_type &shard = _shards[node->get_hash() % _shards.size()];
+
+                    std::lock_guard<std::mutex> lock(shard.mutex);
+                    return *shard.nodes.insert(std::move(node)).first;
+                }
+
+                std::vector<shard_type> _shards;
+                std::atomic<std::size_t> _requests;
+            };
+        }    // namespace math
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ZK_MATH_EXPRESSION_ARENA_HPP
@@ -24,7 +24,10 @@
 #ifndef CRYPTO3_ZK_MATH_EXPRESSION_VISITORS_HPP
 #define CRYPTO3_ZK_MATH_EXPRESSION_VISITORS_HPP
 
+#include <algorithm>
+#include <functional>
 #include <vector>
+#include <unordered_map>
 #include <boost/variant/static_visitor.hpp>
 #include <boost/variant/apply_visitor.hpp>
 #include <nil/crypto3/zk/math/expression.hpp>
@@ -33,39 +36,29 @@
 namespace nil {
     namespace crypto3 {
         namespace math {
-            // Used for counting max degree of an expression.
+            // Used for counting max degree of an expression. Every node caches its degree,
+            // so this is O(1).
             template<typename VariableType>
             class expression_max_degree_visitor : public boost::static_visitor<std::uint32_t> {
             public:
                 expression_max_degree_visitor() {}
 
                 std::uint32_t compute_max_degree(const math::expression<VariableType>& expr) {
-                    return boost::apply_visitor(*this, expr.get_expr());
+                    return expr.get_degree();
                 }
 
                 std::uint32_t operator()(const math::term<VariableType>& term) {
-                    return term.get_vars().size();
+                    return term.get_degree();
                 }
 
                 std::uint32_t operator()(
                         const math::pow_operation<VariableType>& pow) {
-                    std::uint32_t result = boost::apply_visitor(*this, pow.get_expr().get_expr());
-                    return result * pow.get_power();
+                    return pow.get_degree();
                 }
 
                 std::uint32_t operator()(
                         const math::binary_arithmetic_operation<VariableType>& op) {
-                    std::uint32_t left = boost::apply_visitor(*this, op.get_expr_left().get_expr());
-                    std::uint32_t right = boost::apply_visitor(*this, op.get_expr_right().get_expr());
-                    switch (op.get_op()) {
-                        case ArithmeticOperator::ADD:
-                        case ArithmeticOperator::SUB:
-                            return std::max(left, right);
-                        case ArithmeticOperator::MULT:
-                            return left + right;
-                        default:
-                            throw std::invalid_argument("ArithmeticOperator not found");
-                    }
+                    return op.get_degree();
                 }
             };
 
@@ -103,6 +96,43 @@ namespace nil {
                     std::function<void(const VariableType&)> callback;
             };
 
+            // Computes the degree of an expression over polynomials from the degrees of its variables,
+            // the way polynomial products count it: products add degrees, sums take the maximum.
+            // Coefficients count as constants.
+            template<typename VariableType>
+            class expression_polynomial_degree_visitor : public boost::static_visitor<std::size_t> {
+            public:
+                expression_polynomial_degree_visitor(
+                        std::function<std::size_t(const VariableType&)> get_degree)
+                    : get_degree(get_degree) {}
+
+                std::size_t compute_degree(const math::expression<VariableType>& expr) {
+                    return boost::apply_visitor(*this, expr.get_expr());
+                }
+
+                std::size_t operator()(const math::term<VariableType>& term) {
+                    std::size_t degree = 0;
+                    for (const auto& var: term.get_vars()) {
+                        degree += get_degree(var);
+                    }
+                    return degree;
+                }
+
+                std::size_t operator()(
+                        const math::pow_operation<VariableType>& pow) {
+                    return boost::apply_visitor(*this, pow.get_expr().get_expr()) * pow.get_power();
+                }
+
+                std::size_t operator()(const math::binary_arithmetic_operation<VariableType>& op) {
+                    std::size_t left = boost::apply_visitor(*this, op.get_expr_left().get_expr());
+                    std::size_t right = boost::apply_visitor(*this, op.get_expr_right().get_expr());
+                    return op.get_op() == ArithmeticOperator::MULT ? left + right : std::max(left, right);
+                }
+
+                private:
+                    std::function<std::size_t(const VariableType&)> get_degree;
+            };
+
             // Converts tree-structured expression to flat one, a vector of terms.
             // Used for generating solidity code for constraints, because we want
             // to use minimal number of variables in the stack.
@@ -162,6 +192,8 @@ namespace nil {
             // but we need a constraint of variable type
             // plonk_variable<math::polynomial_dfs<typename FieldType::value_type>>.
             // You can convert between types if the coefficient types are convertable.
+            // Results are memoized by subexpression, so every distinct subexpression is converted once
+            // per converter, and the converted expressions share nodes the same way the source ones do.
             template<typename SourceVariableType, typename DestinationVariableType>
             class expression_variable_type_converter
                 : public boost::static_visitor<math::expression<DestinationVariableType>> {
@@ -179,7 +211,18 @@ namespace nil {
 
                 math::expression<DestinationVariableType> convert(
                         const math::expression<SourceVariableType>& expr) {
-                    return boost::apply_visitor(*this, expr.get_expr());
+                    auto it = _converted.find(expr);
+                    if (it != _converted.end()) {
+                        return it->second;
+                    }
+                    math::expression<DestinationVariableType> result = boost::apply_visitor(*this, expr.get_expr());
+                    _converted.emplace(expr, result);
+                    return result;
+                }
+
+                // Number of distinct subexpressions converted so far.
+                std::size_t converted_count() const {
+                    return _converted.size();
                 }
 
                 math::expression<DestinationVariableType> operator()(
@@ -195,17 +238,14 @@ namespace nil {
 
                 math::expression<DestinationVariableType> operator()(
                         const math::pow_operation<SourceVariableType>& pow) {
-                    math::expression<DestinationVariableType> base = boost::apply_visitor(
-                        *this, pow.get_expr().get_expr());
+                    math::expression<DestinationVariableType> base = convert(pow.get_expr());
                     return math::pow_operation<DestinationVariableType>(base, pow.get_power());
                 }
 
                 math::expression<DestinationVariableType> operator()(
                         const math::binary_arithmetic_operation<SourceVariableType>& op) {
-                    math::expression<DestinationVariableType> left =
-                        boost::apply_visitor(*this, op.get_expr_left().get_expr());
-                    math::expression<DestinationVariableType> right =
-                        boost::apply_visitor(*this, op.get_expr_right().get_expr());
+                    math::expression<DestinationVariableType> left = convert(op.get_expr_left());
+                    math::expression<DestinationVariableType> right = convert(op.get_expr_right());
                     switch (op.get_op()) {
                         case ArithmeticOperator::ADD:
                             return left + right;
@@ -221,6 +261,9 @@ namespace nil {
                 std::function<typename DestinationVariableType::assignment_type(
                     const typename SourceVariableType::assignment_type&)> _convert_coefficient;
 
+                std::unordered_map<math::expression<SourceVariableType>,
+                                   math::expression<DestinationVariableType>> _converted;
+
             };
 
         }    // namespace math
@@ -0,0 +1,227 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+// @file Declaration of a multi-exponentiation over a fixed set of bases with
+// precomputed per-base window shifts.
+//
+// For every base P_i and window size c the table stores 2^{c*j} * P_i for every
+// window j. A multi-exponentiation sum_i s_i * P_i then becomes a single bucket
+// pass over all (base, window) pairs: digit d of window j of s_i adds 2^{c*j} * P_i
+// to bucket d. Compared to the Pippenger method this removes the per-window bucket
+// aggregation and the doublings between windows, at the cost of
+// ceil(scalar_bits / c) points of memory per base.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ZK_MATH_FIXED_BASE_MULTIEXP_HPP
+#define CRYPTO3_ZK_MATH_FIXED_BASE_MULTIEXP_HPP
+
+#include <cstdint>
+#include <future>
+#include <iterator>
+#include <vector>
+
+#include <boost/assert.hpp>
+
+#include <nil/crypto3/multiprecision/number.hpp>
+
+#include <nil/actor/core/thread_pool.hpp>
+#include <nil/actor/core/parallelization_utils.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace math {
+
+            /**
+             * Precomputed window shifts of a fixed vector of bases.
+             *
+             * GroupValueType is any additive group element with zero(), is_zero(), doubled()
+             * and operator+, e.g. curve points or knowledge commitment elements. Scalars are
+             * elements of ScalarFieldType.
+             */
+            template<typename GroupValueType, typename ScalarFieldType>
+            class fixed_base_multiexp_table {
+            public:
+                typedef GroupValueType value_type;
+                typedef ScalarFieldType scalar_field_type;
+
+                constexpr static const std::size_t scalar_bits = ScalarFieldType::modulus_bits;
+
+                /* Every worker keeps 2^c buckets, wider windows would dominate the table memory. */
+                constexpr static const std::size_t max_window_bits = 16;
+
+                fixed_base_multiexp_table() : _window_bits(0), _windows(0), _bases_count(0) {
+                }
+
+                template<typename InputIterator>
+                fixed_base_multiexp_table(InputIterator bases_begin, InputIterator bases_end,
+                                          std::size_t window_bits) :
+                    _window_bits(window_bits),
+                    _windows((scalar_bits + window_bits - 1) / window_bits),
+                    _bases_count(std::distance(bases_begin, bases_end)) {
+                    BOOST_ASSERT(window_bits > 0 && window_bits <= max_window_bits);
+
+                    _shifted_bases.resize(_bases_count * _windows);
+                    parallel_for(0, _bases_count, [this, &bases_begin](std::size_t i) {
+                        value_type shifted = *(bases_begin + i);
+                        for (std::size_t j = 0; j < _windows; ++j) {
+                            _shifted_bases[i * _windows + j] = shifted;
+                            for (std::size_t k = 0; k < _window_bits; ++k) {
+                                shifted = shifted.doubled();
+                            }
+                        }
+                    });
+                }
+
+                /**
+                 * Number of window bits giving the cheapest multi-exponentiation whose table for
+                 * bases_count bases fits into memory_limit bytes. Returns 0 if no table fits.
+                 */
+                static std::size_t window_bits_for_budget(std::size_t bases_count, std::size_t memory_limit) {
+                    if (bases_count == 0) {
+                        return 0;
+                    }
+
+                    /* Smallest window that keeps the table within the memory limit. */
+                    std::size_t min_window_bits = 1;
+                    while (min_window_bits <= max_window_bits &&
+                           table_size_in_bytes(bases_count, min_window_bits) > memory_limit) {
+                        ++min_window_bits;
+                    }
+                    if (min_window_bits > max_window_bits) {
+                        return 0;
+                    }
+
+                    /* Balance bucket additions (bases_count * windows) against bucket reduction (2 * 2^c). */
+                    std::size_t best_window_bits = min_window_bits;
+                    std::size_t best_cost = cost(bases_count, min_window_bits);
+                    for (std::size_t c = min_window_bits + 1; c <= max_window_bits; ++c) {
+                        std::size_t c_cost = cost(bases_count, c);
+                        if (c_cost < best_cost) {
+                            best_cost = c_cost;
+                            best_window_bits = c;
+                        }
+                    }
+                    return best_window_bits;
+                }
+
+                static std::size_t table_size_in_bytes(std::size_t bases_count, std::size_t window_bits) {
+                    return bases_count * ((scalar_bits + window_bits - 1) / window_bits) * sizeof(value_type);
+                }
+
+                std::size_t size_in_bytes() const {
+                    return _shifted_bases.size() * sizeof(value_type);
+                }
+
+                std::size_t bases_count() const {
+                    return _bases_count;
+                }
+
+                std::size_t window_bits() const {
+                    return _window_bits;
+                }
+
+                bool empty() const {
+                    return _bases_count == 0;
+                }
+
+                /**
+                 * Computes sum_i scalar_i * base_{first_base + i} over the scalars in [scalar_start, scalar_end).
+                 * Zero scalars are skipped and unit scalars are added directly, without touching the buckets.
+                 */
+                template<typename InputFieldIterator>
+                value_type evaluate(InputFieldIterator scalar_start, InputFieldIterator scalar_end,
+                                    std::size_t first_base = 0) const {
+                    typedef typename ScalarFieldType::value_type field_value_type;
+                    typedef typename ScalarFieldType::integral_type integral_type;
+
+                    const std::size_t scalars_count = std::distance(scalar_start, scalar_end);
+                    BOOST_ASSERT(first_base + scalars_count <= _bases_count);
+
+                    const std::size_t buckets_count = std::size_t(1) << _window_bits;
+
+                    std::vector<std::future<value_type>> partial_sums = parallel_run_in_chunks<value_type>(
+                        scalars_count,
+                        [this, &scalar_start, first_base, buckets_count](std::size_t begin, std::size_t end) {
+                            std::vector<value_type> buckets(buckets_count, value_type::zero());
+                            value_type acc = value_type::zero();
+
+                            for (std::size_t i = begin; i < end; ++i) {
+                                const field_value_type &scalar = *(scalar_start + i);
+                                const value_type *shifted = &_shifted_bases[(first_base + i) * _windows];
+
+                                if (scalar.is_zero()) {
+                                    continue;
+                                }
+                                if (scalar == field_value_type::one()) {
+                                    acc = acc + shifted[0];
+                                    continue;
+                                }
+
+                                const integral_type scalar_integral = integral_type(scalar.data);
+                                for (std::size_t j = 0; j < _windows; ++j) {
+                                    std::size_t digit = 0;
+                                    for (std::size_t k = 0; k < _window_bits; ++k) {
+                                        if (multiprecision::bit_test(scalar_integral, j * _window_bits + k)) {
+                                            digit |= std::size_t(1) << k;
+                                        }
+                                    }
+                                    if (digit != 0) {
+                                        buckets[digit] = buckets[digit] + shifted[j];
+                                    }
+                                }
+                            }
+
+                            /* sum_d d * buckets[d] via running sums */
+                            value_type running_sum = value_type::zero();
+                            value_type result = value_type::zero();
+                            for (std::size_t d = buckets_count - 1; d > 0; --d) {
+                                running_sum = running_sum + buckets[d];
+                                result = result + running_sum;
+                            }
+
+                            return result + acc;
+                        });
+
+                    value_type result = value_type::zero();
+                    for (auto &partial_sum : partial_sums) {
+                        result = result + partial_sum.get();
+                    }
+                    return result;
+                }
+
+            private:
+                static std::size_t cost(std::size_t bases_count, std::size_t window_bits) {
+                    return bases_count * ((scalar_bits + window_bits - 1) / window_bits) +
+                           (std::size_t(2) << window_bits);
+                }
+
+                std::size_t _window_bits;
+                std::size_t _windows;
+                std::size_t _bases_count;
+                std::vector<value_type> _shifted_bases;
+            };
+        }    // namespace math
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ZK_MATH_FIXED_BASE_MULTIEXP_HPP
@@ -0,0 +1,129 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+// @file Declaration of products of many polynomials in the point-value form and of
+// batched field inversion.
+//
+// A product of k polynomials of degree d has degree k * d. Multiplying them one by one
+// extends the running product to ever larger domains, k times. A balanced product tree
+// multiplies pairs of similar degree instead: level l holds k / 2^l polynomials of
+// degree 2^l * d, so every level touches the same amount of memory and there are only
+// log(k) of them. Multiplications within a level are independent and run in parallel.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ZK_MATH_POLYNOMIAL_DFS_PRODUCT_HPP
+#define CRYPTO3_ZK_MATH_POLYNOMIAL_DFS_PRODUCT_HPP
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+#include <boost/assert.hpp>
+
+#include <nil/crypto3/math/polynomial/polynomial_dfs.hpp>
+
+#include <nil/actor/core/thread_pool.hpp>
+#include <nil/actor/core/parallelization_utils.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace math {
+
+            /**
+             * Replaces every element of [first, last) by its inverse with a single field inversion.
+             * All elements must be non-zero.
+             */
+            template<typename Iterator>
+            void batch_inverse(Iterator first, Iterator last) {
+                typedef typename std::iterator_traits<Iterator>::value_type value_type;
+
+                std::size_t size = std::distance(first, last);
+                if (size == 0) {
+                    return;
+                }
+
+                std::vector<value_type> prefix_products(size);
+                value_type acc = value_type::one();
+                Iterator it = first;
+                for (std::size_t i = 0; i < size; ++i, ++it) {
+                    prefix_products[i] = acc;
+                    acc *= *it;
+                }
+
+                BOOST_ASSERT(!acc.is_zero());
+                acc = acc.inversed();
+                for (std::size_t i = size; i-- > 0;) {
+                    --it;
+                    value_type inverse = acc * prefix_products[i];
+                    acc *= *it;
+                    *it = inverse;
+                }
+            }
+
+            /**
+             * batch_inverse over contiguous chunks of values in parallel, one field inversion per chunk.
+             */
+            template<typename ValueType>
+            void parallel_batch_inverse(std::vector<ValueType> &values) {
+                wait_for_all(parallel_run_in_chunks<void>(
+                    values.size(), [&values](std::size_t begin, std::size_t end) {
+                        batch_inverse(values.begin() + begin, values.begin() + end);
+                    }));
+            }
+
+            /**
+             * Product of the given polynomials through a balanced product tree. The i-th factor is
+             * paired with the i-th from the end, which keeps the degrees of every level close when
+             * the factors have similar degrees. The result is resized to target_size, if given and
+             * larger than the domain of the product.
+             */
+            template<typename FieldType>
+            polynomial_dfs<typename FieldType::value_type> polynomial_product_tree(
+                    std::vector<polynomial_dfs<typename FieldType::value_type>> factors,
+                    std::size_t target_size = 0) {
+                typedef polynomial_dfs<typename FieldType::value_type> polynomial_type;
+
+                if (factors.empty()) {
+                    return polynomial_type(0, std::max<std::size_t>(target_size, 1), FieldType::value_type::one());
+                }
+
+                while (factors.size() > 1) {
+                    std::size_t pairs = factors.size() / 2;
+                    std::size_t last = factors.size() - 1;
+                    parallel_for(0, pairs, [&factors, last](std::size_t i) {
+                        factors[i] *= factors[last - i];
+                    }, ThreadPool::PoolLevel::HIGH);
+                    factors.erase(factors.end() - pairs, factors.end());
+                }
+
+                polynomial_type result = std::move(factors[0]);
+                if (target_size > result.size()) {
+                    result.resize(target_size);
+                }
+                return result;
+            }
+        }    // namespace math
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ZK_MATH_POLYNOMIAL_DFS_PRODUCT_HPP
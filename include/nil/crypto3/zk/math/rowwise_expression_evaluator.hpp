@@ -0,0 +1,300 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+// @file Declaration of a point-wise evaluator of expressions over polynomials in the
+// point-value form.
+//
+// expression_evaluator computes every node of the tree as a whole polynomial, so each
+// variable needs its own polynomial_dfs, including rotated copies of the same column.
+// When all variables are already evaluated on one domain and the expression fits in it,
+// the result can be computed row by row instead: the tree is flattened once into a
+// postfix program, rotated variables read the unrotated evaluations at an offset through
+// shifted_polynomial_dfs_view, and rows are evaluated in parallel chunks with a small
+// per-chunk stack. No intermediate polynomial is allocated.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ZK_MATH_ROWWISE_EXPRESSION_EVALUATOR_HPP
+#define CRYPTO3_ZK_MATH_ROWWISE_EXPRESSION_EVALUATOR_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <boost/assert.hpp>
+#include <boost/variant/static_visitor.hpp>
+#include <boost/variant/apply_visitor.hpp>
+
+#include <nil/crypto3/math/polynomial/polynomial_dfs.hpp>
+
+#include <nil/crypto3/zk/math/expression.hpp>
+#include <nil/crypto3/zk/math/expression_evaluator.hpp>
+#include <nil/crypto3/zk/math/shifted_polynomial_dfs.hpp>
+
+#include <nil/actor/core/thread_pool.hpp>
+#include <nil/actor/core/parallelization_utils.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace math {
+
+            /**
+             * Evaluates an expression whose variables are polynomials in the point-value form, all on the
+             * same domain of the given size. Term coefficients must be constant polynomials. The degree of
+             * the expression, counted in the degrees of the variable polynomials, must be below the size of
+             * the domain, i.e. the domain must be large enough to hold the result.
+             */
+            template<typename VariableType>
+            class rowwise_expression_evaluator : public boost::static_visitor<void> {
+            public:
+                typedef typename VariableType::assignment_type polynomial_type;
+                typedef typename polynomial_type::value_type value_type;
+                typedef shifted_polynomial_dfs_view<value_type> column_type;
+
+                /*
+                 * @param expr - the expression that will be evaluated.
+                 * @param size - size of the domain every variable is evaluated on.
+                 * @param get_column - returns the evaluations of a variable, rotation included.
+                 */
+                rowwise_expression_evaluator(const expression<VariableType> &expr, std::size_t size,
+                                             std::function<column_type(const VariableType &)> get_column) :
+                    _size(size), _get_column(get_column), _degree(0), _depth(0), _max_stack_depth(0),
+                    _cache_size(0) {
+                    subexpression_counter<VariableType> counter(expr);
+                    _counts = counter.count();
+
+                    boost::apply_visitor(*this, expr.get_expr());
+                    BOOST_ASSERT(_depth == 1 && _degrees.size() == 1);
+                    _degree = _degrees.back();
+                    BOOST_ASSERT(_degree < _size);
+
+                    _counts.clear();
+                    _slots.clear();
+                    _variables.clear();
+                }
+
+                polynomial_type evaluate() const {
+                    polynomial_type result(_degree, _size, value_type::zero());
+                    wait_for_all(parallel_run_in_chunks<void>(
+                        _size, [this, &result](std::size_t begin, std::size_t end) {
+                            std::vector<value_type> stack(_max_stack_depth);
+                            std::vector<value_type> cache(_cache_size);
+                            for (std::size_t row = begin; row < end; ++row) {
+                                result[row] = evaluate_row(row, stack.data(), cache.data());
+                            }
+                        }));
+                    return result;
+                }
+
+                std::size_t degree() const {
+                    return _degree;
+                }
+
+                // Scratch sizes of evaluate_row, in values.
+                std::size_t max_stack_depth() const {
+                    return _max_stack_depth;
+                }
+
+                std::size_t cache_size() const {
+                    return _cache_size;
+                }
+
+                /**
+                 * Value of the expression at one row, for callers evaluating several expressions in one pass
+                 * over the rows. stack and cache hold at least max_stack_depth() and cache_size() values.
+                 */
+                value_type evaluate_row(std::size_t row, value_type *stack, value_type *cache) const {
+                    std::size_t top = 0;
+                    for (const auto &instr : _instructions) {
+                        switch (instr.op) {
+                            case opcode::constant:
+                                stack[top++] = _constants[instr.operand];
+                                break;
+                            case opcode::variable:
+                                stack[top++] = _columns[instr.operand][row];
+                                break;
+                            case opcode::add:
+                                --top;
+                                stack[top - 1] += stack[top];
+                                break;
+                            case opcode::sub:
+                                --top;
+                                stack[top - 1] -= stack[top];
+                                break;
+                            case opcode::mul:
+                                --top;
+                                stack[top - 1] *= stack[top];
+                                break;
+                            case opcode::pow:
+                                stack[top - 1] = stack[top - 1].pow(instr.operand);
+                                break;
+                            case opcode::store:
+                                cache[instr.operand] = stack[top - 1];
+                                break;
+                            case opcode::load:
+                                stack[top++] = cache[instr.operand];
+                                break;
+                        }
+                    }
+                    return stack[0];
+                }
+
+                void operator()(const term<VariableType> &t) {
+                    if (t.get_vars().empty()) {
+                        push_constant(constant_value(t.get_coeff()));
+                        return;
+                    }
+                    if (load_cached(t)) {
+                        return;
+                    }
+
+                    const value_type coeff = constant_value(t.get_coeff());
+                    bool first = coeff == value_type::one();
+                    if (!first) {
+                        push_constant(coeff);
+                    }
+                    for (const VariableType &var : t.get_vars()) {
+                        push_variable(var);
+                        if (!first) {
+                            emit_binary(opcode::mul);
+                        }
+                        first = false;
+                    }
+                    store_cached(t);
+                }
+
+                void operator()(const pow_operation<VariableType> &pow) {
+                    if (load_cached(pow)) {
+                        return;
+                    }
+                    boost::apply_visitor(*this, pow.get_expr().get_expr());
+                    BOOST_ASSERT(pow.get_power() >= 0);
+                    _instructions.push_back({opcode::pow, static_cast<std::size_t>(pow.get_power())});
+                    _degrees.back() *= pow.get_power();
+                    store_cached(pow);
+                }
+
+                void operator()(const binary_arithmetic_operation<VariableType> &op) {
+                    if (load_cached(op)) {
+                        return;
+                    }
+                    boost::apply_visitor(*this, op.get_expr_left().get_expr());
+                    boost::apply_visitor(*this, op.get_expr_right().get_expr());
+                    switch (op.get_op()) {
+                        case ArithmeticOperator::ADD:
+                            emit_binary(opcode::add);
+                            break;
+                        case ArithmeticOperator::SUB:
+                            emit_binary(opcode::sub);
+                            break;
+                        case ArithmeticOperator::MULT:
+                            emit_binary(opcode::mul);
+                            break;
+                    }
+                    store_cached(op);
+                }
+
+            private:
+                enum class opcode : std::uint8_t { constant, variable, add, sub, mul, pow, store, load };
+
+                struct instruction {
+                    opcode op;
+                    std::size_t operand;
+                };
+
+                static value_type constant_value(const polynomial_type &coeff) {
+                    BOOST_ASSERT_MSG(coeff.degree() == 0, "term coefficients must be constant polynomials");
+                    return coeff[0];
+                }
+
+                void push(opcode op, std::size_t operand, std::size_t degree) {
+                    _instructions.push_back({op, operand});
+                    _degrees.push_back(degree);
+                    _max_stack_depth = std::max(_max_stack_depth, ++_depth);
+                }
+
+                void push_constant(const value_type &value) {
+                    push(opcode::constant, _constants.size(), 0);
+                    _constants.push_back(value);
+                }
+
+                void push_variable(const VariableType &var) {
+                    auto it = _variables.find(var);
+                    if (it == _variables.end()) {
+                        _columns.push_back(_get_column(var));
+                        BOOST_ASSERT(_columns.back().size() == _size);
+                        it = _variables.emplace(var, _columns.size() - 1).first;
+                    }
+                    push(opcode::variable, it->second, _columns[it->second].degree());
+                }
+
+                void emit_binary(opcode op) {
+                    _instructions.push_back({op, 0});
+                    std::size_t right = _degrees.back();
+                    _degrees.pop_back();
+                    _degrees.back() = op == opcode::mul ? _degrees.back() + right : std::max(_degrees.back(), right);
+                    --_depth;
+                }
+
+                // Subexpressions met more than once are computed once, stored, and loaded afterwards.
+                bool load_cached(const expression<VariableType> &expr) {
+                    auto it = _slots.find(expr);
+                    if (it == _slots.end()) {
+                        return false;
+                    }
+                    push(opcode::load, it->second.first, it->second.second);
+                    return true;
+                }
+
+                void store_cached(const expression<VariableType> &expr) {
+                    auto it = _counts.find(expr);
+                    if (it != _counts.end() && it->second > 1) {
+                        _instructions.push_back({opcode::store, _cache_size});
+                        _slots.emplace(expr, std::make_pair(_cache_size++, _degrees.back()));
+                    }
+                }
+
+                std::size_t _size;
+                std::function<column_type(const VariableType &)> _get_column;
+
+                std::vector<instruction> _instructions;
+                std::vector<value_type> _constants;
+                std::vector<column_type> _columns;
+                std::size_t _degree;
+
+                // Compilation state only.
+                std::vector<std::size_t> _degrees;
+                std::size_t _depth;
+                std::size_t _max_stack_depth;
+                std::size_t _cache_size;
+                std::unordered_map<VariableType, std::size_t> _variables;
+                std::unordered_map<expression<VariableType>, std::size_t> _counts;
+                std::unordered_map<expression<VariableType>, std::pair<std::size_t, std::size_t>> _slots;
+            };
+        }    // namespace math
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ZK_MATH_ROWWISE_EXPRESSION_EVALUATOR_HPP
@@ -0,0 +1,107 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+// @file Declaration of rotated (shifted) views of polynomials in the point-value form.
+//
+// math::polynomial_shift(f, r, n) evaluates f(omega^r * x) on the basic domain of size n.
+// If f is evaluated on a k times larger domain with generator omega_N, omega = omega_N^k,
+// so the same rotation is an index shift by r * k of the extended evaluations. The view
+// below reads the unshifted evaluations at that offset instead of extending a shifted copy.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ZK_MATH_SHIFTED_POLYNOMIAL_DFS_HPP
+#define CRYPTO3_ZK_MATH_SHIFTED_POLYNOMIAL_DFS_HPP
+
+#include <algorithm>
+#include <cstddef>
+
+#include <boost/assert.hpp>
+
+#include <nil/crypto3/math/polynomial/polynomial_dfs.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace math {
+
+            /**
+             * f(omega^shift * x) over the evaluation domain of f, for omega the generator of the
+             * basic domain of size domain_size. Does not own memory.
+             */
+            template<typename FieldValueType>
+            class shifted_polynomial_dfs_view {
+            public:
+                typedef FieldValueType value_type;
+                typedef polynomial_dfs<FieldValueType> polynomial_type;
+
+                shifted_polynomial_dfs_view(const polynomial_type &f, int shift, std::size_t domain_size) :
+                    _f(f), _offset(0) {
+                    BOOST_ASSERT(domain_size > 0 && f.size() % domain_size == 0);
+
+                    const long long size = f.size();
+                    const long long offset =
+                        (static_cast<long long>(shift) * static_cast<long long>(f.size() / domain_size)) % size;
+                    _offset = static_cast<std::size_t>(offset < 0 ? offset + size : offset);
+                }
+
+                std::size_t size() const {
+                    return _f.size();
+                }
+
+                std::size_t degree() const {
+                    return _f.degree();
+                }
+
+                const FieldValueType &operator[](std::size_t index) const {
+                    std::size_t i = index + _offset;
+                    return _f[i < _f.size() ? i : i - _f.size()];
+                }
+
+                /**
+                 * Copies the rotated evaluations out, which costs one pass over the values instead
+                 * of the interpolation and evaluation a shift before extension would need.
+                 */
+                polynomial_type materialize() const {
+                    polynomial_type result(_f.degree(), _f.size(), FieldValueType::zero());
+                    std::rotate_copy(_f.begin(), _f.begin() + _offset, _f.end(), result.begin());
+                    return result;
+                }
+
+            private:
+                const polynomial_type &_f;
+                std::size_t _offset;
+            };
+
+            /**
+             * Same result as polynomial_shift(f, shift, domain_size), but also valid when f is already
+             * evaluated on an extension of the basic domain.
+             */
+            template<typename FieldValueType>
+            polynomial_dfs<FieldValueType> extended_polynomial_shift(const polynomial_dfs<FieldValueType> &f,
+                                                                     int shift, std::size_t domain_size) {
+                return shifted_polynomial_dfs_view<FieldValueType>(f, shift, domain_size).materialize();
+            }
+        }    // namespace math
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ZK_MATH_SHIFTED_POLYNOMIAL_DFS_HPP
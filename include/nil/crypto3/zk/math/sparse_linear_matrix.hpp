@@ -0,0 +1,155 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+// @file Declaration of a sparse matrix of linear combinations stored in the
+// compressed sparse row (CSR) layout.
+//
+// Row k of the matrix holds the linear combination sum_i coeff_{k,i} * x_{index_{k,i}}.
+// All rows share three flat arrays, so a matrix-vector product walks memory
+// sequentially instead of chasing one heap allocation per linear combination.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ZK_MATH_SPARSE_LINEAR_MATRIX_HPP
+#define CRYPTO3_ZK_MATH_SPARSE_LINEAR_MATRIX_HPP
+
+#include <algorithm>
+#include <vector>
+
+#include <boost/assert.hpp>
+
+#include <nil/crypto3/zk/math/linear_combination.hpp>
+
+#include <nil/actor/core/thread_pool.hpp>
+#include <nil/actor/core/parallelization_utils.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace math {
+
+            /**
+             * A sparse matrix of linear combinations in CSR layout.
+             *
+             * Column indices follow the linear_term convention: column 0 is the constant 1,
+             * column i > 0 is the variable x_i. Products are therefore taken against an
+             * "extended" assignment z = (1, x_1, ..., x_m), see make_extended_assignment.
+             */
+            template<typename FieldType>
+            class sparse_linear_matrix {
+            public:
+                typedef FieldType field_type;
+                typedef typename FieldType::value_type value_type;
+
+                // row_offsets[k] .. row_offsets[k + 1] is the range of row k in columns / coefficients.
+                std::vector<std::size_t> row_offsets;
+                std::vector<std::size_t> columns;
+                std::vector<value_type> coefficients;
+
+                sparse_linear_matrix() : row_offsets(1, 0) {
+                }
+
+                std::size_t rows() const {
+                    return row_offsets.size() - 1;
+                }
+
+                std::size_t non_zeros() const {
+                    return columns.size();
+                }
+
+                void reserve(std::size_t rows_count, std::size_t non_zeros_count) {
+                    row_offsets.reserve(rows_count + 1);
+                    columns.reserve(non_zeros_count);
+                    coefficients.reserve(non_zeros_count);
+                }
+
+                template<typename VariableType>
+                void push_back(const linear_combination<VariableType> &lc) {
+                    for (const linear_term<VariableType> &lt : lc.terms) {
+                        columns.push_back(lt.index);
+                        coefficients.push_back(lt.coeff);
+                    }
+                    row_offsets.push_back(columns.size());
+                }
+
+                /**
+                 * Evaluates row k at the extended assignment z.
+                 */
+                value_type row_product(std::size_t k, const std::vector<value_type> &z) const {
+                    value_type acc = value_type::zero();
+                    for (std::size_t i = row_offsets[k]; i < row_offsets[k + 1]; ++i) {
+                        acc += z[columns[i]] * coefficients[i];
+                    }
+                    return acc;
+                }
+
+                /**
+                 * Computes result[offset + k] += row_k(z) for every row k. Rows are split into
+                 * contiguous blocks which are processed in parallel.
+                 */
+                void multiply_add(const std::vector<value_type> &z,
+                                  std::vector<value_type> &result,
+                                  std::size_t offset = 0) const {
+                    BOOST_ASSERT(result.size() >= offset + rows());
+
+                    wait_for_all(parallel_run_in_chunks<void>(
+                        rows(),
+                        [this, &z, &result, offset](std::size_t begin, std::size_t end) {
+                            for (std::size_t k = begin; k < end; ++k) {
+                                result[offset + k] += row_product(k, z);
+                            }
+                        }));
+                }
+
+                /**
+                 * Returns the vector (row_0(z), ..., row_{n-1}(z)) padded with zeros up to size.
+                 */
+                std::vector<value_type> multiply(const std::vector<value_type> &z, std::size_t size = 0) const {
+                    std::vector<value_type> result(std::max(size, rows()), value_type::zero());
+                    multiply_add(z, result);
+                    return result;
+                }
+
+                bool operator==(const sparse_linear_matrix &other) const {
+                    return row_offsets == other.row_offsets && columns == other.columns &&
+                           coefficients == other.coefficients;
+                }
+            };
+
+            /**
+             * Prepends the constant 1 to a variable assignment, so that linear_term indices
+             * can be used to address it directly.
+             */
+            template<typename ValueType>
+            std::vector<ValueType> make_extended_assignment(const std::vector<ValueType> &primary_input,
+                                                            const std::vector<ValueType> &auxiliary_input) {
+                std::vector<ValueType> z;
+                z.reserve(1 + primary_input.size() + auxiliary_input.size());
+                z.push_back(ValueType::one());
+                z.insert(z.end(), primary_input.begin(), primary_input.end());
+                z.insert(z.end(), auxiliary_input.begin(), auxiliary_input.end());
+                return z;
+            }
+        }    // namespace math
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ZK_MATH_SPARSE_LINEAR_MATRIX_HPP
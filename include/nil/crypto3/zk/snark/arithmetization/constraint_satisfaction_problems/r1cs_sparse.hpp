@@ -0,0 +1,148 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+// @file Declaration of interfaces for a R1CS constraint system stored as three
+// sparse matrices A, B, C in the CSR layout.
+//
+// The sparse form is built once from a r1cs_constraint_system and is meant for
+// the hot paths (satisfiability check, witness maps), which become parallel
+// sparse matrix-vector products A*z, B*z and C*z.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ZK_R1CS_SPARSE_CONSTRAINT_SYSTEM_HPP
+#define CRYPTO3_ZK_R1CS_SPARSE_CONSTRAINT_SYSTEM_HPP
+
+#include <atomic>
+#include <cstdlib>
+#include <vector>
+
+#include <nil/crypto3/zk/math/sparse_linear_matrix.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/constraint_satisfaction_problems/r1cs.hpp>
+
+#include <nil/actor/core/thread_pool.hpp>
+#include <nil/actor/core/parallelization_utils.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace zk {
+            namespace snark {
+
+                /**
+                 * A R1CS constraint system
+                 *
+                 *     { < A_k , X > * < B_k , X > = < C_k , X > }_{k=1}^{n}
+                 *
+                 * where the rows A_k, B_k, C_k are stored as CSR matrices A, B, C.
+                 *
+                 * As in r1cs_constraint_system, the 0-th variable represents the constant 1
+                 * and is not included in num_variables.
+                 */
+                template<typename FieldType>
+                struct r1cs_sparse_constraint_system {
+                    typedef FieldType field_type;
+                    typedef math::sparse_linear_matrix<FieldType> matrix_type;
+
+                    std::size_t primary_input_size;
+                    std::size_t auxiliary_input_size;
+
+                    matrix_type a, b, c;
+
+                    r1cs_sparse_constraint_system() : primary_input_size(0), auxiliary_input_size(0) {
+                    }
+
+                    explicit r1cs_sparse_constraint_system(const r1cs_constraint_system<FieldType> &cs) :
+                        primary_input_size(cs.primary_input_size), auxiliary_input_size(cs.auxiliary_input_size) {
+
+                        std::size_t a_size = 0, b_size = 0, c_size = 0;
+                        for (const r1cs_constraint<FieldType> &constraint : cs.constraints) {
+                            a_size += constraint.a.terms.size();
+                            b_size += constraint.b.terms.size();
+                            c_size += constraint.c.terms.size();
+                        }
+                        a.reserve(cs.num_constraints(), a_size);
+                        b.reserve(cs.num_constraints(), b_size);
+                        c.reserve(cs.num_constraints(), c_size);
+
+                        for (const r1cs_constraint<FieldType> &constraint : cs.constraints) {
+                            a.push_back(constraint.a);
+                            b.push_back(constraint.b);
+                            c.push_back(constraint.c);
+                        }
+                    }
+
+                    std::size_t num_inputs() const {
+                        return primary_input_size;
+                    }
+
+                    std::size_t num_variables() const {
+                        return primary_input_size + auxiliary_input_size;
+                    }
+
+                    std::size_t num_constraints() const {
+                        return a.rows();
+                    }
+
+                    bool is_satisfied(const r1cs_primary_input<FieldType> &primary_input,
+                                      const r1cs_auxiliary_input<FieldType> &auxiliary_input) const {
+                        assert(primary_input.size() == num_inputs());
+                        assert(primary_input.size() + auxiliary_input.size() == num_variables());
+
+                        const std::vector<typename FieldType::value_type> z =
+                            math::make_extended_assignment(primary_input, auxiliary_input);
+
+                        std::atomic<bool> satisfied = true;
+                        wait_for_all(parallel_run_in_chunks<void>(
+                            num_constraints(),
+                            [this, &z, &satisfied](std::size_t begin, std::size_t end) {
+                                for (std::size_t k = begin; k < end && satisfied; ++k) {
+                                    if (a.row_product(k, z) * b.row_product(k, z) != c.row_product(k, z)) {
+                                        satisfied = false;
+                                    }
+                                }
+                            }));
+
+                        return satisfied;
+                    }
+
+                    bool operator==(const r1cs_sparse_constraint_system<FieldType> &other) const {
+                        return (this->a == other.a && this->b == other.b && this->c == other.c &&
+                                this->primary_input_size == other.primary_input_size &&
+                                this->auxiliary_input_size == other.auxiliary_input_size);
+                    }
+                };
+
+                /**
+                 * Converts a R1CS constraint system into its sparse CSR form.
+                 */
+                template<typename FieldType>
+                r1cs_sparse_constraint_system<FieldType>
+                    make_r1cs_sparse_constraint_system(const r1cs_constraint_system<FieldType> &cs) {
+                    return r1cs_sparse_constraint_system<FieldType>(cs);
+                }
+
+            }    // namespace snark
+        }        // namespace zk
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ZK_R1CS_SPARSE_CONSTRAINT_SYSTEM_HPP
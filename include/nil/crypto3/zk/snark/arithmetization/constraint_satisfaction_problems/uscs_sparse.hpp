@@ -0,0 +1,137 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+// @file Declaration of interfaces for a USCS constraint system stored as a
+// sparse matrix V in the CSR layout.
+//
+// The sparse form is built once from a uscs_constraint_system and is meant for
+// the satisfiability check and the USCS-to-SSP witness map.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ZK_USCS_SPARSE_CONSTRAINT_SYSTEM_HPP
+#define CRYPTO3_ZK_USCS_SPARSE_CONSTRAINT_SYSTEM_HPP
+
+#include <atomic>
+#include <cstdlib>
+#include <vector>
+
+#include <nil/crypto3/zk/math/sparse_linear_matrix.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/constraint_satisfaction_problems/uscs.hpp>
+
+#include <nil/actor/core/thread_pool.hpp>
+#include <nil/actor/core/parallelization_utils.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace zk {
+            namespace snark {
+
+                /**
+                 * A USCS constraint system
+                 *
+                 *     { ( < V_k , X > )^2 = 1 }_{k=1}^{n}
+                 *
+                 * where the rows V_k are stored as a CSR matrix V.
+                 */
+                template<typename FieldType>
+                struct uscs_sparse_constraint_system {
+                    typedef FieldType field_type;
+                    typedef math::sparse_linear_matrix<FieldType> matrix_type;
+
+                    std::size_t primary_input_size;
+                    std::size_t auxiliary_input_size;
+
+                    matrix_type v;
+
+                    uscs_sparse_constraint_system() : primary_input_size(0), auxiliary_input_size(0) {
+                    }
+
+                    explicit uscs_sparse_constraint_system(const uscs_constraint_system<FieldType> &cs) :
+                        primary_input_size(cs.primary_input_size), auxiliary_input_size(cs.auxiliary_input_size) {
+
+                        std::size_t v_size = 0;
+                        for (const uscs_constraint<FieldType> &constraint : cs.constraints) {
+                            v_size += constraint.terms.size();
+                        }
+                        v.reserve(cs.num_constraints(), v_size);
+
+                        for (const uscs_constraint<FieldType> &constraint : cs.constraints) {
+                            v.push_back(constraint);
+                        }
+                    }
+
+                    std::size_t num_inputs() const {
+                        return primary_input_size;
+                    }
+
+                    std::size_t num_variables() const {
+                        return primary_input_size + auxiliary_input_size;
+                    }
+
+                    std::size_t num_constraints() const {
+                        return v.rows();
+                    }
+
+                    bool is_satisfied(const uscs_primary_input<FieldType> &primary_input,
+                                      const uscs_auxiliary_input<FieldType> &auxiliary_input) const {
+                        assert(primary_input.size() == num_inputs());
+                        assert(primary_input.size() + auxiliary_input.size() == num_variables());
+
+                        const std::vector<typename FieldType::value_type> z =
+                            math::make_extended_assignment(primary_input, auxiliary_input);
+
+                        std::atomic<bool> satisfied = true;
+                        wait_for_all(parallel_run_in_chunks<void>(
+                            num_constraints(),
+                            [this, &z, &satisfied](std::size_t begin, std::size_t end) {
+                                for (std::size_t k = begin; k < end && satisfied; ++k) {
+                                    if (!(v.row_product(k, z).squared() == FieldType::value_type::one())) {
+                                        satisfied = false;
+                                    }
+                                }
+                            }));
+
+                        return satisfied;
+                    }
+
+                    bool operator==(const uscs_sparse_constraint_system<FieldType> &other) const {
+                        return (this->v == other.v && this->primary_input_size == other.primary_input_size &&
+                                this->auxiliary_input_size == other.auxiliary_input_size);
+                    }
+                };
+
+                /**
+                 * Converts a USCS constraint system into its sparse CSR form.
+                 */
+                template<typename FieldType>
+                uscs_sparse_constraint_system<FieldType>
+                    make_uscs_sparse_constraint_system(const uscs_constraint_system<FieldType> &cs) {
+                    return uscs_sparse_constraint_system<FieldType>(cs);
+                }
+
+            }    // namespace snark
+        }        // namespace zk
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ZK_USCS_SPARSE_CONSTRAINT_SYSTEM_HPP
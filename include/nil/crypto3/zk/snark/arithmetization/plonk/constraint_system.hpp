@@ -45,6 +45,10 @@
 #include <nil/crypto3/zk/snark/arithmetization/plonk/lookup_constraint.hpp>
 #include <nil/crypto3/zk/snark/arithmetization/plonk/lookup_gate.hpp>
 #include <nil/crypto3/zk/snark/arithmetization/plonk/lookup_table.hpp>
+#include <nil/crypto3/zk/math/expression_arena.hpp>
+
+#include <nil/actor/core/thread_pool.hpp>
+#include <nil/actor/core/parallelization_utils.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -130,6 +134,32 @@ namespace nil {
                         return _gates.size();
                     }
 
+                    /**
+                     * Rebuilds the gate and lookup constraints so that equal subexpressions are stored once,
+                     * in the given arena. Gates are interned in parallel. Constraints stay equal to what they
+                     * were, only their sharing changes. Returns the number of unique nodes in the arena.
+                     */
+                    std::size_t hash_cons(math::expression_arena<variable_type> &arena) {
+                        parallel_for(0, _gates.size(), [this, &arena](std::size_t i) {
+                            for (auto &constraint : _gates[i].constraints) {
+                                constraint = plonk_constraint<FieldType>(arena.intern(constraint));
+                            }
+                        });
+                        parallel_for(0, _lookup_gates.size(), [this, &arena](std::size_t i) {
+                            for (auto &constraint : _lookup_gates[i].constraints) {
+                                for (auto &input : constraint.lookup_input) {
+                                    input = plonk_constraint<FieldType>(arena.intern(input));
+                                }
+                            }
+                        });
+                        return arena.size();
+                    }
+
+                    std::size_t hash_cons() {
+                        math::expression_arena<variable_type> arena;
+                        return hash_cons(arena);
+                    }
+
                     std::size_t num_lookup_gates() const {
                         return _lookup_gates.size();
                     }
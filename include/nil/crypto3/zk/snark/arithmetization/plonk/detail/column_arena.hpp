@@ -0,0 +1,318 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+// @file Declaration of a columnar arena for PLONK assignment tables.
+//
+// All columns of a table live in one page-aligned allocation with a fixed stride.
+// Column i occupies [i * stride, i * stride + rows), the stride is rows rounded up
+// to a whole number of cache lines so that no two columns share a line.
+//
+// The arena is storage for assignment generation only. math::polynomial_dfs owns
+// its coefficients, so building the polynomial tables copies every column out of
+// the arena through to_columns().
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ZK_PLONK_TABLE_DETAIL_COLUMN_ARENA_HPP
+#define CRYPTO3_ZK_PLONK_TABLE_DETAIL_COLUMN_ARENA_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+#include <boost/assert.hpp>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+#include <nil/crypto3/zk/snark/arithmetization/plonk/assignment.hpp>
+
+#include <nil/actor/core/thread_pool.hpp>
+#include <nil/actor/core/parallelization_utils.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace zk {
+            namespace snark {
+                namespace detail {
+
+                    /**
+                     * Counters of the memory held by column arenas. Updated by every arena
+                     * (de)allocation, read at any time.
+                     */
+                    struct column_arena_statistics {
+                        std::atomic<std::size_t> allocations {0};
+                        std::atomic<std::size_t> bytes {0};
+                        std::atomic<std::size_t> peak_bytes {0};
+
+                        void reset() {
+                            allocations = 0;
+                            bytes = 0;
+                            peak_bytes = 0;
+                        }
+
+                        void allocated(std::size_t size) {
+                            ++allocations;
+                            std::size_t current = bytes += size;
+                            std::size_t peak = peak_bytes.load();
+                            while (current > peak && !peak_bytes.compare_exchange_weak(peak, current)) {
+                            }
+                        }
+
+                        void deallocated(std::size_t size) {
+                            bytes -= size;
+                        }
+
+                        static column_arena_statistics &instance() {
+                            static column_arena_statistics statistics;
+                            return statistics;
+                        }
+                    };
+
+                    /**
+                     * A contiguous range of field elements inside an arena. Does not own memory.
+                     */
+                    template<typename ValueType>
+                    class column_view {
+                    public:
+                        typedef ValueType value_type;
+                        typedef ValueType *iterator;
+                        typedef const ValueType *const_iterator;
+
+                        column_view() : _first(nullptr), _size(0) {
+                        }
+
+                        column_view(ValueType *first, std::size_t size) : _first(first), _size(size) {
+                        }
+
+                        iterator begin() const {
+                            return _first;
+                        }
+
+                        iterator end() const {
+                            return _first + _size;
+                        }
+
+                        ValueType *data() const {
+                            return _first;
+                        }
+
+                        std::size_t size() const {
+                            return _size;
+                        }
+
+                        ValueType &operator[](std::size_t index) const {
+                            BOOST_ASSERT(index < _size);
+                            return _first[index];
+                        }
+
+                    private:
+                        ValueType *_first;
+                        std::size_t _size;
+                    };
+
+                    template<typename FieldType>
+                    class plonk_column_arena {
+                    public:
+                        typedef FieldType field_type;
+                        typedef typename FieldType::value_type value_type;
+                        typedef column_view<value_type> column_type;
+                        typedef column_view<const value_type> const_column_type;
+
+                        constexpr static const std::size_t page_size = 4096;
+                        constexpr static const std::size_t huge_page_size = std::size_t(2) << 20;
+                        constexpr static const std::size_t cache_line_size = 64;
+
+                        plonk_column_arena() : _data(nullptr), _columns(0), _rows(0), _stride(0), _bytes(0) {
+                        }
+
+                        /**
+                         * Allocates columns_amount zero columns of rows_amount rows. Arenas above the huge
+                         * page size are advised to be backed by transparent huge pages where available.
+                         */
+                        plonk_column_arena(std::size_t columns_amount, std::size_t rows_amount) :
+                            _data(nullptr),
+                            _columns(columns_amount), _rows(rows_amount), _stride(padded_stride(rows_amount)),
+                            _bytes(0) {
+                            if (_columns == 0 || _stride == 0) {
+                                return;
+                            }
+
+                            std::size_t size = _columns * _stride * sizeof(value_type);
+                            std::size_t alignment = size >= huge_page_size ? huge_page_size : page_size;
+                            _bytes = (size + alignment - 1) / alignment * alignment;
+
+                            void *memory = nullptr;
+                            if (posix_memalign(&memory, alignment, _bytes) != 0) {
+                                throw std::bad_alloc();
+                            }
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+                            if (alignment == huge_page_size) {
+                                madvise(memory, _bytes, MADV_HUGEPAGE);
+                            }
+#endif
+                            _data = static_cast<value_type *>(memory);
+                            column_arena_statistics::instance().allocated(_bytes);
+
+                            /* First touch from the workers, so pages land next to the threads using them. */
+                            value_type *data = _data;
+                            wait_for_all(parallel_run_in_chunks<void>(
+                                _columns * _stride, [data](std::size_t begin, std::size_t end) {
+                                    std::uninitialized_fill(data + begin, data + end, value_type::zero());
+                                }));
+                        }
+
+                        /**
+                         * Packs existing columns into an arena. All columns must have the same size.
+                         */
+                        template<typename ColumnContainer>
+                        static plonk_column_arena from_columns(const ColumnContainer &columns) {
+                            std::size_t rows_amount = columns.empty() ? 0 : columns.begin()->size();
+                            plonk_column_arena arena(columns.size(), rows_amount);
+
+                            std::size_t i = 0;
+                            for (const auto &column : columns) {
+                                arena.assign(i++, column);
+                            }
+                            return arena;
+                        }
+
+                        plonk_column_arena(const plonk_column_arena &) = delete;
+                        plonk_column_arena &operator=(const plonk_column_arena &) = delete;
+
+                        plonk_column_arena(plonk_column_arena &&other) noexcept :
+                            _data(other._data), _columns(other._columns), _rows(other._rows),
+                            _stride(other._stride), _bytes(other._bytes) {
+                            other._data = nullptr;
+                            other._bytes = 0;
+                        }
+
+                        plonk_column_arena &operator=(plonk_column_arena &&other) noexcept {
+                            if (this != &other) {
+                                release();
+                                _data = other._data;
+                                _columns = other._columns;
+                                _rows = other._rows;
+                                _stride = other._stride;
+                                _bytes = other._bytes;
+                                other._data = nullptr;
+                                other._bytes = 0;
+                            }
+                            return *this;
+                        }
+
+                        ~plonk_column_arena() {
+                            release();
+                        }
+
+                        std::size_t columns_amount() const {
+                            return _columns;
+                        }
+
+                        std::size_t rows_amount() const {
+                            return _rows;
+                        }
+
+                        std::size_t stride() const {
+                            return _stride;
+                        }
+
+                        std::size_t size_in_bytes() const {
+                            return _bytes;
+                        }
+
+                        column_type column(std::size_t index) {
+                            BOOST_ASSERT(index < _columns);
+                            return column_type(_data + index * _stride, _rows);
+                        }
+
+                        const_column_type column(std::size_t index) const {
+                            BOOST_ASSERT(index < _columns);
+                            return const_column_type(_data + index * _stride, _rows);
+                        }
+
+                        column_type operator[](std::size_t index) {
+                            return column(index);
+                        }
+
+                        const_column_type operator[](std::size_t index) const {
+                            return column(index);
+                        }
+
+                        template<typename ColumnType>
+                        void assign(std::size_t index, const ColumnType &values) {
+                            BOOST_ASSERT(index < _columns);
+                            BOOST_ASSERT(values.size() <= _rows);
+                            std::copy(values.begin(), values.end(), _data + index * _stride);
+                        }
+
+                        /**
+                         * Copies the arena back into separately allocated columns, e.g. to build a
+                         * plonk_table for code paths which still need owning columns.
+                         */
+                        std::vector<plonk_column<FieldType>> to_columns() const {
+                            std::vector<plonk_column<FieldType>> columns(_columns);
+                            parallel_for(0, _columns, [this, &columns](std::size_t i) {
+                                const_column_type c = column(i);
+                                columns[i].assign(c.begin(), c.end());
+                            });
+                            return columns;
+                        }
+
+                    private:
+                        static std::size_t padded_stride(std::size_t rows) {
+                            std::size_t line = std::max<std::size_t>(1, cache_line_size / sizeof(value_type));
+                            return (rows + line - 1) / line * line;
+                        }
+
+                        void release() {
+                            if (_data == nullptr) {
+                                return;
+                            }
+                            std::size_t count = _columns * _stride;
+                            for (std::size_t i = 0; i < count; ++i) {
+                                _data[i].~value_type();
+                            }
+                            std::free(_data);
+                            column_arena_statistics::instance().deallocated(_bytes);
+                            _data = nullptr;
+                            _bytes = 0;
+                        }
+
+                        value_type *_data;
+                        std::size_t _columns;
+                        std::size_t _rows;
+                        std::size_t _stride;
+                        std::size_t _bytes;
+                    };
+                }    // namespace detail
+            }        // namespace snark
+        }            // namespace zk
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ZK_PLONK_TABLE_DETAIL_COLUMN_ARENA_HPP
@@ -0,0 +1,232 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+// @file Declaration of a structural digest of PLONK constraint systems.
+//
+// The digest of an expression node is the hash of its kind, its own data and the
+// digests of its operands. Operands are shared pointers, and after
+// plonk_constraint_system::hash_cons() equal subexpressions are the same node, so
+// memoizing digests by node hashes every unique node once. The constraint system
+// digest then hashes the digests of the constraint roots together with the rest of
+// the constraint system: selectors, copy constraints, lookup gates and tables and
+// public input sizes.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ZK_PLONK_DETAIL_CONSTRAINT_SYSTEM_DIGEST_HPP
+#define CRYPTO3_ZK_PLONK_DETAIL_CONSTRAINT_SYSTEM_DIGEST_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/assert.hpp>
+#include <boost/variant/static_visitor.hpp>
+#include <boost/variant/apply_visitor.hpp>
+
+#include <nil/crypto3/algebra/marshalling.hpp>
+#include <nil/crypto3/hash/algorithm/hash.hpp>
+#include <nil/crypto3/hash/sha2.hpp>
+
+#include <nil/crypto3/zk/math/expression.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/plonk/constraint_system.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace zk {
+            namespace snark {
+                namespace detail {
+
+                    /**
+                     * Digests of the expressions over plonk_variable, memoized by node. Nodes must outlive
+                     * the object.
+                     */
+                    template<typename FieldType, typename Hash = hashes::sha2<256>>
+                    class plonk_expression_digest : public boost::static_visitor<typename Hash::digest_type> {
+                    public:
+                        typedef typename Hash::digest_type digest_type;
+                        typedef plonk_variable<typename FieldType::value_type> variable_type;
+                        typedef math::expression<variable_type> expression_type;
+
+                        enum node_kind : std::uint8_t { term_node, pow_node, binary_operation_node };
+
+                        digest_type digest(const expression_type &expr) {
+                            return boost::apply_visitor(*this, expr.get_expr());
+                        }
+
+                        // Number of nodes hashed so far, shared operands counted once.
+                        std::size_t hashed_nodes() const {
+                            return _hashed_nodes;
+                        }
+
+                        digest_type operator()(const math::term<variable_type> &t) {
+                            std::vector<std::uint8_t> data = {term_node};
+                            append_field_element(data, t.get_coeff());
+
+                            // Terms equal up to the order of their variables are equal.
+                            std::vector<variable_type> vars = t.get_vars();
+                            std::sort(vars.begin(), vars.end());
+                            append_integer(data, vars.size());
+                            for (const auto &var : vars) {
+                                append_variable(data, var);
+                            }
+                            return hash_node(data);
+                        }
+
+                        digest_type operator()(const math::pow_operation<variable_type> &pow) {
+                            std::vector<std::uint8_t> data = {pow_node};
+                            append_integer(data, static_cast<std::uint32_t>(pow.get_power()));
+                            append_digest(data, operand_digest(pow.get_expr_ptr()));
+                            return hash_node(data);
+                        }
+
+                        digest_type operator()(const math::binary_arithmetic_operation<variable_type> &op) {
+                            std::vector<std::uint8_t> data = {binary_operation_node,
+                                                              static_cast<std::uint8_t>(op.get_op())};
+                            append_digest(data, operand_digest(op.get_expr_left_ptr()));
+                            append_digest(data, operand_digest(op.get_expr_right_ptr()));
+                            return hash_node(data);
+                        }
+
+                        template<typename Integral>
+                        static void append_integer(std::vector<std::uint8_t> &data, Integral value) {
+                            std::uint64_t v = static_cast<std::uint64_t>(value);
+                            for (int shift = 56; shift >= 0; shift -= 8) {
+                                data.push_back(static_cast<std::uint8_t>(v >> shift));
+                            }
+                        }
+
+                        static void append_variable(std::vector<std::uint8_t> &data, const variable_type &var) {
+                            append_integer(data, var.index);
+                            append_integer(data, static_cast<std::uint32_t>(var.rotation));
+                            data.push_back(var.relative ? 1 : 0);
+                            data.push_back(static_cast<std::uint8_t>(var.type));
+                        }
+
+                        static void append_field_element(std::vector<std::uint8_t> &data,
+                                                         const typename FieldType::value_type &value) {
+                            nil::marshalling::status_type status;
+                            std::vector<std::uint8_t> bytes =
+                                nil::marshalling::pack<nil::marshalling::option::big_endian>(value, status);
+                            BOOST_ASSERT(status == nil::marshalling::status_type::success);
+                            data.insert(data.end(), bytes.begin(), bytes.end());
+                        }
+
+                        static void append_digest(std::vector<std::uint8_t> &data, const digest_type &digest) {
+                            data.insert(data.end(), digest.begin(), digest.end());
+                        }
+
+                    private:
+                        typedef typename math::pow_operation<variable_type>::expression_ptr_type expression_ptr_type;
+
+                        digest_type operand_digest(const expression_ptr_type &operand) {
+                            auto it = _digests.find(operand.get());
+                            if (it != _digests.end()) {
+                                return it->second;
+                            }
+                            digest_type result = digest(*operand);
+                            _digests.emplace(operand.get(), result);
+                            return result;
+                        }
+
+                        digest_type hash_node(const std::vector<std::uint8_t> &data) {
+                            ++_hashed_nodes;
+                            return nil::crypto3::hash<Hash>(data);
+                        }
+
+                        std::unordered_map<const expression_type *, digest_type> _digests;
+                        std::size_t _hashed_nodes = 0;
+                    };
+
+                    /**
+                     * Digest of everything plonk_constraint_system holds. For a hash-consed constraint system
+                     * the expression part costs one hash per unique node rather than one per tree node.
+                     */
+                    template<typename FieldType, typename Hash = hashes::sha2<256>>
+                    typename Hash::digest_type constraint_system_digest(
+                            const plonk_constraint_system<FieldType> &constraint_system) {
+                        typedef plonk_expression_digest<FieldType, Hash> expression_digest_type;
+
+                        expression_digest_type expression_digest;
+                        std::vector<std::uint8_t> data;
+
+                        const auto &gates = constraint_system.gates();
+                        expression_digest_type::append_integer(data, gates.size());
+                        for (const auto &gate : gates) {
+                            expression_digest_type::append_integer(data, gate.selector_index);
+                            expression_digest_type::append_integer(data, gate.constraints.size());
+                            for (const auto &constraint : gate.constraints) {
+                                expression_digest_type::append_digest(data, expression_digest.digest(constraint));
+                            }
+                        }
+
+                        const auto &copy_constraints = constraint_system.copy_constraints();
+                        expression_digest_type::append_integer(data, copy_constraints.size());
+                        for (const auto &copy_constraint : copy_constraints) {
+                            expression_digest_type::append_variable(data, copy_constraint.first);
+                            expression_digest_type::append_variable(data, copy_constraint.second);
+                        }
+
+                        const auto &lookup_gates = constraint_system.lookup_gates();
+                        expression_digest_type::append_integer(data, lookup_gates.size());
+                        for (const auto &gate : lookup_gates) {
+                            expression_digest_type::append_integer(data, gate.tag_index);
+                            expression_digest_type::append_integer(data, gate.constraints.size());
+                            for (const auto &constraint : gate.constraints) {
+                                expression_digest_type::append_integer(data, constraint.table_id);
+                                expression_digest_type::append_integer(data, constraint.lookup_input.size());
+                                for (const auto &input : constraint.lookup_input) {
+                                    expression_digest_type::append_digest(data, expression_digest.digest(input));
+                                }
+                            }
+                        }
+
+                        const auto &lookup_tables = constraint_system.lookup_tables();
+                        expression_digest_type::append_integer(data, lookup_tables.size());
+                        for (const auto &table : lookup_tables) {
+                            expression_digest_type::append_integer(data, table.tag_index);
+                            expression_digest_type::append_integer(data, table.columns_number);
+                            expression_digest_type::append_integer(data, table.lookup_options.size());
+                            for (const auto &option : table.lookup_options) {
+                                expression_digest_type::append_integer(data, option.size());
+                                for (const auto &var : option) {
+                                    expression_digest_type::append_variable(data, var);
+                                }
+                            }
+                        }
+
+                        const auto &public_input_sizes = constraint_system.public_input_sizes();
+                        expression_digest_type::append_integer(data, public_input_sizes.size());
+                        for (std::size_t size : public_input_sizes) {
+                            expression_digest_type::append_integer(data, size);
+                        }
+
+                        return nil::crypto3::hash<Hash>(data);
+                    }
+                }    // namespace detail
+            }        // namespace snark
+        }            // namespace zk
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ZK_PLONK_DETAIL_CONSTRAINT_SYSTEM_DIGEST_HPP
@@ -0,0 +1,285 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+// @file Declaration of the FFT engine shared by the witness maps of the
+// R1CS-to-QAP, R1CS-to-SAP and USCS-to-SSP reductions.
+//
+// All three witness maps interpolate a few vectors of evaluations on S, evaluate
+// them on the coset g*S, combine them point-wise, divide by the vanishing polynomial
+// Z and interpolate the result back. The engine runs the independent transforms
+// concurrently, folds the coset shifts into the point-wise passes and divides by Z
+// with a single precomputed constant when Z is constant on the coset.
+//
+// Concurrency: an evaluation domain computes its twiddle factors lazily, on its first
+// fft() and inverse_fft(). From then on both transforms only read the domain, so any
+// number of them may run on one instance at once. Domains are therefore warmed up with
+// one transform each way before get_domain() hands them out, and engines are expected
+// to run on domains obtained from get_domain().
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ZK_WITNESS_MAP_ENGINE_HPP
+#define CRYPTO3_ZK_WITNESS_MAP_ENGINE_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <future>
+#include <initializer_list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <nil/crypto3/math/algorithms/make_evaluation_domain.hpp>
+#include <nil/crypto3/math/domains/evaluation_domain.hpp>
+#include <nil/crypto3/math/domains/basic_radix2_domain.hpp>
+
+#include <nil/crypto3/algebra/fields/params.hpp>
+
+#include <nil/actor/core/thread_pool.hpp>
+#include <nil/actor/core/parallelization_utils.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace zk {
+            namespace snark {
+                namespace reductions {
+                    namespace detail {
+
+                        /**
+                         * Counters of the work done by the witness maps of one reduction. Updated
+                         * concurrently by every witness map call, read at any time.
+                         */
+                        struct witness_map_statistics {
+                            std::atomic<std::size_t> witness_maps {0};
+                            std::atomic<std::size_t> ffts {0};
+                            std::atomic<std::size_t> inverse_ffts {0};
+                            std::atomic<std::uint64_t> fft_nanoseconds {0};
+                            std::atomic<std::uint64_t> total_nanoseconds {0};
+
+                            void reset() {
+                                witness_maps = 0;
+                                ffts = 0;
+                                inverse_ffts = 0;
+                                fft_nanoseconds = 0;
+                                total_nanoseconds = 0;
+                            }
+                        };
+
+                        template<typename FieldType>
+                        class witness_map_engine {
+                        public:
+                            typedef FieldType field_type;
+                            typedef typename FieldType::value_type value_type;
+                            typedef math::evaluation_domain<FieldType> domain_type;
+
+                            /// Number of domain sizes kept by get_domain(), the least recently used is dropped.
+                            constexpr static const std::size_t max_cached_domains = 8;
+
+                            /// domain is shared by concurrent transforms, see get_domain().
+                            witness_map_engine(const std::shared_ptr<domain_type> &domain,
+                                               witness_map_statistics &statistics) :
+                                _domain(domain),
+                                _statistics(statistics), _start(std::chrono::high_resolution_clock::now()),
+                                _coset_generator(value_type(
+                                    algebra::fields::arithmetic_params<FieldType>::multiplicative_generator)),
+                                _coset_generator_inverse(_coset_generator.inversed()) {
+                            }
+
+                            ~witness_map_engine() {
+                                _statistics.witness_maps++;
+                                _statistics.total_nanoseconds += std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                                                     std::chrono::high_resolution_clock::now() - _start)
+                                                                     .count();
+                            }
+
+                            /**
+                             * Returns an evaluation domain of at least min_size elements, with its twiddle
+                             * factors computed. The domains of the last max_cached_domains sizes are shared
+                             * by all later witness maps, so that the twiddle factors are reused from proof to
+                             * proof. A dropped domain stays alive while an engine still holds it.
+                             */
+                            static std::shared_ptr<domain_type> get_domain(std::size_t min_size) {
+                                static std::mutex domains_mutex;
+                                static std::map<std::size_t, cached_domain> domains;
+                                static std::uint64_t uses = 0;
+
+                                std::lock_guard<std::mutex> lock(domains_mutex);
+                                auto it = domains.find(min_size);
+                                if (it == domains.end()) {
+                                    if (domains.size() == max_cached_domains) {
+                                        auto least_recent = domains.begin();
+                                        for (auto d = domains.begin(); d != domains.end(); ++d) {
+                                            if (d->second.last_use < least_recent->second.last_use) {
+                                                least_recent = d;
+                                            }
+                                        }
+                                        domains.erase(least_recent);
+                                    }
+                                    cached_domain cached {math::make_evaluation_domain<FieldType>(min_size), 0};
+                                    warm_up(*cached.domain);
+                                    it = domains.emplace(min_size, std::move(cached)).first;
+                                }
+                                it->second.last_use = ++uses;
+                                return it->second.domain;
+                            }
+
+                            const std::shared_ptr<domain_type> &domain() const {
+                                return _domain;
+                            }
+
+                            const value_type &coset_generator() const {
+                                return _coset_generator;
+                            }
+
+                            /**
+                             * Interpolates every vector in place. The transforms run concurrently.
+                             */
+                            void inverse_fft(std::initializer_list<std::vector<value_type> *> polys) {
+                                run_concurrently(polys, true);
+                            }
+
+                            /**
+                             * Evaluates every vector in place. The transforms run concurrently.
+                             */
+                            void fft(std::initializer_list<std::vector<value_type> *> polys) {
+                                run_concurrently(polys, false);
+                            }
+
+                            /**
+                             * Calls f(i, g^i) for every i in [0, size), where g is the coset generator.
+                             * Used to fold the shift a_i -> a_i * g^i into another point-wise pass.
+                             */
+                            template<typename Function>
+                            void for_each_coset_power(std::size_t size, Function f) const {
+                                for_each_power(size, _coset_generator, f);
+                            }
+
+                            /**
+                             * Computes H[i] = numerator(i) / Z(g * w^i) for every point of the coset.
+                             * numerator may read H[i] before it is overwritten.
+                             */
+                            template<typename Numerator>
+                            void divide_by_z_on_coset(std::vector<value_type> &H, Numerator numerator) const {
+                                /* Z(x) = x^m - 1 is constant on a coset of a multiplicative subgroup */
+                                if (std::dynamic_pointer_cast<math::basic_radix2_domain<FieldType>>(_domain)) {
+                                    const value_type Z_inverse =
+                                        _domain->compute_vanishing_polynomial(_coset_generator).inversed();
+                                    for_each_chunk(_domain->m, [&H, &numerator, &Z_inverse](std::size_t i) {
+                                        H[i] = numerator(i) * Z_inverse;
+                                    });
+                                } else {
+                                    for_each_chunk(_domain->m, [&H, &numerator](std::size_t i) {
+                                        H[i] = numerator(i);
+                                    });
+                                    _domain->divide_by_z_on_coset(H);
+                                }
+                            }
+
+                            /**
+                             * Interpolates the coset evaluations H and adds the resulting coefficients
+                             * to coefficients, undoing the coset shift in the same pass.
+                             */
+                            void add_inverse_coset_fft(std::vector<value_type> &H,
+                                                       std::vector<value_type> &coefficients) {
+                                timed_fft(H, true);
+                                for_each_power(_domain->m, _coset_generator_inverse,
+                                               [&H, &coefficients](std::size_t i, const value_type &shift) {
+                                                   coefficients[i] += H[i] * shift;
+                                               });
+                            }
+
+                        private:
+                            struct cached_domain {
+                                std::shared_ptr<domain_type> domain;
+                                std::uint64_t last_use;
+                            };
+
+                            /// Makes the domain compute its twiddle factors, so later transforms only read it.
+                            static void warm_up(domain_type &domain) {
+                                std::vector<value_type> a(domain.m, value_type::zero());
+                                domain.fft(a);
+                                domain.inverse_fft(a);
+                            }
+
+                            template<typename Function>
+                            static void for_each_chunk(std::size_t size, Function f) {
+                                wait_for_all(parallel_run_in_chunks<void>(
+                                    size, [&f](std::size_t begin, std::size_t end) {
+                                        for (std::size_t i = begin; i < end; ++i) {
+                                            f(i);
+                                        }
+                                    }));
+                            }
+
+                            template<typename Function>
+                            static void for_each_power(std::size_t size, const value_type &base, Function f) {
+                                wait_for_all(parallel_run_in_chunks<void>(
+                                    size, [&base, &f](std::size_t begin, std::size_t end) {
+                                        value_type power = base.pow(begin);
+                                        for (std::size_t i = begin; i < end; ++i) {
+                                            f(i, power);
+                                            power *= base;
+                                        }
+                                    }));
+                            }
+
+                            void timed_fft(std::vector<value_type> &a, bool inverse) {
+                                auto start = std::chrono::high_resolution_clock::now();
+                                if (inverse) {
+                                    _domain->inverse_fft(a);
+                                    _statistics.inverse_ffts++;
+                                } else {
+                                    _domain->fft(a);
+                                    _statistics.ffts++;
+                                }
+                                _statistics.fft_nanoseconds += std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                                                   std::chrono::high_resolution_clock::now() - start)
+                                                                   .count();
+                            }
+
+                            void run_concurrently(std::initializer_list<std::vector<value_type> *> polys, bool inverse) {
+                                // FFT uses the low level thread pool, so the transforms are posted to the high level one.
+                                std::vector<std::future<void>> transforms;
+                                for (std::vector<value_type> *poly : polys) {
+                                    transforms.emplace_back(
+                                        ThreadPool::get_instance(ThreadPool::PoolLevel::HIGH)
+                                            .post<void>([this, poly, inverse]() { timed_fft(*poly, inverse); }));
+                                }
+                                wait_for_all(std::move(transforms));
+                            }
+
+                            std::shared_ptr<domain_type> _domain;
+                            witness_map_statistics &_statistics;
+                            std::chrono::time_point<std::chrono::high_resolution_clock> _start;
+                            value_type _coset_generator;
+                            value_type _coset_generator_inverse;
+                        };
+                    }    // namespace detail
+                }        // namespace reductions
+            }            // namespace snark
+        }                // namespace zk
+    }                    // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ZK_WITNESS_MAP_ENGINE_HPP
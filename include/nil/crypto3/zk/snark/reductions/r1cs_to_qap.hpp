@@ -53,6 +53,8 @@
 
 #include <nil/crypto3/zk/snark/arithmetization/arithmetic_programs/qap.hpp>
 #include <nil/crypto3/zk/snark/arithmetization/constraint_satisfaction_problems/r1cs.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/constraint_satisfaction_problems/r1cs_sparse.hpp>
+#include <nil/crypto3/zk/snark/reductions/detail/witness_map_engine.hpp>
 
 #include <nil/crypto3/algebra/fields/params.hpp>
 
@@ -227,14 +229,16 @@ namespace nil {
                             assert(cs.is_satisfied(primary_input, auxiliary_input));
 
                             const std::shared_ptr<math::evaluation_domain<FieldType>> domain =
-                                math::make_evaluation_domain<FieldType>(cs.num_constraints() + cs.num_inputs() + 1);
+                                detail::witness_map_engine<FieldType>::get_domain(cs.num_constraints() +
+                                                                                  cs.num_inputs() + 1);
 
                             r1cs_variable_assignment<FieldType> full_variable_assignment = primary_input;
                             full_variable_assignment.insert(full_variable_assignment.end(), auxiliary_input.begin(),
                                                             auxiliary_input.end());
 
                             std::vector<typename FieldType::value_type> aA(domain->m, FieldType::value_type::zero()),
-                                aB(domain->m, FieldType::value_type::zero());
+                                aB(domain->m, FieldType::value_type::zero()),
+                                aC(domain->m, FieldType::value_type::zero());
 
                             /* account for the additional constraints input_i * 0 = 0 */
                             for (std::size_t i = 0; i <= cs.num_inputs(); ++i) {
@@ -245,83 +249,118 @@ namespace nil {
                             for (std::size_t i = 0; i < cs.num_constraints(); ++i) {
                                 aA[i] += cs.constraints[i].a.evaluate(full_variable_assignment);
                                 aB[i] += cs.constraints[i].b.evaluate(full_variable_assignment);
+                                aC[i] += cs.constraints[i].c.evaluate(full_variable_assignment);
                             }
 
-                            domain->inverse_fft(aA);
+                            std::vector<typename FieldType::value_type> coefficients_for_H =
+                                compute_coefficients_for_H(domain, std::move(aA), std::move(aB), std::move(aC), d1, d2,
+                                                           d3);
 
-                            domain->inverse_fft(aB);
+                            return qap_witness<FieldType>(cs.num_variables(), domain->m, cs.num_inputs(), d1, d2, d3,
+                                                          full_variable_assignment, std::move(coefficients_for_H));
+                        }
 
-                            std::vector<typename FieldType::value_type> coefficients_for_H(
-                                domain->m + 1, FieldType::value_type::zero());
-#ifdef MULTICORE
-#pragma omp parallel for
-#endif
-                            /* add coefficients of the polynomial (d2*A + d1*B - d3) + d1*d2*Z */
-                            for (std::size_t i = 0; i < domain->m; ++i) {
-                                coefficients_for_H[i] = d2 * aA[i] + d1 * aB[i];
-                            }
-                            coefficients_for_H[0] -= d3;
-                            domain->add_poly_z(d1 * d2, coefficients_for_H);
+                        /**
+                         * Witness map for the R1CS-to-QAP reduction over a sparse (CSR) constraint system.
+                         *
+                         * Produces the same witness as the overload above; the evaluations of A, B, C
+                         * on S are computed as parallel sparse matrix-vector products.
+                         */
+                        static qap_witness<FieldType>
+                            witness_map(const r1cs_sparse_constraint_system<FieldType> &cs,
+                                        const r1cs_primary_input<FieldType> &primary_input,
+                                        const r1cs_auxiliary_input<FieldType> &auxiliary_input,
+                                        const typename FieldType::value_type &d1,
+                                        const typename FieldType::value_type &d2,
+                                        const typename FieldType::value_type &d3) {
+                            /* sanity check */
+                            assert(cs.is_satisfied(primary_input, auxiliary_input));
 
-                            math::multiply_by_coset(
-                                aA,
-                                typename FieldType::value_type(
-                                    fields::arithmetic_params<FieldType>::multiplicative_generator));
-                            domain->fft(aA);
+                            const std::shared_ptr<math::evaluation_domain<FieldType>> domain =
+                                detail::witness_map_engine<FieldType>::get_domain(cs.num_constraints() +
+                                                                                  cs.num_inputs() + 1);
 
-                            math::multiply_by_coset(
-                                aB,
-                                typename FieldType::value_type(
-                                    fields::arithmetic_params<FieldType>::multiplicative_generator));
-                            domain->fft(aB);
+                            const std::vector<typename FieldType::value_type> z =
+                                math::make_extended_assignment(primary_input, auxiliary_input);
 
-                            std::vector<typename FieldType::value_type> &H_tmp = aA;
-                            // can overwrite aA because it is not used later
-#ifdef MULTICORE
-#pragma omp parallel for
-#endif
-                            for (std::size_t i = 0; i < domain->m; ++i) {
-                                H_tmp[i] = aA[i] * aB[i];
-                            }
-                            std::vector<typename FieldType::value_type>().swap(aB);    // destroy aB
+                            std::vector<typename FieldType::value_type> aA(domain->m, FieldType::value_type::zero()),
+                                aB(domain->m, FieldType::value_type::zero()),
+                                aC(domain->m, FieldType::value_type::zero());
 
-                            std::vector<typename FieldType::value_type> aC(domain->m, FieldType::value_type::zero());
-                            for (std::size_t i = 0; i < cs.num_constraints(); ++i) {
-                                aC[i] += cs.constraints[i].c.evaluate(full_variable_assignment);
+                            /* account for the additional constraints input_i * 0 = 0 */
+                            for (std::size_t i = 0; i <= cs.num_inputs(); ++i) {
+                                aA[i + cs.num_constraints()] = z[i];
                             }
+                            /* account for all other constraints */
+                            cs.a.multiply_add(z, aA);
+                            cs.b.multiply_add(z, aB);
+                            cs.c.multiply_add(z, aC);
 
-                            domain->inverse_fft(aC);
+                            std::vector<typename FieldType::value_type> coefficients_for_H =
+                                compute_coefficients_for_H(domain, std::move(aA), std::move(aB), std::move(aC), d1, d2,
+                                                           d3);
 
-                            math::multiply_by_coset(
-                                aC,
-                                typename FieldType::value_type(
-                                    fields::arithmetic_params<FieldType>::multiplicative_generator));
-                            domain->fft(aC);
+                            return qap_witness<FieldType>(cs.num_variables(), domain->m, cs.num_inputs(), d1, d2, d3,
+                                                          r1cs_variable_assignment<FieldType>(z.begin() + 1, z.end()),
+                                                          std::move(coefficients_for_H));
+                        }
 
-#ifdef MULTICORE
-#pragma omp parallel for
-#endif
-                            for (std::size_t i = 0; i < domain->m; ++i) {
-                                H_tmp[i] = (H_tmp[i] - aC[i]);
-                            }
+                        /**
+                         * FFT counts and timings accumulated by all witness maps of this reduction.
+                         */
+                        static detail::witness_map_statistics &statistics() {
+                            static detail::witness_map_statistics witness_map_statistics;
+                            return witness_map_statistics;
+                        }
+
+                    private:
+                        /**
+                         * Steps (2)-(6) of the witness map: given the evaluations aA, aB, aC of A, B, C
+                         * on S, compute the coefficients of H patched for d1, d2, d3.
+                         *
+                         * The three interpolations and the three coset evaluations run concurrently;
+                         * the coset shift is folded into the pass computing the patch, and H is
+                         * computed in place of aA.
+                         */
+                        static std::vector<typename FieldType::value_type>
+                            compute_coefficients_for_H(const std::shared_ptr<math::evaluation_domain<FieldType>> &domain,
+                                                       std::vector<typename FieldType::value_type> &&aA,
+                                                       std::vector<typename FieldType::value_type> &&aB,
+                                                       std::vector<typename FieldType::value_type> &&aC,
+                                                       const typename FieldType::value_type &d1,
+                                                       const typename FieldType::value_type &d2,
+                                                       const typename FieldType::value_type &d3) {
+                            detail::witness_map_engine<FieldType> engine(domain, statistics());
+
+                            engine.inverse_fft({&aA, &aB, &aC});
 
-                            domain->divide_by_z_on_coset(H_tmp);
+                            std::vector<typename FieldType::value_type> coefficients_for_H(
+                                domain->m + 1, FieldType::value_type::zero());
+                            /* add coefficients of the polynomial (d2*A + d1*B - d3) + d1*d2*Z, */
+                            /* and shift A, B, C to the coset in the same pass */
+                            engine.for_each_coset_power(
+                                domain->m,
+                                [&](std::size_t i, const typename FieldType::value_type &shift) {
+                                    coefficients_for_H[i] = d2 * aA[i] + d1 * aB[i];
+                                    aA[i] *= shift;
+                                    aB[i] *= shift;
+                                    aC[i] *= shift;
+                                });
+                            coefficients_for_H[0] -= d3;
+                            domain->add_poly_z(d1 * d2, coefficients_for_H);
 
-                            domain->inverse_fft(H_tmp);
+                            engine.fft({&aA, &aB, &aC});
 
-                            multiply_by_coset(H_tmp,
-                                              typename FieldType::value_type(
-                                                  fields::arithmetic_params<FieldType>::multiplicative_generator)
-                                                  .inversed());
-#ifdef MULTICORE
-#pragma omp parallel for
-#endif
-                            for (std::size_t i = 0; i < domain->m; ++i) {
-                                coefficients_for_H[i] += H_tmp[i];
-                            }
+                            // can overwrite aA because it is not used later
+                            std::vector<typename FieldType::value_type> &H_tmp = aA;
+                            engine.divide_by_z_on_coset(
+                                H_tmp, [&aA, &aB, &aC](std::size_t i) { return aA[i] * aB[i] - aC[i]; });
+                            std::vector<typename FieldType::value_type>().swap(aB);    // destroy aB
+                            std::vector<typename FieldType::value_type>().swap(aC);    // destroy aC
 
-                            return qap_witness<FieldType>(cs.num_variables(), domain->m, cs.num_inputs(), d1, d2, d3,
-                                                          full_variable_assignment, std::move(coefficients_for_H));
+                            engine.add_inverse_coset_fft(H_tmp, coefficients_for_H);
+
+                            return coefficients_for_H;
                         }
                     };
                 }    // namespace reductions
@@ -55,6 +55,8 @@
 
 #include <nil/crypto3/zk/snark/arithmetization/arithmetic_programs/sap.hpp>
 #include <nil/crypto3/zk/snark/arithmetization/constraint_satisfaction_problems/r1cs.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/constraint_satisfaction_problems/r1cs_sparse.hpp>
+#include <nil/crypto3/zk/snark/reductions/detail/witness_map_engine.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -78,8 +80,9 @@ namespace nil {
                          * Helper function to find evaluation domain that will be used by the reduction
                          * for a given R1CS instance.
                          */
+                        template<typename ConstraintSystemType>
                         static std::shared_ptr<math::evaluation_domain<FieldType>>
-                        get_domain(const r1cs_constraint_system<FieldType> &cs) {
+                        get_domain(const ConstraintSystemType &cs) {
                             /*
                              * the SAP instance will have:
                              * - two constraints for every constraint in the original constraint system
@@ -88,8 +91,8 @@ namespace nil {
                              * see comments in instance_map for details on where these
                              * constraints come from.
                              */
-                            return math::make_evaluation_domain<FieldType>(2 * cs.num_constraints() +
-                                                                           2 * cs.num_inputs() + 1);
+                            return detail::witness_map_engine<FieldType>::get_domain(2 * cs.num_constraints() +
+                                                                                     2 * cs.num_inputs() + 1);
                         }
 
                         /**
@@ -326,28 +329,111 @@ namespace nil {
                             r1cs_variable_assignment<FieldType> full_variable_assignment = primary_input;
                             full_variable_assignment.insert(
                                     full_variable_assignment.end(), auxiliary_input.begin(), auxiliary_input.end());
+
+                            std::vector<typename FieldType::value_type> a_values(cs.num_constraints()),
+                                    b_values(cs.num_constraints()), c_values(cs.num_constraints());
+                            for (std::size_t i = 0; i < cs.num_constraints(); ++i) {
+                                a_values[i] = cs.constraints[i].a.evaluate(full_variable_assignment);
+                                b_values[i] = cs.constraints[i].b.evaluate(full_variable_assignment);
+                                c_values[i] = cs.constraints[i].c.evaluate(full_variable_assignment);
+                            }
+
+                            std::vector<typename FieldType::value_type> coefficients_for_H =
+                                    compute_coefficients_for_H(domain, cs.num_variables(), cs.num_inputs(),
+                                                               full_variable_assignment, a_values, b_values, c_values,
+                                                               d1, d2);
+
+                            return sap_witness<FieldType>(sap_num_variables,
+                                                          domain->m,
+                                                          cs.num_inputs(),
+                                                          d1,
+                                                          d2,
+                                                          full_variable_assignment,
+                                                          std::move(coefficients_for_H));
+                        }
+
+                        /**
+                         * Witness map for the R1CS-to-SAP reduction over a sparse (CSR) constraint system.
+                         *
+                         * Produces the same witness as the overload above; the values of the rows of
+                         * A, B, C are computed as parallel sparse matrix-vector products.
+                         */
+                        static sap_witness<FieldType>
+                        witness_map(const r1cs_sparse_constraint_system<FieldType> &cs,
+                                    const r1cs_primary_input<FieldType> &primary_input,
+                                    const r1cs_auxiliary_input<FieldType> &auxiliary_input,
+                                    const typename FieldType::value_type &d1,
+                                    const typename FieldType::value_type &d2) {
+                            /* sanity check */
+                            assert(cs.is_satisfied(primary_input, auxiliary_input));
+
+                            const std::shared_ptr<math::evaluation_domain<FieldType>> domain = get_domain(cs);
+
+                            std::size_t sap_num_variables = cs.num_variables() + cs.num_constraints() + cs.num_inputs();
+
+                            const std::vector<typename FieldType::value_type> z =
+                                    math::make_extended_assignment(primary_input, auxiliary_input);
+                            r1cs_variable_assignment<FieldType> full_variable_assignment(z.begin() + 1, z.end());
+
+                            const std::vector<typename FieldType::value_type> a_values = cs.a.multiply(z),
+                                                                              b_values = cs.b.multiply(z),
+                                                                              c_values = cs.c.multiply(z);
+
+                            std::vector<typename FieldType::value_type> coefficients_for_H =
+                                    compute_coefficients_for_H(domain, cs.num_variables(), cs.num_inputs(),
+                                                               full_variable_assignment, a_values, b_values, c_values,
+                                                               d1, d2);
+
+                            return sap_witness<FieldType>(sap_num_variables,
+                                                          domain->m,
+                                                          cs.num_inputs(),
+                                                          d1,
+                                                          d2,
+                                                          full_variable_assignment,
+                                                          std::move(coefficients_for_H));
+                        }
+
+                        /**
+                         * FFT counts and timings accumulated by all witness maps of this reduction.
+                         */
+                        static detail::witness_map_statistics &statistics() {
+                            static detail::witness_map_statistics witness_map_statistics;
+                            return witness_map_statistics;
+                        }
+
+                    private:
+                        /**
+                         * Steps (1)-(6) of the witness map given the values a_values[i], b_values[i],
+                         * c_values[i] of the i-th R1CS constraint rows. Appends the extra SAP variables
+                         * to full_variable_assignment.
+                         */
+                        static std::vector<typename FieldType::value_type>
+                        compute_coefficients_for_H(const std::shared_ptr<math::evaluation_domain<FieldType>> &domain,
+                                                   std::size_t num_variables,
+                                                   std::size_t num_inputs,
+                                                   r1cs_variable_assignment<FieldType> &full_variable_assignment,
+                                                   const std::vector<typename FieldType::value_type> &a_values,
+                                                   const std::vector<typename FieldType::value_type> &b_values,
+                                                   const std::vector<typename FieldType::value_type> &c_values,
+                                                   const typename FieldType::value_type &d1,
+                                                   const typename FieldType::value_type &d2) {
+                            const std::size_t num_constraints = a_values.size();
+
                             /**
                              * we need to generate values of all the extra variables that we added
                              * during the reduction
-                             *
-                             * note: below, we pass full_variable_assignment into the .evaluate()
-                             * method of the R1CS constraints. however, these extra variables shouldn't
-                             * be a problem, because .evaluate() only accesses the variables that are
-                             * actually used in the constraint.
                              */
-                            for (std::size_t i = 0; i < cs.num_constraints(); ++i) {
+                            for (std::size_t i = 0; i < num_constraints; ++i) {
                                 /**
                                  * this is variable (extra_var_offset + i), an extra variable
                                  * we introduced that is not present in the input.
                                  * its value is (a - b)^2
                                  */
-                                typename FieldType::value_type extra_var =
-                                        cs.constraints[i].a.evaluate(full_variable_assignment) -
-                                        cs.constraints[i].b.evaluate(full_variable_assignment);
+                                typename FieldType::value_type extra_var = a_values[i] - b_values[i];
                                 extra_var = extra_var * extra_var;
                                 full_variable_assignment.push_back(extra_var);
                             }
-                            for (std::size_t i = 1; i <= cs.num_inputs(); ++i) {
+                            for (std::size_t i = 1; i <= num_inputs; ++i) {
                                 /**
                                  * this is variable (extra_var_offset2 + i), an extra variable
                                  * we introduced that is not present in the input.
@@ -362,19 +448,19 @@ namespace nil {
                             std::vector<typename FieldType::value_type> aA(domain->m, FieldType::value_type::zero());
 
                             /* account for all constraints, as in instance_map */
-                            for (std::size_t i = 0; i < cs.num_constraints(); ++i) {
-                                aA[2 * i] += cs.constraints[i].a.evaluate(full_variable_assignment);
-                                aA[2 * i] += cs.constraints[i].b.evaluate(full_variable_assignment);
+                            for (std::size_t i = 0; i < num_constraints; ++i) {
+                                aA[2 * i] += a_values[i];
+                                aA[2 * i] += b_values[i];
 
-                                aA[2 * i + 1] += cs.constraints[i].a.evaluate(full_variable_assignment);
-                                aA[2 * i + 1] -= cs.constraints[i].b.evaluate(full_variable_assignment);
+                                aA[2 * i + 1] += a_values[i];
+                                aA[2 * i + 1] -= b_values[i];
                             }
 
-                            std::size_t extra_constr_offset = 2 * cs.num_constraints();
+                            std::size_t extra_constr_offset = 2 * num_constraints;
 
                             aA[extra_constr_offset] += FieldType::value_type::one();
 
-                            for (std::size_t i = 1; i <= cs.num_inputs(); ++i) {
+                            for (std::size_t i = 1; i <= num_inputs; ++i) {
                                 aA[extra_constr_offset + 2 * i - 1] += full_variable_assignment[i - 1];
                                 aA[extra_constr_offset + 2 * i - 1] += FieldType::value_type::one();
 
@@ -382,49 +468,20 @@ namespace nil {
                                 aA[extra_constr_offset + 2 * i] -= FieldType::value_type::one();
                             }
 
-                            domain->inverse_fft(aA);
-
-                            std::vector<typename FieldType::value_type> coefficients_for_H(
-                                    domain->m + 1, FieldType::value_type::zero());
-#ifdef MULTICORE
-#pragma omp parallel for
-#endif
-                            /* add coefficients of the polynomial (2*d1*A - d2) + d1*d1*Z */
-                            for (std::size_t i = 0; i < domain->m; ++i) {
-                                coefficients_for_H[i] = (d1 * aA[i]) + (d1 * aA[i]);
-                            }
-                            coefficients_for_H[0] -= d2;
-                            domain->add_poly_z(d1 * d1, coefficients_for_H);
-
-                            math::multiply_by_coset(
-                                    aA,
-                                    typename FieldType::value_type(
-                                            algebra::fields::arithmetic_params<FieldType>::multiplicative_generator));
-                            domain->fft(aA);
-
-                            std::vector<typename FieldType::value_type> &H_tmp =
-                                    aA;    // can overwrite aA because it is not used later
-#ifdef MULTICORE
-#pragma omp parallel for
-#endif
-                            for (std::size_t i = 0; i < domain->m; ++i) {
-                                H_tmp[i] = aA[i] * aA[i];
-                            }
-
                             std::vector<typename FieldType::value_type> aC(domain->m, FieldType::value_type::zero());
                             /* again, accounting for all constraints */
-                            std::size_t extra_var_offset = cs.num_variables() + 1;
-                            for (std::size_t i = 0; i < cs.num_constraints(); ++i) {
-                                aC[2 * i] += times_four(cs.constraints[i].c.evaluate(full_variable_assignment));
+                            std::size_t extra_var_offset = num_variables + 1;
+                            for (std::size_t i = 0; i < num_constraints; ++i) {
+                                aC[2 * i] += times_four(c_values[i]);
 
                                 aC[2 * i] += full_variable_assignment[extra_var_offset + i - 1];
                                 aC[2 * i + 1] += full_variable_assignment[extra_var_offset + i - 1];
                             }
 
-                            std::size_t extra_var_offset2 = cs.num_variables() + cs.num_constraints();
+                            std::size_t extra_var_offset2 = num_variables + num_constraints;
                             aC[extra_constr_offset] += FieldType::value_type::one();
 
-                            for (std::size_t i = 1; i <= cs.num_inputs(); ++i) {
+                            for (std::size_t i = 1; i <= num_inputs; ++i) {
                                 aC[extra_constr_offset + 2 * i - 1] += times_four(full_variable_assignment[i - 1]);
 
                                 aC[extra_constr_offset + 2 * i - 1] +=
@@ -432,43 +489,35 @@ namespace nil {
                                 aC[extra_constr_offset + 2 * i] += full_variable_assignment[extra_var_offset2 + i - 1];
                             }
 
-                            domain->inverse_fft(aC);
+                            detail::witness_map_engine<FieldType> engine(domain, statistics());
 
-                            math::multiply_by_coset(
-                                    aC,
-                                    typename FieldType::value_type(
-                                            algebra::fields::arithmetic_params<FieldType>::multiplicative_generator));
-                            domain->fft(aC);
+                            engine.inverse_fft({&aA, &aC});
 
-#ifdef MULTICORE
-#pragma omp parallel for
-#endif
-                            for (std::size_t i = 0; i < domain->m; ++i) {
-                                H_tmp[i] = (H_tmp[i] - aC[i]);
-                            }
+                            std::vector<typename FieldType::value_type> coefficients_for_H(
+                                    domain->m + 1, FieldType::value_type::zero());
+                            const typename FieldType::value_type two_d1 = d1 + d1;
+                            /* add coefficients of the polynomial (2*d1*A - d2) + d1*d1*Z, shift A, C to the coset */
+                            engine.for_each_coset_power(
+                                    domain->m,
+                                    [&](std::size_t i, const typename FieldType::value_type &shift) {
+                                        coefficients_for_H[i] = two_d1 * aA[i];
+                                        aA[i] *= shift;
+                                        aC[i] *= shift;
+                                    });
+                            coefficients_for_H[0] -= d2;
+                            domain->add_poly_z(d1 * d1, coefficients_for_H);
 
-                            domain->divide_by_z_on_coset(H_tmp);
+                            engine.fft({&aA, &aC});
 
-                            domain->inverse_fft(H_tmp);
-                            multiply_by_coset(H_tmp,
-                                              typename FieldType::value_type(
-                                                      algebra::fields::arithmetic_params<FieldType>::multiplicative_generator)
-                                                      .inversed());
+                            std::vector<typename FieldType::value_type> &H_tmp =
+                                    aA;    // can overwrite aA because it is not used later
+                            engine.divide_by_z_on_coset(
+                                    H_tmp, [&aA, &aC](std::size_t i) { return aA[i].squared() - aC[i]; });
+                            std::vector<typename FieldType::value_type>().swap(aC);    // destroy aC
 
-#ifdef MULTICORE
-#pragma omp parallel for
-#endif
-                            for (std::size_t i = 0; i < domain->m; ++i) {
-                                coefficients_for_H[i] += H_tmp[i];
-                            }
+                            engine.add_inverse_coset_fft(H_tmp, coefficients_for_H);
 
-                            return sap_witness<FieldType>(sap_num_variables,
-                                                          domain->m,
-                                                          cs.num_inputs(),
-                                                          d1,
-                                                          d2,
-                                                          full_variable_assignment,
-                                                          std::move(coefficients_for_H));
+                            return coefficients_for_H;
                         }
                     };
                 }    // namespace reductions
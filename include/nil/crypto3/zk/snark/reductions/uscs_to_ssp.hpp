@@ -54,6 +54,8 @@
 
 #include <nil/crypto3/zk/snark/arithmetization/arithmetic_programs/ssp.hpp>
 #include <nil/crypto3/zk/snark/arithmetization/constraint_satisfaction_problems/uscs.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/constraint_satisfaction_problems/uscs_sparse.hpp>
+#include <nil/crypto3/zk/snark/reductions/detail/witness_map_engine.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -185,7 +187,7 @@ namespace nil {
                                 full_variable_assignment.end(), auxiliary_input.begin(), auxiliary_input.end());
 
                             const std::shared_ptr<evaluation_domain<FieldType>> domain =
-                                make_evaluation_domain<FieldType>(cs.num_constraints());
+                                detail::witness_map_engine<FieldType>::get_domain(cs.num_constraints());
 
                             std::vector<typename FieldType::value_type> aA(domain->m, FieldType::value_type::zero());
                             assert(domain->m >= cs.num_constraints());
@@ -196,56 +198,102 @@ namespace nil {
                                 aA[i] += FieldType::value_type::one();
                             }
 
-                            domain->inverse_fft(aA);
+                            std::vector<typename FieldType::value_type> coefficients_for_H =
+                                compute_coefficients_for_H(domain, std::move(aA), d);
 
-                            std::vector<typename FieldType::value_type> coefficients_for_H(
-                                domain->m + 1, FieldType::value_type::zero());
-#ifdef MULTICORE
-#pragma omp parallel for
-#endif
-                            /* add coefficients of the polynomial 2*d*V(z) + d*d*Z(z) */
-                            for (std::size_t i = 0; i < domain->m; ++i) {
-                                coefficients_for_H[i] = typename FieldType::value_type(2) * d * aA[i];
-                            }
-                            domain->add_poly_z(d.squared(), coefficients_for_H);
+                            return ssp_witness<FieldType>(cs.num_variables(),
+                                                          domain->m,
+                                                          cs.num_inputs(),
+                                                          d,
+                                                          full_variable_assignment,
+                                                          std::move(coefficients_for_H));
+                        }
 
-                            math::multiply_by_coset(
-                                aA,
-                                typename FieldType::value_type(
-                                    fields::arithmetic_params<FieldType>::multiplicative_generator));
-                            domain->fft(aA);
-
-                            std::vector<typename FieldType::value_type> &H_tmp =
-                                aA;    // can overwrite aA because it is not used later
-#ifdef MULTICORE
-#pragma omp parallel for
-#endif
-                            for (std::size_t i = 0; i < domain->m; ++i) {
-                                H_tmp[i] = aA[i].squared() - FieldType::value_type::one();
-                            }
+                        /**
+                         * Witness map for the USCS-to-SSP reduction over a sparse (CSR) constraint system.
+                         *
+                         * Produces the same witness as the overload above; the evaluation of V on S
+                         * is computed as a parallel sparse matrix-vector product.
+                         */
+                        static ssp_witness<FieldType>
+                            witness_map(const uscs_sparse_constraint_system<FieldType> &cs,
+                                        const uscs_primary_input<FieldType> &primary_input,
+                                        const uscs_auxiliary_input<FieldType> &auxiliary_input,
+                                        const typename FieldType::value_type &d) {
+                            /* sanity check */
+                            assert(cs.is_satisfied(primary_input, auxiliary_input));
 
-                            domain->divide_by_z_on_coset(H_tmp);
+                            const std::vector<typename FieldType::value_type> z =
+                                math::make_extended_assignment(primary_input, auxiliary_input);
 
-                            domain->inverse_fft(H_tmp);
-                            multiply_by_coset(H_tmp,
-                                              typename FieldType::value_type(
-                                                  fields::arithmetic_params<FieldType>::multiplicative_generator)
-                                                  .inversed());
+                            const std::shared_ptr<evaluation_domain<FieldType>> domain =
+                                detail::witness_map_engine<FieldType>::get_domain(cs.num_constraints());
 
-#ifdef MULTICORE
-#pragma omp parallel for
-#endif
-                            for (std::size_t i = 0; i < domain->m; ++i) {
-                                coefficients_for_H[i] += H_tmp[i];
+                            std::vector<typename FieldType::value_type> aA(domain->m, FieldType::value_type::zero());
+                            assert(domain->m >= cs.num_constraints());
+                            cs.v.multiply_add(z, aA);
+                            for (std::size_t i = cs.num_constraints(); i < domain->m; ++i) {
+                                aA[i] += FieldType::value_type::one();
                             }
 
+                            std::vector<typename FieldType::value_type> coefficients_for_H =
+                                compute_coefficients_for_H(domain, std::move(aA), d);
+
                             return ssp_witness<FieldType>(cs.num_variables(),
                                                           domain->m,
                                                           cs.num_inputs(),
                                                           d,
-                                                          full_variable_assignment,
+                                                          uscs_variable_assignment<FieldType>(z.begin() + 1, z.end()),
                                                           std::move(coefficients_for_H));
                         }
+
+                        /**
+                         * FFT counts and timings accumulated by all witness maps of this reduction.
+                         */
+                        static detail::witness_map_statistics &statistics() {
+                            static detail::witness_map_statistics witness_map_statistics;
+                            return witness_map_statistics;
+                        }
+
+                    private:
+                        /**
+                         * Steps (2)-(6) of the witness map: given the evaluation aA of V on S,
+                         * compute the coefficients of H patched for d.
+                         *
+                         * The coset shift is folded into the pass computing the patch, and H is
+                         * computed in place of aA.
+                         */
+                        static std::vector<typename FieldType::value_type>
+                            compute_coefficients_for_H(const std::shared_ptr<evaluation_domain<FieldType>> &domain,
+                                                       std::vector<typename FieldType::value_type> &&aA,
+                                                       const typename FieldType::value_type &d) {
+                            detail::witness_map_engine<FieldType> engine(domain, statistics());
+
+                            engine.inverse_fft({&aA});
+
+                            std::vector<typename FieldType::value_type> coefficients_for_H(
+                                domain->m + 1, FieldType::value_type::zero());
+                            const typename FieldType::value_type two_d = typename FieldType::value_type(2) * d;
+                            /* add coefficients of the polynomial 2*d*V(z) + d*d*Z(z), shift V to the coset */
+                            engine.for_each_coset_power(
+                                domain->m,
+                                [&](std::size_t i, const typename FieldType::value_type &shift) {
+                                    coefficients_for_H[i] = two_d * aA[i];
+                                    aA[i] *= shift;
+                                });
+                            domain->add_poly_z(d.squared(), coefficients_for_H);
+
+                            engine.fft({&aA});
+
+                            // can overwrite aA because it is not used later
+                            std::vector<typename FieldType::value_type> &H_tmp = aA;
+                            engine.divide_by_z_on_coset(
+                                H_tmp, [&aA](std::size_t i) { return aA[i].squared() - FieldType::value_type::one(); });
+
+                            engine.add_inverse_coset_fft(H_tmp, coefficients_for_H);
+
+                            return coefficients_for_H;
+                        }
                     };
                 }    // namespace reductions
             }        // namespace snark
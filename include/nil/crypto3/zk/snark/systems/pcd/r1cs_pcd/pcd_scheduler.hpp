@@ -0,0 +1,302 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+// @file Declaration of a scheduler for proof-carrying data computations.
+//
+// A PCD computation is a DAG: every node proves the compliance of its outgoing message
+// given the messages and proofs of its children. The scheduler starts a node prover as
+// soon as all children of the node are done, so independent subtrees are proved
+// concurrently. Ready nodes with the longest path to a sink start first, and both the
+// number and the total memory of the nodes in flight can be capped.
+//
+// Every node runs on its own thread rather than on the thread pool: a node prover fans
+// its FFTs and multiexponentiations out to the pool and waits for them, which would
+// deadlock once all workers of a level run node provers waiting for work of that level.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ZK_PCD_SCHEDULER_HPP
+#define CRYPTO3_ZK_PCD_SCHEDULER_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <boost/assert.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace zk {
+            namespace snark {
+
+                /**
+                 * Timings of the last pcd_scheduler::run.
+                 */
+                struct pcd_scheduler_statistics {
+                    // Wall time of the whole run.
+                    double seconds = 0;
+                    // Sum of the times of all nodes, i.e. the time of a sequential run.
+                    double work_seconds = 0;
+                    // Time of the longest chain of dependent nodes, the lower bound for any schedule.
+                    double critical_path_seconds = 0;
+                    // Nodes of that chain, from a source to a sink.
+                    std::vector<std::size_t> critical_path;
+                    std::size_t peak_concurrency = 0;
+                    std::size_t peak_memory = 0;
+                };
+
+                /**
+                 * Runs the nodes of a DAG in dependency order, each on its own thread. ResultType is
+                 * what a node passes on to its parents, e.g. the outgoing message and its proof.
+                 */
+                template<typename ResultType>
+                class pcd_scheduler {
+                public:
+                    typedef ResultType result_type;
+                    typedef std::function<result_type(const std::vector<const result_type *> &children_results)>
+                        task_type;
+
+                    /**
+                     * Adds a node computed by task from the results of children, in the given order.
+                     * Children must have been added before, so the nodes are always in topological
+                     * order. memory is the estimated peak memory of task, in any unit consistent with
+                     * the limit passed to run.
+                     */
+                    std::size_t add_node(task_type task, const std::vector<std::size_t> &children,
+                                         std::size_t memory = 0) {
+                        std::size_t index = _nodes.size();
+                        for (std::size_t child : children) {
+                            BOOST_ASSERT(child < index);
+                            _nodes[child].parents.push_back(index);
+                        }
+                        _nodes.push_back({std::move(task), children, {}, memory});
+                        return index;
+                    }
+
+                    std::size_t size() const {
+                        return _nodes.size();
+                    }
+
+                    /**
+                     * Runs all nodes and returns their results, by node index. At most max_concurrency
+                     * nodes are in flight, by default one per hardware thread. With a non-zero
+                     * memory_limit, a node only starts if the memory of the nodes in flight stays
+                     * within the limit, or if nothing else is in flight. Exceptions of the tasks
+                     * are rethrown once the nodes in flight are done.
+                     */
+                    std::vector<result_type> run(std::size_t memory_limit = 0, std::size_t max_concurrency = 0) {
+                        const std::size_t nodes_count = _nodes.size();
+                        if (max_concurrency == 0) {
+                            max_concurrency = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+                        }
+                        _statistics = pcd_scheduler_statistics();
+                        auto begin = std::chrono::high_resolution_clock::now();
+
+                        /* Longest path to a sink, in nodes. Parents always come after their children. */
+                        std::vector<std::size_t> height(nodes_count, 1);
+                        for (std::size_t i = nodes_count; i-- > 0;) {
+                            for (std::size_t parent : _nodes[i].parents) {
+                                height[i] = std::max(height[i], height[parent] + 1);
+                            }
+                        }
+                        auto lower_priority = [&height](std::size_t a, std::size_t b) {
+                            return height[a] < height[b] || (height[a] == height[b] && a > b);
+                        };
+                        std::priority_queue<std::size_t, std::vector<std::size_t>, decltype(lower_priority)> ready(
+                            lower_priority);
+
+                        std::vector<std::size_t> pending_children(nodes_count);
+                        for (std::size_t i = 0; i < nodes_count; ++i) {
+                            pending_children[i] = _nodes[i].children.size();
+                            if (pending_children[i] == 0) {
+                                ready.push(i);
+                            }
+                        }
+
+                        std::vector<std::unique_ptr<result_type>> results(nodes_count);
+                        std::vector<double> node_seconds(nodes_count, 0);
+
+                        std::mutex mutex;
+                        std::condition_variable done_condition;
+                        std::vector<std::size_t> done;
+                        std::exception_ptr error;
+
+                        std::vector<std::future<void>> futures;
+                        futures.reserve(nodes_count);
+
+                        bool failed = false;
+                        std::size_t finished = 0;
+                        std::size_t in_flight = 0;
+                        std::size_t memory_in_flight = 0;
+                        while (finished < nodes_count) {
+                            while (!ready.empty() && !failed && in_flight < max_concurrency) {
+                                std::size_t index = ready.top();
+                                std::size_t memory = _nodes[index].memory;
+                                if (memory_limit != 0 && in_flight != 0 && memory_in_flight + memory > memory_limit) {
+                                    break;
+                                }
+                                ready.pop();
+                                ++in_flight;
+                                memory_in_flight += memory;
+                                _statistics.peak_concurrency = std::max(_statistics.peak_concurrency, in_flight);
+                                _statistics.peak_memory = std::max(_statistics.peak_memory, memory_in_flight);
+
+                                std::vector<const result_type *> children_results;
+                                children_results.reserve(_nodes[index].children.size());
+                                for (std::size_t child : _nodes[index].children) {
+                                    children_results.push_back(results[child].get());
+                                }
+
+                                futures.push_back(std::async(std::launch::async, [this, index, children_results,
+                                                                                  &results, &node_seconds, &mutex,
+                                                                                  &done_condition, &done, &error]() {
+                                    auto node_begin = std::chrono::high_resolution_clock::now();
+                                    try {
+                                        results[index] =
+                                            std::make_unique<result_type>(_nodes[index].task(children_results));
+                                    } catch (...) {
+                                        std::lock_guard<std::mutex> lock(mutex);
+                                        if (!error) {
+                                            error = std::current_exception();
+                                        }
+                                    }
+                                    auto node_end = std::chrono::high_resolution_clock::now();
+                                    node_seconds[index] =
+                                        std::chrono::duration_cast<std::chrono::nanoseconds>(node_end - node_begin)
+                                            .count() *
+                                        1e-9;
+
+                                    std::lock_guard<std::mutex> lock(mutex);
+                                    done.push_back(index);
+                                    done_condition.notify_one();
+                                }));
+                            }
+
+                            if (in_flight == 0) {
+                                /* Only possible after a failure, nothing else will be started. */
+                                break;
+                            }
+
+                            std::vector<std::size_t> just_done;
+                            {
+                                std::unique_lock<std::mutex> lock(mutex);
+                                done_condition.wait(lock, [&done]() { return !done.empty(); });
+                                just_done.swap(done);
+                                failed = static_cast<bool>(error);
+                            }
+                            for (std::size_t index : just_done) {
+                                --in_flight;
+                                memory_in_flight -= _nodes[index].memory;
+                                ++finished;
+                                if (!results[index]) {
+                                    continue;
+                                }
+                                for (std::size_t parent : _nodes[index].parents) {
+                                    if (--pending_children[parent] == 0) {
+                                        ready.push(parent);
+                                    }
+                                }
+                            }
+                        }
+                        for (std::future<void> &future : futures) {
+                            future.get();
+                        }
+
+                        if (error) {
+                            std::rethrow_exception(error);
+                        }
+
+                        auto end = std::chrono::high_resolution_clock::now();
+                        _statistics.seconds =
+                            std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count() * 1e-9;
+                        fill_critical_path(node_seconds);
+
+                        std::vector<result_type> result;
+                        result.reserve(nodes_count);
+                        for (auto &node_result : results) {
+                            result.push_back(std::move(*node_result));
+                        }
+                        return result;
+                    }
+
+                    const pcd_scheduler_statistics &statistics() const {
+                        return _statistics;
+                    }
+
+                private:
+                    struct node_type {
+                        task_type task;
+                        std::vector<std::size_t> children;
+                        std::vector<std::size_t> parents;
+                        std::size_t memory;
+                    };
+
+                    void fill_critical_path(const std::vector<double> &node_seconds) {
+                        const std::size_t nodes_count = _nodes.size();
+                        if (nodes_count == 0) {
+                            return;
+                        }
+
+                        /* Longest weighted path ending at every node, children come first. */
+                        std::vector<double> path_seconds(nodes_count, 0);
+                        std::vector<std::size_t> previous(nodes_count, nodes_count);
+                        std::size_t last = 0;
+                        for (std::size_t i = 0; i < nodes_count; ++i) {
+                            for (std::size_t child : _nodes[i].children) {
+                                if (previous[i] == nodes_count || path_seconds[child] > path_seconds[previous[i]]) {
+                                    previous[i] = child;
+                                }
+                            }
+                            path_seconds[i] =
+                                node_seconds[i] + (previous[i] == nodes_count ? 0 : path_seconds[previous[i]]);
+                            _statistics.work_seconds += node_seconds[i];
+                            if (path_seconds[i] > path_seconds[last]) {
+                                last = i;
+                            }
+                        }
+
+                        _statistics.critical_path_seconds = path_seconds[last];
+                        for (std::size_t i = last; i != nodes_count; i = previous[i]) {
+                            _statistics.critical_path.push_back(i);
+                        }
+                        std::reverse(_statistics.critical_path.begin(), _statistics.critical_path.end());
+                    }
+
+                    std::vector<node_type> _nodes;
+                    pcd_scheduler_statistics _statistics;
+                };
+            }    // namespace snark
+        }        // namespace zk
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ZK_PCD_SCHEDULER_HPP
@@ -56,11 +56,20 @@
 #ifndef CRYPTO3_ZK_R1CS_SP_PPZKPCD_HPP
 #define CRYPTO3_ZK_R1CS_SP_PPZKPCD_HPP
 
+#include <algorithm>
+#include <atomic>
+#include <functional>
 #include <memory>
+#include <utility>
+#include <vector>
 
+#include <nil/crypto3/zk/snark/systems/pcd/r1cs_pcd/pcd_scheduler.hpp>
 #include <nil/crypto3/zk/snark/systems/pcd/r1cs_pcd/r1cs_sp_ppzkpcd/r1cs_sp_ppzkpcd_params.hpp>
 #include <nil/crypto3/zk/snark/systems/ppzksnark/r1cs_ppzksnark.hpp>
 
+#include <nil/actor/core/thread_pool.hpp>
+#include <nil/actor/core/parallelization_utils.hpp>
+
 namespace nil {
     namespace crypto3 {
         namespace zk {
@@ -463,6 +472,78 @@ namespace nil {
 
                     return result;
                 }
+
+                /************************** Scheduled proving *******************************/
+
+                /**
+                 * Outgoing message of a node of a PCD computation and its proof.
+                 */
+                template<typename PCD_ppT>
+                struct r1cs_sp_ppzkpcd_node_output {
+                    std::shared_ptr<r1cs_sp_ppzkpcd_message<PCD_ppT>> message;
+                    r1cs_sp_ppzkpcd_proof<PCD_ppT> proof;
+                };
+
+                template<typename PCD_ppT>
+                using r1cs_sp_ppzkpcd_scheduler = pcd_scheduler<r1cs_sp_ppzkpcd_node_output<PCD_ppT>>;
+
+                /**
+                 * Produces the inputs of the compliance predicate of a node from the outgoing
+                 * messages of its children. Called concurrently for independent nodes.
+                 */
+                template<typename PCD_ppT>
+                using r1cs_sp_ppzkpcd_witness_generator =
+                    std::function<std::pair<r1cs_sp_ppzkpcd_primary_input<PCD_ppT>,
+                                            r1cs_sp_ppzkpcd_auxiliary_input<PCD_ppT>>(
+                        const std::vector<std::shared_ptr<r1cs_sp_ppzkpcd_message<PCD_ppT>>> &incoming_messages)>;
+
+                /**
+                 * Adds a node proved by r1cs_sp_ppzkpcd_prover from the outputs of children. Incoming
+                 * proofs are padded with default ones up to the arity of the compliance predicate,
+                 * as for base case nodes. pk must outlive the run of the scheduler.
+                 */
+                template<typename PCD_ppT>
+                std::size_t r1cs_sp_ppzkpcd_add_node(r1cs_sp_ppzkpcd_scheduler<PCD_ppT> &scheduler,
+                                                     const r1cs_sp_ppzkpcd_proving_key<PCD_ppT> &pk,
+                                                     r1cs_sp_ppzkpcd_witness_generator<PCD_ppT> witness_generator,
+                                                     const std::vector<std::size_t> &children,
+                                                     std::size_t memory = 0) {
+                    return scheduler.add_node(
+                        [&pk, witness_generator](
+                            const std::vector<const r1cs_sp_ppzkpcd_node_output<PCD_ppT> *> &children_outputs) {
+                            std::vector<std::shared_ptr<r1cs_sp_ppzkpcd_message<PCD_ppT>>> incoming_messages;
+                            std::vector<r1cs_sp_ppzkpcd_proof<PCD_ppT>> incoming_proofs;
+                            for (const r1cs_sp_ppzkpcd_node_output<PCD_ppT> *child : children_outputs) {
+                                incoming_messages.push_back(child->message);
+                                incoming_proofs.push_back(child->proof);
+                            }
+                            incoming_proofs.resize(
+                                std::max(incoming_proofs.size(), pk.compliance_predicate.max_arity));
+
+                            auto inputs = witness_generator(incoming_messages);
+                            r1cs_sp_ppzkpcd_proof<PCD_ppT> proof =
+                                r1cs_sp_ppzkpcd_prover<PCD_ppT>(pk, inputs.first, inputs.second, incoming_proofs);
+                            return r1cs_sp_ppzkpcd_node_output<PCD_ppT>({inputs.first.outgoing_message, std::move(proof)});
+                        },
+                        children, memory);
+                }
+
+                /**
+                 * Verifies the outputs of all nodes of a scheduled run in parallel, with one processed
+                 * verification key.
+                 */
+                template<typename PCD_ppT>
+                bool r1cs_sp_ppzkpcd_online_verifier(const r1cs_sp_ppzkpcd_processed_verification_key<PCD_ppT> &pvk,
+                                                     const std::vector<r1cs_sp_ppzkpcd_node_output<PCD_ppT>> &outputs) {
+                    std::atomic<bool> result(true);
+                    parallel_for(0, outputs.size(), [&pvk, &outputs, &result](std::size_t i) {
+                        const r1cs_sp_ppzkpcd_primary_input<PCD_ppT> primary_input(outputs[i].message);
+                        if (!r1cs_sp_ppzkpcd_online_verifier<PCD_ppT>(pvk, primary_input, outputs[i].proof)) {
+                            result = false;
+                        }
+                    }, ThreadPool::PoolLevel::HIGH);
+                    return result;
+                }
             }    // namespace snark
         }        // namespace zk
     }            // namespace crypto3
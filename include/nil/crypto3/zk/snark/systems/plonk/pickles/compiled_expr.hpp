@@ -0,0 +1,542 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+// @file Compiled form of the PolishToken programs of a Kimchi linearization.
+//
+// PolishToken::evaluate interprets the token stream on every call. Here the
+// stream is translated once per verifier index into a flat instruction array:
+// challenges, MDS entries and cells become offsets into tables filled once per
+// evaluation point, the Lagrange basis and "vanishes on last 4 rows" terms are
+// computed once per point instead of once per token, and the stack and cache
+// sizes are known in advance, so their storage is allocated once per evaluation
+// context and reused by every program evaluated in it.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ZK_PLONK_BATCHED_PICKLES_COMPILED_EXPR_HPP
+#define CRYPTO3_ZK_PLONK_BATCHED_PICKLES_COMPILED_EXPR_HPP
+
+#include <nil/crypto3/zk/snark/systems/plonk/pickles/expr.hpp>
+#include <nil/crypto3/zk/snark/systems/plonk/pickles/proof.hpp>
+#include <nil/crypto3/zk/snark/systems/plonk/pickles/constants.hpp>
+#include <nil/crypto3/zk/commitments/detail/polynomial/barycentric_evaluator.hpp>
+
+#include <nil/crypto3/math/domains/basic_radix2_domain.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <vector>
+
+namespace nil {
+    namespace crypto3 {
+        namespace zk {
+            namespace snark {
+                template<typename FieldType>
+                class polish_evaluation_context;
+
+                /// Offsets of the evaluations a Variable may refer to inside one row of the cell table.
+                struct polish_cell_layout {
+                    constexpr static const std::size_t WITNESS = 0;
+                    constexpr static const std::size_t Z = kimchi_constant::COLUMNS;
+                    constexpr static const std::size_t GENERIC_SELECTOR = Z + 1;
+                    constexpr static const std::size_t POSEIDON_SELECTOR = Z + 2;
+                    constexpr static const std::size_t LOOKUP_AGGREG = Z + 3;
+                    constexpr static const std::size_t LOOKUP_TABLE = Z + 4;
+                    constexpr static const std::size_t LOOKUP_RUNTIME = Z + 5;
+                    /// Columns without an evaluation in the proof read as zero, as in variable_evaluate.
+                    constexpr static const std::size_t ZERO = Z + 6;
+                    constexpr static const std::size_t LOOKUP_SORTED = Z + 7;
+
+                    static std::size_t column_offset(const Column &col) {
+                        switch (col.column) {
+                            case column_type::Witness:
+                                return WITNESS + col.witness_value;
+                            case column_type::Z:
+                                return Z;
+                            case column_type::LookupSorted:
+                                return LOOKUP_SORTED + col.lookup_sorted_value;
+                            case column_type::LookupAggreg:
+                                return LOOKUP_AGGREG;
+                            case column_type::LookupTable:
+                                return LOOKUP_TABLE;
+                            case column_type::LookupRuntimeTable:
+                                return LOOKUP_RUNTIME;
+                            case column_type::Index:
+                                if (col.index_value == gate_type::Poseidon) {
+                                    return POSEIDON_SELECTOR;
+                                }
+                                if (col.index_value == gate_type::Generic) {
+                                    return GENERIC_SELECTOR;
+                                }
+                                return ZERO;
+                            default:
+                                return ZERO;
+                        }
+                    }
+                };
+
+                /// Offsets of the challenges and MDS entries inside the constant table.
+                struct polish_constant_layout {
+                    constexpr static const std::size_t ALPHA = 0;
+                    constexpr static const std::size_t BETA = 1;
+                    constexpr static const std::size_t GAMMA = 2;
+                    constexpr static const std::size_t JOINT_COMBINER = 3;
+                    constexpr static const std::size_t ENDO_COEFFICIENT = 4;
+                    constexpr static const std::size_t MDS = 5;
+                    constexpr static const std::size_t MDS_WIDTH =
+                        kimchi_constant::SPONGE_CAPACITY + kimchi_constant::SPONGE_RATE;
+                    constexpr static const std::size_t SIZE = MDS + MDS_WIDTH * MDS_WIDTH;
+                };
+
+                template<typename FieldType>
+                class compiled_polish_program {
+                public:
+                    typedef typename FieldType::value_type value_type;
+
+                    enum class opcode : std::uint8_t {
+                        constant,
+                        literal,
+                        cell,
+                        lagrange_basis,
+                        vanishes_on_last_4_rows,
+                        dup,
+                        pow,
+                        add,
+                        mul,
+                        sub,
+                        store,
+                        load
+                    };
+
+                    struct instruction {
+                        opcode op;
+                        std::size_t operand;
+                    };
+
+                    compiled_polish_program() : _max_stack_depth(0), _cache_size(0) {
+                    }
+
+                    /**
+                     * Translates toks. Cells are bound to row_size-strided offsets of the cell table,
+                     * Lagrange basis indices are registered in lagrange_indices and replaced by their slot.
+                     */
+                    compiled_polish_program(const std::vector<PolishToken<FieldType>> &toks, std::size_t row_size,
+                                            std::vector<int> &lagrange_indices) :
+                        _max_stack_depth(0), _cache_size(0) {
+                        std::size_t depth = 0;
+                        _instructions.reserve(toks.size());
+
+                        for (const auto &t : toks) {
+                            instruction instr;
+                            instr.operand = 0;
+                            switch (t.token) {
+                                case token_type::Alpha:
+                                    instr = {opcode::constant, polish_constant_layout::ALPHA};
+                                    break;
+                                case token_type::Beta:
+                                    instr = {opcode::constant, polish_constant_layout::BETA};
+                                    break;
+                                case token_type::Gamma:
+                                    instr = {opcode::constant, polish_constant_layout::GAMMA};
+                                    break;
+                                case token_type::JointCombiner:
+                                    instr = {opcode::constant, polish_constant_layout::JOINT_COMBINER};
+                                    break;
+                                case token_type::EndoCoefficient:
+                                    instr = {opcode::constant, polish_constant_layout::ENDO_COEFFICIENT};
+                                    break;
+                                case token_type::Mds:
+                                    BOOST_ASSERT(t.mds_value.first < polish_constant_layout::MDS_WIDTH &&
+                                                 t.mds_value.second < polish_constant_layout::MDS_WIDTH);
+                                    instr = {opcode::constant, polish_constant_layout::MDS +
+                                                                   t.mds_value.first * polish_constant_layout::MDS_WIDTH +
+                                                                   t.mds_value.second};
+                                    break;
+                                case token_type::Literal:
+                                    instr = {opcode::literal, _literals.size()};
+                                    _literals.push_back(t.literal_value);
+                                    break;
+                                case token_type::Cell:
+                                    instr = {opcode::cell, static_cast<std::size_t>(t.cell_value.row) * row_size +
+                                                               polish_cell_layout::column_offset(t.cell_value.col)};
+                                    break;
+                                case token_type::VanishesOnLast4Rows:
+                                    instr = {opcode::vanishes_on_last_4_rows, 0};
+                                    break;
+                                case token_type::UnnormalizedLagrangeBasis: {
+                                    auto it = std::find(lagrange_indices.begin(), lagrange_indices.end(),
+                                                        t.unnormalized_lagrange_basis_value);
+                                    if (it == lagrange_indices.end()) {
+                                        it = lagrange_indices.insert(it, t.unnormalized_lagrange_basis_value);
+                                    }
+                                    instr = {opcode::lagrange_basis,
+                                             static_cast<std::size_t>(std::distance(lagrange_indices.begin(), it))};
+                                    break;
+                                }
+                                case token_type::Dup:
+                                    BOOST_ASSERT(depth > 0);
+                                    instr = {opcode::dup, 0};
+                                    break;
+                                case token_type::Pow:
+                                    BOOST_ASSERT(depth > 0);
+                                    instr = {opcode::pow, t.pow_value};
+                                    break;
+                                case token_type::Add:
+                                    BOOST_ASSERT(depth > 1);
+                                    instr = {opcode::add, 0};
+                                    break;
+                                case token_type::Mul:
+                                    BOOST_ASSERT(depth > 1);
+                                    instr = {opcode::mul, 0};
+                                    break;
+                                case token_type::Sub:
+                                    BOOST_ASSERT(depth > 1);
+                                    instr = {opcode::sub, 0};
+                                    break;
+                                case token_type::Store:
+                                    BOOST_ASSERT(depth > 0);
+                                    instr = {opcode::store, _cache_size++};
+                                    break;
+                                case token_type::Load:
+                                    instr = {opcode::load, t.load_value};
+                                    break;
+                                default:
+                                    BOOST_ASSERT_MSG(false, "unknown PolishToken");
+                                    continue;
+                            }
+
+                            switch (instr.op) {
+                                case opcode::add:
+                                case opcode::mul:
+                                case opcode::sub:
+                                    --depth;
+                                    break;
+                                case opcode::pow:
+                                case opcode::store:
+                                    break;
+                                default:
+                                    ++depth;
+                                    break;
+                            }
+                            _max_stack_depth = std::max(_max_stack_depth, depth);
+                            _instructions.push_back(instr);
+                        }
+
+                        BOOST_ASSERT(depth == 1);
+                        for (const auto &instr : _instructions) {
+                            BOOST_ASSERT(instr.op != opcode::load || instr.operand < _cache_size);
+                        }
+                    }
+
+                    /// Evaluates the program in ctx, using the stack and cache storage the context preallocated.
+                    value_type evaluate(const polish_evaluation_context<FieldType> &ctx) const {
+                        BOOST_ASSERT(ctx.stack.size() >= _max_stack_depth && ctx.cache.size() >= _cache_size);
+                        value_type *stack = ctx.stack.data();
+                        value_type *cache = ctx.cache.data();
+                        std::size_t top = 0;
+
+                        for (const auto &instr : _instructions) {
+                            switch (instr.op) {
+                                case opcode::constant:
+                                    stack[top++] = ctx.constants[instr.operand];
+                                    break;
+                                case opcode::literal:
+                                    stack[top++] = _literals[instr.operand];
+                                    break;
+                                case opcode::cell:
+                                    stack[top++] = ctx.cells[instr.operand];
+                                    break;
+                                case opcode::lagrange_basis:
+                                    stack[top++] = ctx.lagrange_basis[instr.operand];
+                                    break;
+                                case opcode::vanishes_on_last_4_rows:
+                                    stack[top++] = ctx.vanishes_on_last_4_rows;
+                                    break;
+                                case opcode::dup:
+                                    stack[top] = stack[top - 1];
+                                    ++top;
+                                    break;
+                                case opcode::pow:
+                                    stack[top - 1] = stack[top - 1].pow(instr.operand);
+                                    break;
+                                case opcode::add:
+                                    --top;
+                                    stack[top - 1] += stack[top];
+                                    break;
+                                case opcode::mul:
+                                    --top;
+                                    stack[top - 1] *= stack[top];
+                                    break;
+                                case opcode::sub:
+                                    --top;
+                                    stack[top - 1] -= stack[top];
+                                    break;
+                                case opcode::store:
+                                    cache[instr.operand] = stack[top - 1];
+                                    break;
+                                case opcode::load:
+                                    stack[top++] = cache[instr.operand];
+                                    break;
+                            }
+                        }
+
+                        return stack[0];
+                    }
+
+                    bool uses_vanishing_polynomial() const {
+                        return std::any_of(_instructions.begin(), _instructions.end(), [](const instruction &instr) {
+                            return instr.op == opcode::vanishes_on_last_4_rows;
+                        });
+                    }
+
+                    std::size_t size() const {
+                        return _instructions.size();
+                    }
+
+                    std::size_t max_stack_depth() const {
+                        return _max_stack_depth;
+                    }
+
+                    std::size_t cache_size() const {
+                        return _cache_size;
+                    }
+
+                private:
+                    std::vector<instruction> _instructions;
+                    std::vector<value_type> _literals;
+                    std::size_t _max_stack_depth;
+                    std::size_t _cache_size;
+                };
+
+                /// All programs of a verifier index linearization, compiled against a common cell layout.
+                template<typename FieldType>
+                class compiled_linearization {
+                public:
+                    typedef compiled_polish_program<FieldType> program_type;
+                    typedef Linearization<std::vector<PolishToken<FieldType>>> linearization_type;
+
+                    compiled_linearization() :
+                        _row_size(polish_cell_layout::LOOKUP_SORTED), _max_stack_depth(0), _max_cache_size(0),
+                        _uses_vanishing(false) {
+                    }
+
+                    explicit compiled_linearization(const linearization_type &linearization) :
+                        _max_stack_depth(0), _max_cache_size(0), _uses_vanishing(false) {
+                        std::size_t sorted_count = 0;
+                        auto count_sorted = [&sorted_count](const std::vector<PolishToken<FieldType>> &toks) {
+                            for (const auto &t : toks) {
+                                if (t.token == token_type::Cell && t.cell_value.col.column == column_type::LookupSorted) {
+                                    sorted_count = std::max(sorted_count, t.cell_value.col.lookup_sorted_value + 1);
+                                }
+                            }
+                        };
+                        count_sorted(linearization.constant_term);
+                        for (const auto &term : linearization.index_term) {
+                            count_sorted(std::get<1>(term));
+                        }
+                        _row_size = polish_cell_layout::LOOKUP_SORTED + sorted_count;
+
+                        _constant_term = program_type(linearization.constant_term, _row_size, _lagrange_indices);
+                        _uses_vanishing = _constant_term.uses_vanishing_polynomial();
+
+                        _index_terms.reserve(linearization.index_term.size());
+                        for (const auto &term : linearization.index_term) {
+                            _index_terms.emplace_back(std::get<0>(term),
+                                                      program_type(std::get<1>(term), _row_size, _lagrange_indices));
+                            _uses_vanishing = _uses_vanishing || std::get<1>(_index_terms.back()).uses_vanishing_polynomial();
+                        }
+
+                        _max_stack_depth = _constant_term.max_stack_depth();
+                        _max_cache_size = _constant_term.cache_size();
+                        for (const auto &term : _index_terms) {
+                            _max_stack_depth = std::max(_max_stack_depth, std::get<1>(term).max_stack_depth());
+                            _max_cache_size = std::max(_max_cache_size, std::get<1>(term).cache_size());
+                        }
+                    }
+
+                    const program_type &constant_term() const {
+                        return _constant_term;
+                    }
+
+                    const std::vector<std::tuple<Column, program_type>> &index_term() const {
+                        return _index_terms;
+                    }
+
+                    std::size_t row_size() const {
+                        return _row_size;
+                    }
+
+                    const std::vector<int> &lagrange_indices() const {
+                        return _lagrange_indices;
+                    }
+
+                    bool uses_vanishing_polynomial() const {
+                        return _uses_vanishing;
+                    }
+
+                    /// Largest stack depth and cache size over all programs, used to size evaluation contexts.
+                    std::size_t max_stack_depth() const {
+                        return _max_stack_depth;
+                    }
+
+                    std::size_t max_cache_size() const {
+                        return _max_cache_size;
+                    }
+
+                private:
+                    program_type _constant_term;
+                    std::vector<std::tuple<Column, program_type>> _index_terms;
+                    std::vector<int> _lagrange_indices;
+                    std::size_t _row_size;
+                    std::size_t _max_stack_depth;
+                    std::size_t _max_cache_size;
+                    bool _uses_vanishing;
+                };
+
+                /**
+                 * Compiled linearization kept alongside a verifier index. The programs are compiled on first use
+                 * and shared by every later proof verified against the index, including concurrent ones.
+                 * Copies start empty, so a copied index whose linearization is then modified never reads a stale
+                 * program; reset() must be called if the linearization of the owning index changes in place.
+                 */
+                template<typename FieldType>
+                class compiled_linearization_cache {
+                public:
+                    typedef compiled_linearization<FieldType> compiled_type;
+                    typedef typename compiled_type::linearization_type linearization_type;
+
+                    compiled_linearization_cache() = default;
+
+                    compiled_linearization_cache(const compiled_linearization_cache &) {
+                    }
+
+                    compiled_linearization_cache &operator=(const compiled_linearization_cache &other) {
+                        if (this != &other) {
+                            reset();
+                        }
+                        return *this;
+                    }
+
+                    const compiled_type &get(const linearization_type &linearization) const {
+                        std::lock_guard<std::mutex> lock(_mutex);
+                        if (!_compiled) {
+                            _compiled = std::make_shared<const compiled_type>(linearization);
+                        }
+                        return *_compiled;
+                    }
+
+                    void reset() {
+                        std::lock_guard<std::mutex> lock(_mutex);
+                        _compiled.reset();
+                    }
+
+                private:
+                    mutable std::mutex _mutex;
+                    mutable std::shared_ptr<const compiled_type> _compiled;
+                };
+
+                /// Everything the programs of one linearization read at one evaluation point.
+                template<typename FieldType>
+                class polish_evaluation_context {
+                public:
+                    typedef typename FieldType::value_type value_type;
+
+                    polish_evaluation_context(const compiled_linearization<FieldType> &linearization,
+                                              math::basic_radix2_domain<FieldType> &domain,
+                                              value_type pt,
+                                              const std::vector<proof_evaluation_type<value_type>> &evals,
+                                              const Constants<FieldType> &c) :
+                        constants(polish_constant_layout::SIZE),
+                        cells(evals.size() * linearization.row_size(), value_type::zero()),
+                        vanishes_on_last_4_rows(value_type::zero()),
+                        stack(linearization.max_stack_depth()),
+                        cache(linearization.max_cache_size()) {
+                        constants[polish_constant_layout::ALPHA] = c.alpha;
+                        constants[polish_constant_layout::BETA] = c.beta;
+                        constants[polish_constant_layout::GAMMA] = c.gamma;
+                        constants[polish_constant_layout::JOINT_COMBINER] = c.joint_combiner;
+                        constants[polish_constant_layout::ENDO_COEFFICIENT] = c.endo_coefficient;
+                        for (std::size_t i = 0; i < polish_constant_layout::MDS_WIDTH; ++i) {
+                            for (std::size_t j = 0; j < polish_constant_layout::MDS_WIDTH; ++j) {
+                                constants[polish_constant_layout::MDS + i * polish_constant_layout::MDS_WIDTH + j] =
+                                    c.mds[i][j];
+                            }
+                        }
+
+                        for (std::size_t row = 0; row < evals.size(); ++row) {
+                            const proof_evaluation_type<value_type> &e = evals[row];
+                            value_type *row_cells = cells.data() + row * linearization.row_size();
+
+                            std::copy(e.w.begin(), e.w.end(), row_cells + polish_cell_layout::WITNESS);
+                            row_cells[polish_cell_layout::Z] = e.z;
+                            row_cells[polish_cell_layout::GENERIC_SELECTOR] = e.generic_selector;
+                            row_cells[polish_cell_layout::POSEIDON_SELECTOR] = e.poseidon_selector;
+                            row_cells[polish_cell_layout::LOOKUP_AGGREG] = e.lookup.aggreg;
+                            row_cells[polish_cell_layout::LOOKUP_TABLE] = e.lookup.table;
+                            row_cells[polish_cell_layout::LOOKUP_RUNTIME] = e.lookup.runtime;
+                            std::size_t sorted_count = std::min(e.lookup.sorted.size(),
+                                                                linearization.row_size() - polish_cell_layout::LOOKUP_SORTED);
+                            std::copy(e.lookup.sorted.begin(), e.lookup.sorted.begin() + sorted_count,
+                                      row_cells + polish_cell_layout::LOOKUP_SORTED);
+                        }
+
+                        const std::vector<int> &indices = linearization.lagrange_indices();
+                        if (!indices.empty()) {
+                            // Z_H(pt) / (pt - omega^i) for every index, with a single inversion
+                            value_type vanishing = domain.compute_vanishing_polynomial(pt);
+                            lagrange_basis.resize(indices.size());
+                            for (std::size_t k = 0; k < indices.size(); ++k) {
+                                value_type omega_i = indices[k] < 0 ? domain.omega.pow(-indices[k]).inversed() :
+                                                                      domain.omega.pow(indices[k]);
+                                lagrange_basis[k] = pt - omega_i;
+                            }
+                            commitments::detail::batch_inverse(lagrange_basis);
+                            for (auto &l : lagrange_basis) {
+                                l *= vanishing;
+                            }
+                        }
+
+                        if (linearization.uses_vanishing_polynomial()) {
+                            vanishes_on_last_4_rows = eval_vanishes_on_last_4_rows(domain, pt);
+                        }
+                    }
+
+                    std::vector<value_type> constants;
+                    std::vector<value_type> cells;
+                    std::vector<value_type> lagrange_basis;
+                    value_type vanishes_on_last_4_rows;
+
+                    /// Scratch storage of compiled_polish_program::evaluate. A context must not be shared between
+                    /// threads.
+                    mutable std::vector<value_type> stack;
+                    mutable std::vector<value_type> cache;
+                };
+            }    // namespace snark
+        }        // namespace zk
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ZK_PLONK_BATCHED_PICKLES_COMPILED_EXPR_HPP
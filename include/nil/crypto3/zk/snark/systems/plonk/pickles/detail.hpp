@@ -137,11 +137,11 @@ namespace nil {
                     commitment_type runtime_tables_selector;
                     bool runtime_tables_selector_is_used;
                     
-                    static commitment_type combine_table(std::vector<commitment_type>& columns,
+                    static commitment_type combine_table(const std::vector<commitment_type>& columns,
                                             typename scalar_field_type::value_type column_combiner,
                                             typename scalar_field_type::value_type table_id_combiner,
-                                            commitment_type& table_id_vector, 
-                                            commitment_type& runtime_vector){
+                                            const commitment_type& table_id_vector, 
+                                            const commitment_type& runtime_vector){
                         typename scalar_field_type::value_type j = scalar_field_type::value_type::one();
                         std::vector<typename scalar_field_type::value_type> scalars;
                         std::vector<commitment_type> commitments;
@@ -73,8 +73,8 @@ namespace nil {
                 };
 
                 template<typename FieldType>
-                typename FieldType::value_type variable_evaluate(Variable& var, std::vector<proof_evaluation_type<typename FieldType::value_type>> &evals){
-                    proof_evaluation_type<typename FieldType::value_type> temp_eval = evals[var.row];
+                typename FieldType::value_type variable_evaluate(const Variable& var, const std::vector<proof_evaluation_type<typename FieldType::value_type>> &evals){
+                    const proof_evaluation_type<typename FieldType::value_type> &temp_eval = evals[var.row];
 
                     if(var.col.column == column_type::Witness){
                         return temp_eval.w[var.col.witness_value];
@@ -147,14 +147,14 @@ namespace nil {
 
                     PolishToken(token_type token, std::size_t value) : token(token), pow_value(value), load_value(value) {}
 
-                    PolishToken(int unnormalized_lagrange_basis_value) : token(token), 
+                    PolishToken(int unnormalized_lagrange_basis_value) : token(token_type::UnnormalizedLagrangeBasis), 
                             unnormalized_lagrange_basis_value(unnormalized_lagrange_basis_value) {} 
                     
-                    static typename FieldType::value_type evaluate(std::vector<PolishToken<FieldType>>& toks,
+                    static typename FieldType::value_type evaluate(const std::vector<PolishToken<FieldType>>& toks,
                                                             math::basic_radix2_domain<FieldType>& domain,
                                                             typename FieldType::value_type pt, 
-                                                            std::vector<proof_evaluation_type<typename FieldType::value_type>>& evals,
-                                                            Constants<FieldType>& c){
+                                                            const std::vector<proof_evaluation_type<typename FieldType::value_type>>& evals,
+                                                            const Constants<FieldType>& c){
                         std::vector<typename FieldType::value_type> stack, cache;
                         for(auto &t : toks){
                             if(t.token == token_type::Alpha){
@@ -31,6 +31,7 @@
 #include <nil/crypto3/zk/snark/systems/plonk/pickles/verifier_index.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/pickles/proof.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/pickles/expr.hpp>
+#include <nil/crypto3/zk/snark/systems/plonk/pickles/compiled_expr.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/pickles/constants.hpp>
 #include <nil/crypto3/zk/commitments/polynomial/kimchi_pedersen.hpp>
 
@@ -88,10 +89,10 @@ namespace nil {
 
                 template<typename CurveType, typename VerifierIndexType = verifier_index<CurveType>>
                 std::vector<std::vector<std::vector<typename CurveType::scalar_field_type::value_type>>> prev_chal_evals(
-                            proof_type<CurveType> proof,
-                            VerifierIndexType index,
-                            std::vector<typename CurveType::scalar_field_type::value_type> evaluation_points,
-                            std::array<typename CurveType::scalar_field_type::value_type, 2> powers_of_eval_points_for_chunks){
+                            const proof_type<CurveType> &proof,
+                            const VerifierIndexType &index,
+                            const std::vector<typename CurveType::scalar_field_type::value_type> &evaluation_points,
+                            const std::array<typename CurveType::scalar_field_type::value_type, 2> &powers_of_eval_points_for_chunks){
                     typedef commitments::kimchi_pedersen<CurveType> commitment_scheme;
                     typedef typename CurveType::scalar_field_type scalar_field_type; // Fr
                     typedef typename CurveType::base_field_type base_field_type; // Fq
@@ -136,11 +137,14 @@ namespace nil {
                     return prev_chal_evals;
                 }
 
-                /// This function runs the random oracle argument
+                /// This function runs the random oracle argument.
+                /// Neither the proof nor the index are modified, so one index may be shared by concurrent calls.
+                /// If the compiled index linearization is given, it is used instead of interpreting the tokens.
                 template<typename CurveType, typename EFqSponge, typename EFrSponge, typename VerifierIndexType = verifier_index<CurveType>>
-                OraclesResult<CurveType, EFqSponge> oracles(proof_type<CurveType> proof,
-                            VerifierIndexType index,
-                            typename commitments::kimchi_pedersen<CurveType>::commitment_type p_comm) {
+                OraclesResult<CurveType, EFqSponge> oracles(const proof_type<CurveType> &proof,
+                            const VerifierIndexType &index,
+                            const typename commitments::kimchi_pedersen<CurveType>::commitment_type &p_comm,
+                            const compiled_linearization<typename CurveType::scalar_field_type> *linearization = nullptr) {
                     typedef commitments::kimchi_pedersen<CurveType> commitment_scheme;
                     typedef typename commitment_scheme::commitment_type commitment_type;
                     typedef typename commitment_scheme::evaluation_type evaluation_type;
@@ -151,7 +155,9 @@ namespace nil {
                     //~
                     //~ We run the following algorithm:
                     //~
-                    size_t n = index.domain.size();
+                    // evaluation domain methods are not const, every call works on its own copy
+                    math::basic_radix2_domain<scalar_field_type> domain = index.domain;
+                    size_t n = domain.size();
 
                     //~typename CurveType::scalar_field_type; 1. Setup the Fq-Sponge.
                     EFqSponge fq_sponge;
@@ -245,7 +251,7 @@ namespace nil {
 
                     // prepare some often used values
                     typename scalar_field_type::value_type zeta1 = zeta.pow(n);
-                    typename scalar_field_type::value_type zetaw = zeta * index.domain.omega;
+                    typename scalar_field_type::value_type zetaw = zeta * domain.omega;
 
                     // retrieve ranges for the powers of alphas
 
@@ -260,7 +266,7 @@ namespace nil {
                     all_alphas.instantiate(alpha);
                     
                     for(int i = 0; i < proof.public_input.size(); ++i){
-                        w.push_back(w.back() * index.domain.omega);
+                        w.push_back(w.back() * domain.omega);
                     }
 
                     // compute Lagrange base evaluation denominators
@@ -284,7 +290,7 @@ namespace nil {
                     //~ 18. Evaluate the negated public polynomial (if present) at $\zeta$ and $\zeta\omega$.
                     //~     NOTE: this works only in the case when the poly segment size is not smaller than that of the
                     // domain.
-                    std::vector<std::vector<typename scalar_field_type::value_type>> p_eval;
+                    std::vector<std::vector<typename scalar_field_type::value_type>> p_eval(2);
                     if (!proof.public_input.empty()) {
                         typename scalar_field_type::value_type tmp;
                         std::size_t iter_size = std::min({proof.public_input.size(), zeta_minus_x.size(), w.size()});
@@ -293,12 +299,10 @@ namespace nil {
                             tmp -= proof.public_input[i] * zeta_minus_x[i] * w[i];
                         }
 
-                        typename scalar_field_type::value_type size_inv = typename scalar_field_type::value_type(index.domain.size()).inversed();
+                        typename scalar_field_type::value_type size_inv = typename scalar_field_type::value_type(n).inversed();
 
                         p_eval[0].push_back(tmp * (zeta1 - scalar_field_type::value_type::one()) * size_inv);
                         p_eval[1].push_back(tmp * (zetaw.pow(n) - scalar_field_type::value_type::one()) * size_inv);
-                    } else{
-                        p_eval.resize(2);
                     }
 
                     //~ 19. Absorb all the polynomial evaluations in $\zeta$ and $\zeta\omega$:
@@ -394,8 +398,13 @@ namespace nil {
 
                     Constants<scalar_field_type> cs{alpha, beta, gamma, std::get<1>(joint_combiner), index.endo, index.fr_sponge_params.mds};
 
-                    ft_eval0 -=
-                        PolishToken<scalar_field_type>::evaluate(index.linearization.constant_term, index.domain, zeta, evals, cs);
+                    if (linearization != nullptr) {
+                        ft_eval0 -= linearization->constant_term().evaluate(
+                            polish_evaluation_context<scalar_field_type>(*linearization, domain, zeta, evals, cs));
+                    } else {
+                        ft_eval0 -=
+                            PolishToken<scalar_field_type>::evaluate(index.linearization.constant_term, domain, zeta, evals, cs);
+                    }
 
 
                     std::vector<std::tuple<evaluation_type, int>> es;
@@ -85,7 +85,7 @@ namespace nil {
                 struct proof_evaluation_type<std::vector<value_type>> : base_proof_evaluation_type<std::vector<value_type>>{
                     using base_proof_evaluation_type<std::vector<value_type>>::base_proof_evaluation_type;
                     
-                    proof_evaluation_type<value_type> combine(value_type& pt){
+                    proof_evaluation_type<value_type> combine(const value_type& pt) const {
                         std::array<value_type, kimchi_constant::PERMUTES - 1> s_combined;
                         for(int i = 0; i < s_combined.size(); ++i){
                             math::polynomial<value_type> temp_polynomial(this->s[i].begin(), this->s[i].end());
@@ -32,6 +32,7 @@
 #include <nil/crypto3/zk/snark/systems/plonk/pickles/verifier_index.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/pickles/proof.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/pickles/oracles.hpp>
+#include <nil/crypto3/zk/snark/systems/plonk/pickles/compiled_expr.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/pickles/constants.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/pickles/detail/mapping.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/pickles/constraints.hpp>
@@ -40,6 +41,9 @@
 
 #include <nil/crypto3/math/polynomial/polynomial.hpp>
 
+#include <nil/actor/core/thread_pool.hpp>
+#include <nil/actor/core/parallelization_utils.hpp>
+
 #include <vector>
 #include <tuple>
 
@@ -61,11 +65,20 @@ namespace nil {
 
                     typedef typename commitment_scheme::sponge_type EFqSponge;
                     typedef transcript::DefaultFrSponge<CurveType> EFrSponge;
+                    typedef compiled_linearization<scalar_field_type> compiled_linearization_type;
 
                     constexpr static const std::size_t COLUMNS = kimchi_constant::COLUMNS;
                     constexpr static const std::size_t PERMUTES = kimchi_constant::PERMUTES;
 
-                    static batchproof_type to_batch(VerifierIndexType index, proof_type<CurveType> proof) {
+                    static batchproof_type to_batch(const VerifierIndexType &index, const proof_type<CurveType> &proof) {
+                        return to_batch(index, proof, index.compiled_linearization_program.get(index.linearization));
+                    }
+
+                    /// Partially verifies one proof. Neither the index nor the proof are copied or modified,
+                    /// so several proofs against the same index may be processed concurrently.
+                    /// linearization is the compiled form of index.linearization, shared by all proofs of a batch.
+                    static batchproof_type to_batch(const VerifierIndexType &index, const proof_type<CurveType> &proof,
+                                                    const compiled_linearization_type &linearization) {
                         //~
                         //~ #### Partial verification
                         //~
@@ -75,10 +88,12 @@ namespace nil {
                         //~
 
                         //~ 1. Commit to the negated public input polynomial.
-                        BOOST_ASSERT_MSG(index.srs.lagrange_bases.find(index.domain.size()) != index.srs.lagrange_bases.end(), "pre-computed committed lagrange bases not found");
-                        std::vector<typename group_type::value_type> lgr_comm = index.srs.lagrange_bases[index.domain.size()];    // calculate lgr_comm
-                        BOOST_ASSERT(lgr_comm.size() == 512);                          // ??
+                        auto lgr_comm_it = index.srs.lagrange_bases.find(index.domain.size());
+                        BOOST_ASSERT_MSG(lgr_comm_it != index.srs.lagrange_bases.end(), "pre-computed committed lagrange bases not found");
+                        const std::vector<typename group_type::value_type> &lgr_comm = lgr_comm_it->second;
+                        BOOST_ASSERT(lgr_comm.size() >= proof.public_input.size());
                         std::vector<commitment_type> com;
+                        com.reserve(proof.public_input.size());
 
                         for (size_t i = 0; i < proof.public_input.size(); ++i) {
                             std::vector<typename group_type::value_type> unshifted = {lgr_comm[i]};
@@ -87,14 +102,15 @@ namespace nil {
                         }
                         // std::vector<commitment_scheme> *com_ref = &com;
                         std::vector<typename scalar_field_type::value_type> elm;
-                        for (auto &i : proof.public_input) {
+                        elm.reserve(proof.public_input.size());
+                        for (const auto &i : proof.public_input) {
                             elm.push_back(-i);
                         }
 
                         commitment_type p_comm = commitment_type::multi_scalar_mul(com, elm);
 
                         //~ 2. Run the [Fiat-Shamir argument](#fiat-shamir-argument).
-                        OraclesResult<CurveType, EFqSponge> oracles_res = oracles<CurveType, EFqSponge, EFrSponge, VerifierIndexType>(proof, index, p_comm);
+                        OraclesResult<CurveType, EFqSponge> oracles_res = oracles<CurveType, EFqSponge, EFrSponge, VerifierIndexType>(proof, index, p_comm, &linearization);
                         //                        fq_sponge,
                         //                        oracles,
                         //                        all_alphas,
@@ -152,13 +168,16 @@ namespace nil {
                                                 index.fr_sponge_params.mds
                                             };
 
-                            for (auto i : index.linearization.index_term) {
-                                auto col = std::get<0>(i);
-                                auto tokens = std::get<1>(i);
+                            // evaluation domain methods are not const, so the shared index domain is copied
+                            math::basic_radix2_domain<scalar_field_type> domain = index.domain;
+                            const auto &l = proof.commitments.lookup;
+                            polish_evaluation_context<scalar_field_type> context(linearization, domain,
+                                                                                 oracles_res.oracles.zeta, evals, constants);
 
-                                auto scalar =
-                                    PolishToken<scalar_field_type>::evaluate(tokens, index.domain, oracles_res.oracles.zeta, evals, constants);
-                                auto l = proof.commitments.lookup;
+                            for (const auto &i : linearization.index_term()) {
+                                const auto &col = std::get<0>(i);
+
+                                auto scalar = std::get<1>(i).evaluate(context);
                                 if (col.column == column_type::Witness) {
                                     scalars.push_back(scalar);
                                     commitments.push_back(proof.commitments.w_comm[col.witness_value]);
@@ -261,7 +280,7 @@ namespace nil {
                         std::vector<evaluation_type> evaluations;
 
                         //~     - recursion
-                        for (auto i : oracles_res.polys) {
+                        for (const auto &i : oracles_res.polys) {
                             evaluations.emplace_back(std::get<0>(i), std::get<1>(i), -1);
                         }
 
@@ -274,20 +293,20 @@ namespace nil {
 
                         //~     - permutation commitment
                         std::vector<std::vector<typename scalar_field_type::value_type>> tmp_evals;
-                        for (auto &i : proof.evals) {
+                        for (const auto &i : proof.evals) {
                             tmp_evals.push_back(i.z);
                         }
                         evaluations.emplace_back(proof.commitments.z_comm, tmp_evals, -1);
 
                         //~     - index commitments that use the coefficients
                         tmp_evals.clear();
-                        for (auto i : proof.evals) {
+                        for (const auto &i : proof.evals) {
                             tmp_evals.push_back(i.generic_selector);
                         }
                         evaluations.emplace_back(index.generic_comm, tmp_evals, -1);
 
                         tmp_evals.clear();
-                        for (auto i : proof.evals) {
+                        for (const auto &i : proof.evals) {
                             tmp_evals.push_back(i.poseidon_selector);
                         }
                         evaluations.emplace_back(index.psm_comm, tmp_evals, -1);
@@ -366,24 +385,39 @@ namespace nil {
                     }
                 
                     static bool batch_verify(group_map<CurveType>& g_map,
-                                      proofs_type& proofs){
-                        std::vector<batchproof_type> batch;
-                        
-                        typename commitment_scheme::params_type &srs = std::get<0>(proofs.front()).srs;
-                        for(auto &[index, proof] : proofs){
-                            batch.push_back(to_batch(index, proof));
-                        }
+                                      const proofs_type& proofs){
+                        std::vector<batchproof_type> batch(proofs.size());
+
+                        // Partial verifications are independent, only the final opening check is batched
+                        parallel_for(0, proofs.size(), [&proofs, &batch](std::size_t i) {
+                            batch[i] = to_batch(std::get<0>(proofs[i]), std::get<1>(proofs[i]));
+                        }, ThreadPool::PoolLevel::HIGH);
+
+                        return commitment_scheme::verify_eval(std::get<0>(proofs.front()).srs, g_map, batch);
+                    }
+
+                    /// Verifies a batch of proofs produced for the same circuit.
+                    /// The index is shared by all partial verifications instead of being copied per proof.
+                    static bool batch_verify(group_map<CurveType>& g_map,
+                                      const VerifierIndexType &index,
+                                      const std::vector<proof_type<CurveType>>& proofs){
+                        std::vector<batchproof_type> batch(proofs.size());
+                        const compiled_linearization_type &linearization =
+                            index.compiled_linearization_program.get(index.linearization);
+
+                        parallel_for(0, proofs.size(), [&index, &proofs, &batch, &linearization](std::size_t i) {
+                            batch[i] = to_batch(index, proofs[i], linearization);
+                        }, ThreadPool::PoolLevel::HIGH);
 
-                        return commitment_scheme::verify_eval(srs, g_map, batch);
+                        return commitment_scheme::verify_eval(index.srs, g_map, batch);
                     }
 
                     static bool verify(group_map<CurveType> &g_map,
-                                VerifierIndexType &index, 
-                                proof_type<CurveType> &proof){
-                        proofs_type proofs;
-                        proofs.emplace_back(index, proof);
+                                const VerifierIndexType &index, 
+                                const proof_type<CurveType> &proof){
+                        std::vector<batchproof_type> batch = {to_batch(index, proof)};
 
-                        return batch_verify(g_map, proofs);
+                        return commitment_scheme::verify_eval(index.srs, g_map, batch);
                     }
                 };
             }    // namespace snark
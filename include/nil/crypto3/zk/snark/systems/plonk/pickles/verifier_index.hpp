@@ -34,6 +34,7 @@
 #include <nil/crypto3/zk/snark/systems/plonk/pickles/detail.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/pickles/constants.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/pickles/expr.hpp>
+#include <nil/crypto3/zk/snark/systems/plonk/pickles/compiled_expr.hpp>
 
 #include <nil/crypto3/math/domains/basic_radix2_domain.hpp>
 #include <nil/crypto3/math/polynomial/polynomial.hpp>
@@ -93,6 +94,8 @@ namespace nil {
                     lookup_verifier_index<CurveType> lookup_index;
                     bool lookup_index_is_used;
                     Linearization<std::vector<PolishToken<scalar_field_type>>> linearization;
+                    // compiled form of linearization, built by the first verification against this index
+                    compiled_linearization_cache<scalar_field_type> compiled_linearization_program;
                     //                    linearization;    // TODO:
                     //                    Linearization<Vec<PolishToken<scalar_field_value_type<G>>>>
                     Alphas<scalar_field_type> powers_of_alpha;
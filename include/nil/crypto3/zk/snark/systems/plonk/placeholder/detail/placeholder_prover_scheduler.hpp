@@ -0,0 +1,124 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+// @file Declaration of the scheduler used by the placeholder prover to overlap
+// transcript-independent work with the sequential rounds of the protocol.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_PLACEHOLDER_PROVER_SCHEDULER_HPP
+#define CRYPTO3_PLACEHOLDER_PROVER_SCHEDULER_HPP
+
+#include <chrono>
+#include <future>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace nil {
+    namespace crypto3 {
+        namespace zk {
+            namespace snark {
+                namespace detail {
+
+                    // Starts prover work that does not depend on the transcript in the background, and
+                    // records how long after the start of the proof every stage has finished. With overlap
+                    // disabled the same work runs in place, which gives the sequential prover.
+                    class placeholder_prover_scheduler {
+                    public:
+                        typedef std::chrono::high_resolution_clock clock_type;
+
+                        struct stage_latency {
+                            std::string name;
+                            // Time from the start of the proof to the end of the stage.
+                            std::chrono::microseconds latency;
+                            bool is_async;
+                        };
+
+                        explicit placeholder_prover_scheduler(bool overlap = true) :
+                            _start(clock_type::now()), _overlap(overlap) {
+                        }
+
+                        bool overlap() const {
+                            return _overlap;
+                        }
+
+                        void start() {
+                            std::lock_guard<std::mutex> lock(_mutex);
+                            _start = clock_type::now();
+                            _stages.clear();
+                        }
+
+                        // Runs f on its own thread. f may freely use both levels of the thread pool: posting
+                        // it to the pool instead could deadlock once f waits for nested tasks of the same level.
+                        // The returned future joins the thread when destroyed. Without overlap f runs before
+                        // run_async returns, and the future is ready.
+                        template<typename Function>
+                        auto run_async(const std::string &name, Function f) -> std::future<decltype(f())> {
+                            if (!_overlap) {
+                                std::promise<decltype(f())> result;
+                                result.set_value(f());
+                                stage_done(name);
+                                return result.get_future();
+                            }
+                            return std::async(std::launch::async, [this, name, f]() {
+                                auto result = f();
+                                stage_done(name, true);
+                                return result;
+                            });
+                        }
+
+                        void stage_done(const std::string &name, bool is_async = false) {
+                            auto end = clock_type::now();
+                            std::lock_guard<std::mutex> lock(_mutex);
+                            auto latency = std::chrono::duration_cast<std::chrono::microseconds>(end - _start);
+                            _stages.push_back({name, latency, is_async});
+                        }
+
+                        std::vector<stage_latency> stage_latencies() const {
+                            std::lock_guard<std::mutex> lock(_mutex);
+                            return _stages;
+                        }
+
+                        void print(std::ostream &os) const {
+                            for (const auto &stage : stage_latencies()) {
+                                os << stage.name << (stage.is_async ? " (async)" : "") << " done at: " << std::fixed
+                                   << std::setprecision(3) << stage.latency.count() / 1000.0 << " ms" << std::endl;
+                            }
+                        }
+
+                    private:
+                        mutable std::mutex _mutex;
+                        clock_type::time_point _start;
+                        std::vector<stage_latency> _stages;
+                        bool _overlap;
+                    };
+
+                }    // namespace detail
+            }        // namespace snark
+        }            // namespace zk
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_PLACEHOLDER_PROVER_SCHEDULER_HPP
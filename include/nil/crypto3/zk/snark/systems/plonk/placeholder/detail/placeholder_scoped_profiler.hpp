@@ -26,6 +26,12 @@
 #define CRYPTO3_PLACEHOLDER_SCOPED_PROFILER_HPP
 
 #include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <string>
 #include <unordered_map>
 
 namespace nil {
@@ -34,39 +40,52 @@ namespace nil {
             namespace snark {
                 namespace detail {
 
-                    // Measures execution time of a given function just once. Prints 
-                    // the time when leaving the function in which this class was created.
-                    class placeholder_scoped_profiler
-                    {
-                        public:
-                            inline placeholder_scoped_profiler(std::string name) 
-                                : start(std::chrono::high_resolution_clock::now())
-                                , name(name) {
-                            }
-                    
-                            inline ~placeholder_scoped_profiler() {
-                                auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
-                                                std::chrono::high_resolution_clock::now() - start);
-                                std::cout << name << ": " << std::fixed << std::setprecision(3)
-                                    << elapsed.count() << " ms" << std::endl;
-                            }
-                    
-                        private:
-                            std::chrono::time_point<std::chrono::high_resolution_clock> start;
-                            std::string name;
-                    };
-
                     class call_stats {
                         public:
+                            struct call_stat {
+                                uint64_t calls = 0;
+                                uint64_t nanoseconds = 0;
+                            };
+
                             // Make this class singleton.
                             static call_stats& get_stats() {
                                 static call_stats instance;
                                 return instance;
                             }
 
-                            void add_stat(const std::string& name, uint64_t time_ms) {
+                            void add_stat(const std::string& name, uint64_t time_ns) {
+                                std::lock_guard<std::mutex> lock(mutex);
                                 call_counts[name]++;
-                                call_miliseconds[name] += time_ms;
+                                call_miliseconds[name] += time_ns;
+                            }
+
+                            // Accumulates a unit of work, e.g. a number of skipped FFTs.
+                            void add_count(const std::string& name, uint64_t value) {
+                                std::lock_guard<std::mutex> lock(mutex);
+                                counters[name] += value;
+                            }
+
+                            // Snapshot of the timings collected so far, sorted by name.
+                            std::map<std::string, call_stat> get_call_stats() const {
+                                std::lock_guard<std::mutex> lock(mutex);
+                                std::map<std::string, call_stat> result;
+                                for (const auto& [name, count]: call_counts) {
+                                    result[name] = {count, call_miliseconds.at(name)};
+                                }
+                                return result;
+                            }
+
+                            std::map<std::string, uint64_t> get_counters() const {
+                                std::lock_guard<std::mutex> lock(mutex);
+                                return std::map<std::string, uint64_t>(counters.begin(), counters.end());
+                            }
+
+                            // Drops everything collected so far, e.g. between the stages of a benchmark.
+                            void reset() {
+                                std::lock_guard<std::mutex> lock(mutex);
+                                call_counts.clear();
+                                call_miliseconds.clear();
+                                counters.clear();
                             }
 
                         private:
@@ -78,10 +97,39 @@ namespace nil {
                                         << miliseconds / 1000 << " sec " 
                                         << miliseconds % 1000 << " ms" << std::endl;
                                 }
+                                for (const auto& [name, value]: counters) {
+                                    std::cout << name << ": " << value << std::endl;
+                                }
                             }
 
+                            mutable std::mutex mutex;
                             std::unordered_map<std::string, uint64_t> call_counts;
                             std::unordered_map<std::string, uint64_t> call_miliseconds;
+                            std::unordered_map<std::string, uint64_t> counters;
+                    };
+
+                    // Measures execution time of a given function just once. Prints 
+                    // the time when leaving the function in which this class was created,
+                    // and adds it to call_stats, so benchmarks can collect it.
+                    class placeholder_scoped_profiler
+                    {
+                        public:
+                            inline placeholder_scoped_profiler(std::string name) 
+                                : start(std::chrono::high_resolution_clock::now())
+                                , name(name) {
+                            }
+                    
+                            inline ~placeholder_scoped_profiler() {
+                                auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                                std::chrono::high_resolution_clock::now() - start);
+                                call_stats::get_stats().add_stat(name, elapsed.count());
+                                std::cout << name << ": " << std::fixed << std::setprecision(3)
+                                    << elapsed.count() / 1000000 << " ms" << std::endl;
+                            }
+                    
+                        private:
+                            std::chrono::time_point<std::chrono::high_resolution_clock> start;
+                            std::string name;
                     };
 
                     // Measures the total execution time of the functions it's placed in, and the number of calls.
@@ -125,4 +173,11 @@ namespace nil {
     #define PROFILE_PLACEHOLDER_FUNCTION_CALLS() 
 #endif
 
+#ifdef ZK_PLACEHOLDER_PROFILING_ENABLED
+    #define PROFILE_PLACEHOLDER_COUNTER(name, value) \
+        nil::crypto3::zk::snark::detail::call_stats::get_stats().add_count(name, value);
+#else
+    #define PROFILE_PLACEHOLDER_COUNTER(name, value)
+#endif
+
 #endif    // CRYPTO3_PLACEHOLDER_SCOPED_PROFILER_HPP
@@ -33,6 +33,7 @@
 
 #include <nil/crypto3/zk/snark/arithmetization/plonk/table_description.hpp>
 #include <nil/crypto3/zk/snark/arithmetization/plonk/constraint_system.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/plonk/detail/constraint_system_digest.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/params.hpp>
 #include <nil/crypto3/zk/snark/arithmetization/plonk/constraint_system.hpp>
 
@@ -126,16 +127,12 @@ namespace nil {
                         nil::marshalling::status_type status = filled_context.write(write_iter, cv.size());
                         BOOST_ASSERT(status == nil::marshalling::status_type::success);
 
-                        // Append constraint_system to the buffer "cv".
+                        // Append the structural digest of constraint_system to the buffer "cv". Subexpressions
+                        // shared after hash-consing are hashed once, instead of marshalling every expression tree.
                         using FieldType = typename PlaceholderParamsType::field_type;
-                        using ConstraintSystem = plonk_constraint_system<FieldType>;
 
-                        auto filled_constraint_system = nil::crypto3::marshalling::types::fill_plonk_constraint_system<Endianness, ConstraintSystem>(constraint_system);
-                        cv.resize(filled_context.length() + filled_constraint_system.length(), 0x00);
-
-                        // Function write wants an lvalue as 1st parameter.
-                        write_iter = cv.begin() + filled_context.length();
-                        filled_constraint_system.write(write_iter, filled_constraint_system.length());
+                        auto cs_digest = constraint_system_digest<FieldType>(constraint_system);
+                        cv.insert(cv.end(), cs_digest.begin(), cs_digest.end());
 
                         // Return hash of "cv", which contains concatenated constraint system and other initialization parameters.
                         return hash<transcript_hash_type>(
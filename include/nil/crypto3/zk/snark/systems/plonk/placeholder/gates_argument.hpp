@@ -28,9 +28,13 @@
 #ifndef CRYPTO3_ZK_PLONK_PLACEHOLDER_GATES_ARGUMENT_HPP
 #define CRYPTO3_ZK_PLONK_PLACEHOLDER_GATES_ARGUMENT_HPP
 
+#include <map>
 #include <unordered_map>
+#include <unordered_set>
 #include <iostream>
 #include <memory>
+#include <utility>
+#include <vector>
 
 #include <nil/crypto3/math/polynomial/polynomial.hpp>
 #include <nil/crypto3/math/polynomial/shift.hpp>
@@ -47,10 +51,13 @@
 #include <nil/crypto3/zk/snark/arithmetization/plonk/constraint_system.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/params.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/detail/placeholder_policy.hpp>
+#include <nil/crypto3/zk/snark/systems/plonk/placeholder/detail/placeholder_scoped_profiler.hpp>
 #include <nil/crypto3/zk/snark/arithmetization/plonk/constraint.hpp>
 #include <nil/crypto3/zk/math/expression.hpp>
 #include <nil/crypto3/zk/math/expression_evaluator.hpp>
 #include <nil/crypto3/zk/math/expression_visitors.hpp>
+#include <nil/crypto3/zk/math/rowwise_expression_evaluator.hpp>
+#include <nil/crypto3/zk/math/shifted_polynomial_dfs.hpp>
 
 #include <nil/actor/core/thread_pool.hpp>
 #include <nil/actor/core/parallelization_utils.hpp>
@@ -76,37 +83,34 @@ namespace nil {
 
                     constexpr static const std::size_t argument_size = 1;
 
+                    typedef std::unordered_map<polynomial_dfs_variable_type, polynomial_dfs_type> variable_values_type;
+                    // Column values keyed by the size of the extended domain they were resized to.
+                    typedef std::map<std::uint32_t, variable_values_type> prepared_variable_values_type;
+
                     static inline void build_variable_value_map(
-                        const math::expression<polynomial_dfs_variable_type>& expr,
+                        const std::vector<polynomial_dfs_variable_type>& variables,
                         const plonk_polynomial_dfs_table<FieldType> &assignments,
                         std::shared_ptr<math::evaluation_domain<FieldType>> domain,
                         std::size_t extended_domain_size,
-                        std::unordered_map<polynomial_dfs_variable_type, polynomial_dfs_type>& variable_values_out) {
-
-                        std::unordered_map<polynomial_dfs_variable_type, size_t> variable_counts;
-
-                        std::vector<polynomial_dfs_variable_type> variables;
-
-                        math::expression_for_each_variable_visitor<polynomial_dfs_variable_type> visitor(
-                            [&variable_counts, &variables, &variable_values_out](const polynomial_dfs_variable_type& var) {
-                                // Create the structure of the map so we can change the values later.
-                                if (variable_counts[var] == 0) {
-                                    variables.push_back(var);
-                                    // Create the structure of the map, so its values can be filled in parallel.
-                                    if (variable_values_out.find(var) == variable_values_out.end()) {
-                                        variable_values_out[var] = polynomial_dfs_type();
-                                    }
-                                }
-                                variable_counts[var]++;
-                        });
+                        variable_values_type& variable_values_out) {
+
+                        // Only unrotated columns are extended, rotations are read from them by get_variable_view.
+                        std::vector<polynomial_dfs_variable_type> columns;
+                        for (const auto& var : variables) {
+                            polynomial_dfs_variable_type column = unrotated(var);
+                            // Create the structure of the map, so its values can be filled in parallel.
+                            if (variable_values_out.find(column) == variable_values_out.end()) {
+                                variable_values_out[column] = polynomial_dfs_type();
+                                columns.push_back(column);
+                            }
+                        }
 
                         std::shared_ptr<math::evaluation_domain<FieldType>> extended_domain =
                             math::make_evaluation_domain<FieldType>(extended_domain_size);
-                        visitor.visit(expr);
 
-                        parallel_for(0, variables.size(),
-                            [&variables, &variable_values_out, &assignments, &domain, &extended_domain, extended_domain_size](std::size_t i) {
-                                const auto& var = variables[i];
+                        parallel_for(0, columns.size(),
+                            [&columns, &variable_values_out, &assignments, &domain, &extended_domain, extended_domain_size](std::size_t i) {
+                                const auto& var = columns[i];
                                 // We may have variable values in required sizes in some cases.
                                 if (variable_values_out[var].size() == extended_domain_size)
                                     return;
@@ -130,9 +134,6 @@ namespace nil {
                                         break;
                                 }
 
-                                if (var.rotation != 0) {
-                                    assignment = math::polynomial_shift(assignment, var.rotation, domain->m);
-                                }
                                 // In parallel version we always resize the assignment poly, it's better to parallelization.
                                 // if (count > 1) {
                                 assignment.resize(extended_domain_size, domain, extended_domain);
@@ -140,6 +141,157 @@ namespace nil {
                             }, ThreadPool::PoolLevel::HIGH);
                     }
 
+                    // active_selectors[i] is false iff selector i is zero on every row of the basic domain.
+                    typedef std::vector<bool> active_selectors_type;
+
+                    /**
+                     * A selector which is zero on every row of the basic domain is the zero polynomial, so its
+                     * gate adds nothing to F and neither needs its columns extended nor its constraints evaluated.
+                     * Only such gates are skipped: a selector which is non-zero on some row has a dense extension
+                     * on the extended domain, so its gate is evaluated on every point there.
+                     */
+                    static inline bool is_gate_active(const active_selectors_type *active_selectors,
+                                                      std::size_t selector_index) {
+                        return active_selectors == nullptr || selector_index >= active_selectors->size() ||
+                               (*active_selectors)[selector_index];
+                    }
+
+                    static inline polynomial_dfs_variable_type unrotated(const polynomial_dfs_variable_type &var) {
+                        return polynomial_dfs_variable_type(var.index, 0, var.relative, var.type);
+                    }
+
+                    /**
+                     * Value of var on the extended domain. A rotation by r on the basic domain is an index shift by
+                     * r * extended_domain_size / basic_domain_size of the unrotated extension, so rotated columns are
+                     * read from it at an offset instead of being shifted, extended or copied on their own.
+                     */
+                    static inline math::shifted_polynomial_dfs_view<typename FieldType::value_type> get_variable_view(
+                        variable_values_type &variable_values,
+                        const polynomial_dfs_variable_type &var,
+                        std::size_t basic_domain_size) {
+                        return math::shifted_polynomial_dfs_view<typename FieldType::value_type>(
+                            variable_values[unrotated(var)], var.rotation, basic_domain_size);
+                    }
+
+                    static inline void build_variable_value_map(
+                        const math::expression<polynomial_dfs_variable_type>& expr,
+                        const plonk_polynomial_dfs_table<FieldType> &assignments,
+                        std::shared_ptr<math::evaluation_domain<FieldType>> domain,
+                        std::size_t extended_domain_size,
+                        variable_values_type& variable_values_out) {
+
+                        std::unordered_map<polynomial_dfs_variable_type, size_t> variable_counts;
+
+                        std::vector<polynomial_dfs_variable_type> variables;
+
+                        math::expression_for_each_variable_visitor<polynomial_dfs_variable_type> visitor(
+                            [&variable_counts, &variables](const polynomial_dfs_variable_type& var) {
+                                if (variable_counts[var] == 0) {
+                                    variables.push_back(var);
+                                }
+                                variable_counts[var]++;
+                        });
+                        visitor.visit(expr);
+
+                        build_variable_value_map(variables, assignments, domain, extended_domain_size, variable_values_out);
+                    }
+
+                    /**
+                     * Computes the sizes of the extended domains the gate constraints are evaluated on, together
+                     * with the maximal constraint degree each of them can hold.
+                     * max_gates_degree must already account for the selector multiplication.
+                     */
+                    static inline void get_extended_domains(
+                            std::size_t original_domain_size,
+                            std::uint32_t max_gates_degree,
+                            std::vector<std::uint32_t> &extended_domain_sizes,
+                            std::vector<std::uint32_t> &degree_limits) {
+                        std::uint32_t max_degree = std::pow(2, ceil(std::log2(max_gates_degree)));
+                        std::uint32_t max_domain_size = original_domain_size * max_degree;
+
+                        degree_limits.push_back(max_degree);
+                        extended_domain_sizes.push_back(max_domain_size);
+                        degree_limits.push_back(max_degree / 2);
+                        extended_domain_sizes.push_back(max_domain_size / 2);
+                    }
+
+                    static inline std::size_t get_extended_domain_index(
+                            const std::vector<std::uint32_t> &degree_limits, std::size_t constraint_degree) {
+                        for (int i = degree_limits.size() - 1; i > 0; --i) {
+                            // Whatever the degree of term is, add it to the maximal degree expression.
+                            if (degree_limits[i] >= constraint_degree) {
+                                return i;
+                            }
+                        }
+                        return 0;
+                    }
+
+                    /**
+                     * Shifts and extends every column used by the gates to the domains prove_eval evaluates the
+                     * constraints on. None of this depends on the transcript, so the prover runs it in the
+                     * background while the permutation and lookup rounds are in progress.
+                     */
+                    static inline prepared_variable_values_type prepare_variable_values(
+                            const typename policy_type::constraint_system_type &constraint_system,
+                            const plonk_polynomial_dfs_table<FieldType> &column_polynomials,
+                            std::shared_ptr<math::evaluation_domain<FieldType>> original_domain,
+                            std::uint32_t max_gates_degree,
+                            const active_selectors_type *active_selectors = nullptr) {
+                        PROFILE_PLACEHOLDER_SCOPE("gate_argument_prepare_variable_values_time");
+
+                        // +1 stands for the selector multiplication.
+                        ++max_gates_degree;
+
+                        std::vector<std::uint32_t> extended_domain_sizes;
+                        std::vector<std::uint32_t> degree_limits;
+                        get_extended_domains(original_domain->m, max_gates_degree, extended_domain_sizes, degree_limits);
+
+                        std::vector<std::vector<polynomial_dfs_variable_type>> variables(extended_domain_sizes.size());
+                        std::vector<std::unordered_set<polynomial_dfs_variable_type>> known_variables(
+                            extended_domain_sizes.size());
+
+                        auto add_variable = [&variables, &known_variables](
+                                std::size_t i, const polynomial_dfs_variable_type &var) {
+                            if (known_variables[i].insert(var).second) {
+                                variables[i].push_back(var);
+                            }
+                        };
+
+                        math::expression_max_degree_visitor<variable_type> degree_visitor;
+
+                        for (const auto& gate: constraint_system.gates()) {
+                            if (!is_gate_active(active_selectors, gate.selector_index)) {
+                                continue;
+                            }
+                            for (const auto& constraint : gate.constraints) {
+                                std::size_t i = get_extended_domain_index(
+                                    degree_limits, degree_visitor.compute_max_degree(constraint) + 1);
+
+                                math::expression_for_each_variable_visitor<variable_type> visitor(
+                                    [&add_variable, i](const variable_type& var) {
+                                        add_variable(i, polynomial_dfs_variable_type(
+                                            var.index, var.rotation, var.relative,
+                                            static_cast<typename polynomial_dfs_variable_type::column_type>(
+                                                static_cast<std::uint8_t>(var.type))));
+                                });
+                                visitor.visit(constraint);
+                            }
+
+                            // prove_eval multiplies every partial gate result by the selector.
+                            for (std::size_t i = 0; i < extended_domain_sizes.size(); ++i) {
+                                add_variable(i, polynomial_dfs_variable_type(
+                                    gate.selector_index, 0, false, polynomial_dfs_variable_type::column_type::selector));
+                            }
+                        }
+
+                        prepared_variable_values_type prepared_variable_values;
+                        for (std::size_t i = 0; i < extended_domain_sizes.size(); ++i) {
+                            build_variable_value_map(variables[i], column_polynomials, original_domain,
+                                extended_domain_sizes[i], prepared_variable_values[extended_domain_sizes[i]]);
+                        }
+                        return prepared_variable_values;
+                    }
+
                     static inline std::array<polynomial_dfs_type, argument_size>
                         prove_eval(
                             const typename policy_type::constraint_system_type &constraint_system,
@@ -148,7 +300,9 @@ namespace nil {
                             std::shared_ptr<math::evaluation_domain<FieldType>> original_domain,
                             std::uint32_t max_gates_degree,
                             const polynomial_dfs_type &mask_polynomial,
-                            transcript_type& transcript) {
+                            transcript_type& transcript,
+                            prepared_variable_values_type prepared_variable_values = {},
+                            const active_selectors_type *active_selectors = nullptr) {
                         PROFILE_PLACEHOLDER_SCOPE("gate_argument_time");
 
                         // max_gates_degree that comes from the outside does not take into account multiplication
@@ -163,13 +317,7 @@ namespace nil {
 
                         std::vector<std::uint32_t> extended_domain_sizes;
                         std::vector<std::uint32_t> degree_limits;
-                        std::uint32_t max_degree = std::pow(2, ceil(std::log2(max_gates_degree)));
-                        std::uint32_t max_domain_size = original_domain->m * max_degree;
-
-                        degree_limits.push_back(max_degree);
-                        extended_domain_sizes.push_back(max_domain_size);
-                        degree_limits.push_back(max_degree / 2);
-                        extended_domain_sizes.push_back(max_domain_size / 2);
+                        get_extended_domains(original_domain->m, max_gates_degree, extended_domain_sizes, degree_limits);
 
                         std::vector<math::expression<polynomial_dfs_variable_type>> expressions(extended_domain_sizes.size());
 
@@ -186,6 +334,14 @@ namespace nil {
                         const auto& gates = constraint_system.gates();
 
                         for (const auto& gate: gates) {
+                            if (!is_gate_active(active_selectors, gate.selector_index)) {
+                                // Keep the powers of theta of the remaining gates unchanged.
+                                for (std::size_t j = 0; j < gate.constraints.size(); ++j) {
+                                    theta_acc *= theta;
+                                }
+                                PROFILE_PLACEHOLDER_COUNTER("Gates argument, skipped constraints", gate.constraints.size());
+                                continue;
+                            }
                             std::vector<math::expression<polynomial_dfs_variable_type>> gate_results(extended_domain_sizes.size());
 
                             for (const auto& constraint : gate.constraints) {
@@ -194,13 +350,7 @@ namespace nil {
                                 theta_acc *= theta;
                                 // +1 stands for the selector multiplication.
                                 size_t constraint_degree = visitor.compute_max_degree(constraint) + 1;
-                                for (int i = extended_domain_sizes.size() - 1; i >= 0; --i) {
-                                    // Whatever the degree of term is, add it to the maximal degree expression.
-                                    if (degree_limits[i] >= constraint_degree || i == 0) {
-                                        gate_results[i] += next_term;
-                                        break;
-                                    }
-                                }
+                                gate_results[get_extended_domain_index(degree_limits, constraint_degree)] += next_term;
                             }
 
                             auto selector = polynomial_dfs_variable_type(
@@ -212,22 +362,31 @@ namespace nil {
                             }
                         }
 
-                        std::unordered_map<polynomial_dfs_variable_type, polynomial_dfs_type> variable_values;
                         std::array<polynomial_dfs_type, argument_size> F;
 
                         for (size_t i = 0; i < extended_domain_sizes.size(); ++i) {
-                            if (i != 0 && extended_domain_sizes[i] != extended_domain_sizes[i-1]) {
-                                variable_values.clear();
-                            }
+                            // Columns already prepared by the caller are reused, the missing ones are extended here.
+                            variable_values_type &variable_values = prepared_variable_values[extended_domain_sizes[i]];
                             build_variable_value_map(expressions[i], column_polynomials, original_domain,
                                 extended_domain_sizes[i], variable_values);
 
-                            math::cached_expression_evaluator<polynomial_dfs_variable_type> evaluator(
-                                expressions[i], [&assignments=variable_values, domain_size=extended_domain_sizes[i]](const polynomial_dfs_variable_type &var) {
-                                return assignments[var];
-                            });
+                            // The extended domain holds every constraint of this expression, so it is evaluated
+                            // point by point, reading rotated columns at an offset.
+                            if (!expressions[i].is_empty()) {
+                                math::rowwise_expression_evaluator<polynomial_dfs_variable_type> evaluator(
+                                    expressions[i], extended_domain_sizes[i],
+                                    [&assignments=variable_values, basic_domain_size=original_domain->m](
+                                            const polynomial_dfs_variable_type &var) {
+                                    return get_variable_view(assignments, var, basic_domain_size);
+                                });
+
+                                F[0] += evaluator.evaluate();
+                            }
 
-                            F[0] += evaluator.evaluate();
+                            if (i + 1 == extended_domain_sizes.size() ||
+                                    extended_domain_sizes[i + 1] != extended_domain_sizes[i]) {
+                                prepared_variable_values.erase(extended_domain_sizes[i]);
+                            }
                         }
 
                         F[0] *= mask_polynomial;
@@ -30,7 +30,11 @@
 #ifndef CRYPTO3_ZK_PLONK_PLACEHOLDER_LOOKUP_ARGUMENT_HPP
 #define CRYPTO3_ZK_PLONK_PLACEHOLDER_LOOKUP_ARGUMENT_HPP
 
+#include <map>
 #include <unordered_map>
+#include <unordered_set>
+#include <tuple>
+#include <utility>
 
 #include <nil/crypto3/math/polynomial/polynomial.hpp>
 #include <nil/crypto3/math/polynomial/shift.hpp>
@@ -42,7 +46,10 @@
 #include <nil/crypto3/container/merkle/tree.hpp>
 
 #include <nil/crypto3/zk/transcript/fiat_shamir.hpp>
+#include <nil/crypto3/zk/math/rowwise_expression_evaluator.hpp>
+#include <nil/crypto3/zk/math/shifted_polynomial_dfs.hpp>
 #include <nil/crypto3/zk/snark/arithmetization/plonk/lookup_constraint.hpp>
+#include <nil/crypto3/zk/snark/systems/plonk/placeholder/gates_argument.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/params.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/detail/placeholder_policy.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/preprocessor.hpp>
@@ -122,6 +129,9 @@ namespace nil {
                     static constexpr std::size_t argument_size = 4;
 
                     typedef detail::placeholder_policy<FieldType, ParamsType> policy_type;
+                    typedef placeholder_gates_argument<FieldType, ParamsType> gates_argument_type;
+                    typedef typename placeholder_public_preprocessor<FieldType, ParamsType>::preprocessed_data_type
+                        preprocessed_data_type;
 
                 public:
 
@@ -130,6 +140,12 @@ namespace nil {
                         typename commitment_scheme_type::commitment_type lookup_commitment;
                     };
 
+                    typedef typename gates_argument_type::variable_values_type column_values_type;
+                    // Unrotated columns used by the lookup inputs and values, keyed by the size of the extended
+                    // domain they were resized to.
+                    typedef typename gates_argument_type::prepared_variable_values_type extended_columns_type;
+                    typedef std::unique_ptr<std::vector<polynomial_dfs_type>> lookup_columns_ptr_type;
+
                     placeholder_lookup_argument_prover(
                             const plonk_constraint_system<FieldType>
                                 &constraint_system,
@@ -138,7 +154,8 @@ namespace nil {
                             const plonk_polynomial_dfs_table<FieldType>
                                 &plonk_columns,
                             commitment_scheme_type &commitment_scheme,
-                            transcript_type &transcript)
+                            transcript_type &transcript,
+                            extended_columns_type extended_columns = {})
                         : constraint_system(constraint_system)
                         , preprocessed_data(preprocessed_data)
                         , plonk_columns(plonk_columns)
@@ -148,11 +165,39 @@ namespace nil {
                         , lookup_gates(constraint_system.lookup_gates())
                         , lookup_tables(constraint_system.lookup_tables())
                         , lookup_chunks(0)
+                        , extended_columns(std::move(extended_columns))
                     {
                         // $/theta = \challenge$
                         theta = transcript.template challenge<FieldType>();
                     }
 
+                    /**
+                     * Extends every column used by the lookup inputs and values to the domains
+                     * prepare_lookup_columns builds them on. None of this depends on the transcript, so the
+                     * prover runs it in the background during the permutation round.
+                     */
+                    static extended_columns_type prepare_extended_columns(
+                            const plonk_constraint_system<FieldType> &constraint_system,
+                            const preprocessed_data_type &preprocessed_data,
+                            const plonk_polynomial_dfs_table<FieldType> &plonk_columns) {
+                        PROFILE_PLACEHOLDER_SCOPE("Lookup argument column extensions");
+
+                        std::shared_ptr<math::evaluation_domain<FieldType>> basic_domain =
+                            preprocessed_data.common_data.basic_domain;
+                        std::vector<std::size_t> input_sizes;
+                        std::vector<std::size_t> value_sizes;
+                        std::map<std::uint32_t, std::vector<DfsVariableType>> columns = get_lookup_columns(
+                            constraint_system, plonk_columns, basic_domain->m,
+                            get_mask_assignment(preprocessed_data).degree(), input_sizes, value_sizes);
+
+                        extended_columns_type extended_columns;
+                        for (const auto &[size, variables] : columns) {
+                            gates_argument_type::build_variable_value_map(
+                                variables, plonk_columns, basic_domain, size, extended_columns[size]);
+                        }
+                        return extended_columns;
+                    }
+
                     prover_lookup_result prove_eval() {
                         PROFILE_PLACEHOLDER_SCOPE("Lookup argument prove eval time");
 
@@ -162,14 +207,12 @@ namespace nil {
                         math::polynomial_dfs<typename FieldType::value_type> zero_polynomial(
                             0, basic_domain->m, FieldType::value_type::zero());
                         math::polynomial_dfs<typename FieldType::value_type> mask_assignment =
-                            one_polynomial -  preprocessed_data.q_last - preprocessed_data.q_blind;
+                            get_mask_assignment(preprocessed_data);
 
-                        std::unique_ptr<std::vector<math::polynomial_dfs<typename FieldType::value_type>>> lookup_value_ptr =
-                            prepare_lookup_value(mask_assignment);
+                        lookup_columns_ptr_type lookup_input_ptr;
+                        lookup_columns_ptr_type lookup_value_ptr;
+                        std::tie(lookup_input_ptr, lookup_value_ptr) = prepare_lookup_columns(mask_assignment);
                         auto& lookup_value = *lookup_value_ptr;
-
-                        std::unique_ptr<std::vector<math::polynomial_dfs<typename FieldType::value_type>>> lookup_input_ptr =
-                            prepare_lookup_input();
                         auto& lookup_input = *lookup_input_ptr;
 
                         // 3. Lookup_input and lookup_value are ready
@@ -229,9 +272,6 @@ namespace nil {
                             sorted, beta, gamma, part_sizes
                         );
 
-                        math::polynomial_dfs<typename FieldType::value_type> V_L_shifted =
-                            math::polynomial_shift(V_L, 1, basic_domain->m);
-
                         std::array<math::polynomial_dfs<typename FieldType::value_type>, argument_size> F_dfs;
 
                         F_dfs[0] = preprocessed_data.common_data.lagrange_0 * (one_polynomial - V_L);
@@ -243,8 +283,12 @@ namespace nil {
                         if( part_sizes.size() == 1 ){
                             auto &g = gs[0];
                             auto &h = hs[0];
-                            g *= V_L;
-                            h *= V_L_shifted;
+                            // Extend V_L once, its shift is a rotation of the extended values.
+                            math::polynomial_dfs<typename FieldType::value_type> V_L_extended = V_L;
+                            V_L_extended.resize(h.size());
+                            h *= math::extended_polynomial_shift(V_L_extended, 1, basic_domain->m);
+                            g *= V_L_extended;
+                            V_L_extended = math::polynomial_dfs<typename FieldType::value_type>();
                             g -= h;
                             h = math::polynomial_dfs<typename FieldType::value_type>(); // just clean the memory of h.
                             g *= (preprocessed_data.q_last + preprocessed_data.q_blind) - one_polynomial;
@@ -276,6 +320,8 @@ namespace nil {
                             std::size_t last = lookup_alphas.size();
                             auto &g = gs[last];
                             auto &h = hs[last];
+                            math::polynomial_dfs<typename FieldType::value_type> V_L_shifted =
+                                math::polynomial_shift(V_L, 1, basic_domain->m);
                             F_dfs[2] += (previous_poly * g - V_L_shifted * h);
                             F_dfs[2] *= (preprocessed_data.q_last + preprocessed_data.q_blind) - one_polynomial;
                         }
@@ -457,26 +503,7 @@ namespace nil {
 
                         auto get_var_value = [&domain=basic_domain, &assignments=plonk_columns]
                         (const DfsVariableType &var) {
-                            polynomial_dfs_type assignment;
-                            switch (var.type) {
-                                case DfsVariableType::column_type::witness:
-                                    assignment = assignments.witness(var.index);
-                                    break;
-                                case DfsVariableType::column_type::public_input:
-                                    assignment = assignments.public_input(var.index);
-                                    break;
-                                case DfsVariableType::column_type::constant:
-                                    assignment = assignments.constant(var.index);
-                                    break;
-                                case DfsVariableType::column_type::selector:
-                                    assignment = assignments.selector(var.index);
-                                    break;
-                                default:
-                                    std::cerr << "Invalid column type";
-                                    std::abort();
-                                    break;
-                            }
-
+                            polynomial_dfs_type assignment = get_column(assignments, var);
                             if (var.rotation != 0) {
                                 assignment = math::polynomial_shift(assignment, var.rotation, domain->m);
                             }
@@ -518,8 +545,264 @@ namespace nil {
                         return std::move(lookup_input_ptr);
                     }
 
+                    /**
+                     * Builds the lookup inputs and values of prepare_lookup_input and prepare_lookup_value, in
+                     * the same order and on the same extended domains, in one pass over the rows of each domain.
+                     * Each column is extended once per domain and rotations read it at an offset. Every input is
+                     * compiled into one row-wise expression and every value is folded at the row, so both are
+                     * written straight into their output polynomials without a temporary per column or term.
+                     */
+                    std::pair<lookup_columns_ptr_type, lookup_columns_ptr_type> prepare_lookup_columns(
+                            const polynomial_dfs_type &mask_assignment) {
+                        PROFILE_PLACEHOLDER_SCOPE("Lookup argument preparing lookup columns");
+
+                        const std::size_t basic_domain_size = basic_domain->m;
+                        std::vector<std::size_t> input_sizes;
+                        std::vector<std::size_t> value_sizes;
+                        std::map<std::uint32_t, std::vector<DfsVariableType>> columns = get_lookup_columns(
+                            constraint_system, plonk_columns, basic_domain_size, mask_assignment.degree(),
+                            input_sizes, value_sizes);
+
+                        auto value_type_to_polynomial_dfs = [](const typename VariableType::assignment_type& coeff) {
+                            return polynomial_dfs_type(0, 1, coeff);
+                        };
+                        math::expression_variable_type_converter<VariableType, DfsVariableType> converter(
+                            value_type_to_polynomial_dfs);
+
+                        // Lookup input: selector * (table_id + \sum_k theta^k * input_k)
+                        std::vector<math::expression<DfsVariableType>> inputs;
+                        for (const auto &gate : lookup_gates) {
+                            DfsVariableType selector(gate.tag_index, 0, false, DfsVariableType::column_type::selector);
+                            for (const auto &constraint : gate.constraints) {
+                                math::expression<DfsVariableType> input =
+                                    value_type_to_polynomial_dfs(typename FieldType::value_type(constraint.table_id));
+                                typename FieldType::value_type theta_acc = theta;
+                                for (const auto &lookup_input : constraint.lookup_input) {
+                                    input += converter.convert(lookup_input) * value_type_to_polynomial_dfs(theta_acc);
+                                    theta_acc *= theta;
+                                }
+                                input *= selector;
+                                inputs.push_back(input);
+                            }
+                        }
+
+                        std::size_t max_columns_number = 0;
+                        for (const auto &l_table : lookup_tables) {
+                            max_columns_number = std::max(max_columns_number, l_table.columns_number);
+                        }
+                        std::vector<typename FieldType::value_type> theta_powers(max_columns_number);
+                        typename FieldType::value_type theta_acc = theta;
+                        for (std::size_t i = 0; i < max_columns_number; i++) {
+                            theta_powers[i] = theta_acc;
+                            theta_acc *= theta;
+                        }
+
+                        auto lookup_input_ptr = std::make_unique<std::vector<polynomial_dfs_type>>(input_sizes.size());
+                        auto lookup_value_ptr = std::make_unique<std::vector<polynomial_dfs_type>>(value_sizes.size());
+
+                        for (const auto &[size, variables] : columns) {
+                            // Columns already extended by the caller are reused, the missing ones are extended here.
+                            column_values_type &column_values = extended_columns[size];
+                            gates_argument_type::build_variable_value_map(
+                                variables, plonk_columns, basic_domain, size, column_values);
+
+                            std::vector<math::rowwise_expression_evaluator<DfsVariableType>> evaluators;
+                            std::vector<polynomial_dfs_type*> input_outputs;
+                            std::size_t max_stack_depth = 0;
+                            std::size_t cache_size = 0;
+                            for (std::size_t i = 0; i < inputs.size(); i++) {
+                                if (input_sizes[i] != size) {
+                                    continue;
+                                }
+                                evaluators.emplace_back(inputs[i], size,
+                                    [&column_values, basic_domain_size](const DfsVariableType &var) {
+                                        return gates_argument_type::get_variable_view(column_values, var, basic_domain_size);
+                                    });
+                                max_stack_depth = std::max(max_stack_depth, evaluators.back().max_stack_depth());
+                                cache_size = std::max(cache_size, evaluators.back().cache_size());
+                                (*lookup_input_ptr)[i] = polynomial_dfs_type(
+                                    evaluators.back().degree(), size, FieldType::value_type::zero());
+                                input_outputs.push_back(&(*lookup_input_ptr)[i]);
+                            }
+
+                            // Lookup value: mask * tag * ((t_id + 1) + \sum_i theta^(i + 1) * constant_i)
+                            std::vector<typename FieldType::value_type> value_table_ids;
+                            std::vector<const polynomial_dfs_type*> value_tags;
+                            std::vector<std::vector<const polynomial_dfs_type*>> value_constants;
+                            std::vector<polynomial_dfs_type*> value_outputs;
+                            std::size_t value_index = 0;
+                            for (std::size_t t_id = 0; t_id < lookup_tables.size(); t_id++) {
+                                const plonk_lookup_table<FieldType> &l_table = lookup_tables[t_id];
+                                DfsVariableType tag(l_table.tag_index, 0, false, DfsVariableType::column_type::selector);
+                                for (const auto &option : l_table.lookup_options) {
+                                    if (value_sizes[value_index] == size) {
+                                        const polynomial_dfs_type &tag_values = column_values.at(tag);
+                                        std::vector<const polynomial_dfs_type*> constants;
+                                        for (std::size_t i = 0; i < l_table.columns_number; i++) {
+                                            constants.push_back(&column_values.at(DfsVariableType(
+                                                option[i].index, 0, false, DfsVariableType::column_type::constant)));
+                                        }
+                                        value_table_ids.push_back(typename FieldType::value_type(t_id + 1));
+                                        value_tags.push_back(&tag_values);
+                                        value_constants.push_back(std::move(constants));
+                                        (*lookup_value_ptr)[value_index] = polynomial_dfs_type(
+                                            tag_values.degree() + constants_degree(l_table, option, plonk_columns) +
+                                                mask_assignment.degree(),
+                                            size, FieldType::value_type::zero());
+                                        value_outputs.push_back(&(*lookup_value_ptr)[value_index]);
+                                    }
+                                    value_index++;
+                                }
+                            }
+
+                            polynomial_dfs_type mask;
+                            if (!value_outputs.empty()) {
+                                mask = mask_assignment;
+                                mask.resize(size, basic_domain, math::make_evaluation_domain<FieldType>(size));
+                            }
+
+                            wait_for_all(parallel_run_in_chunks<void>(
+                                size,
+                                [&evaluators, &input_outputs, &value_table_ids, &value_tags, &value_constants,
+                                 &value_outputs, &theta_powers, &mask, max_stack_depth, cache_size]
+                                (std::size_t begin, std::size_t end) {
+                                    std::vector<typename FieldType::value_type> stack(max_stack_depth);
+                                    std::vector<typename FieldType::value_type> cache(cache_size);
+                                    for (std::size_t row = begin; row < end; row++) {
+                                        for (std::size_t i = 0; i < evaluators.size(); i++) {
+                                            (*input_outputs[i])[row] =
+                                                evaluators[i].evaluate_row(row, stack.data(), cache.data());
+                                        }
+                                        for (std::size_t j = 0; j < value_outputs.size(); j++) {
+                                            typename FieldType::value_type v = value_table_ids[j];
+                                            for (std::size_t i = 0; i < value_constants[j].size(); i++) {
+                                                v += theta_powers[i] * (*value_constants[j][i])[row];
+                                            }
+                                            (*value_outputs[j])[row] = mask[row] * (*value_tags[j])[row] * v;
+                                        }
+                                    }
+                                }));
+
+                            extended_columns.erase(size);
+                        }
+                        return std::make_pair(std::move(lookup_input_ptr), std::move(lookup_value_ptr));
+                    }
 
                 private:
+                    static polynomial_dfs_type get_mask_assignment(const preprocessed_data_type &preprocessed_data) {
+                        polynomial_dfs_type one_polynomial(
+                            0, preprocessed_data.common_data.basic_domain->m, FieldType::value_type::one());
+                        return one_polynomial - preprocessed_data.q_last - preprocessed_data.q_blind;
+                    }
+
+                    static DfsVariableType to_dfs_variable(const VariableType &var) {
+                        return DfsVariableType(var.index, var.rotation, var.relative,
+                            static_cast<typename DfsVariableType::column_type>(static_cast<std::uint8_t>(var.type)));
+                    }
+
+                    // Smallest power of two multiple of the basic domain size above the degree.
+                    static std::size_t get_extended_domain_size(std::size_t basic_domain_size, std::size_t degree) {
+                        std::size_t size = basic_domain_size;
+                        while (size <= degree) {
+                            size *= 2;
+                        }
+                        return size;
+                    }
+
+                    static std::size_t constants_degree(
+                            const plonk_lookup_table<FieldType> &l_table,
+                            const std::vector<VariableType> &option,
+                            const plonk_polynomial_dfs_table<FieldType> &plonk_columns) {
+                        std::size_t degree = 0;
+                        for (std::size_t i = 0; i < l_table.columns_number; i++) {
+                            degree = std::max(degree, plonk_columns.constant(option[i].index).degree());
+                        }
+                        return degree;
+                    }
+
+                    /**
+                     * Unrotated columns read by the lookup inputs and values, by the size of the extended domain
+                     * each input and value is built on. input_sizes and value_sizes receive those sizes, in the
+                     * order of prepare_lookup_input and prepare_lookup_value.
+                     */
+                    static std::map<std::uint32_t, std::vector<DfsVariableType>> get_lookup_columns(
+                            const plonk_constraint_system<FieldType> &constraint_system,
+                            const plonk_polynomial_dfs_table<FieldType> &plonk_columns,
+                            std::size_t basic_domain_size,
+                            std::size_t mask_degree,
+                            std::vector<std::size_t> &input_sizes,
+                            std::vector<std::size_t> &value_sizes) {
+                        std::map<std::uint32_t, std::vector<DfsVariableType>> columns;
+                        std::map<std::uint32_t, std::unordered_set<DfsVariableType>> known_columns;
+                        auto add_column = [&columns, &known_columns](std::size_t size, const DfsVariableType &var) {
+                            DfsVariableType column = gates_argument_type::unrotated(var);
+                            if (known_columns[size].insert(column).second) {
+                                columns[size].push_back(column);
+                            }
+                        };
+
+                        math::expression_polynomial_degree_visitor<VariableType> degree_visitor(
+                            [&plonk_columns](const VariableType &var) {
+                                return get_column(plonk_columns, to_dfs_variable(var)).degree();
+                            });
+
+                        for (const auto &gate : constraint_system.lookup_gates()) {
+                            DfsVariableType selector(gate.tag_index, 0, false, DfsVariableType::column_type::selector);
+                            for (const auto &constraint : gate.constraints) {
+                                std::size_t degree = 0;
+                                for (const auto &input : constraint.lookup_input) {
+                                    degree = std::max(degree, degree_visitor.compute_degree(input));
+                                }
+                                std::size_t size = get_extended_domain_size(
+                                    basic_domain_size, plonk_columns.selector(gate.tag_index).degree() + degree);
+                                input_sizes.push_back(size);
+
+                                add_column(size, selector);
+                                math::expression_for_each_variable_visitor<VariableType> visitor(
+                                    [&add_column, size](const VariableType &var) {
+                                        add_column(size, to_dfs_variable(var));
+                                    });
+                                for (const auto &input : constraint.lookup_input) {
+                                    visitor.visit(input);
+                                }
+                            }
+                        }
+
+                        for (const auto &l_table : constraint_system.lookup_tables()) {
+                            DfsVariableType tag(l_table.tag_index, 0, false, DfsVariableType::column_type::selector);
+                            for (const auto &option : l_table.lookup_options) {
+                                std::size_t size = get_extended_domain_size(basic_domain_size,
+                                    plonk_columns.selector(l_table.tag_index).degree() +
+                                    constants_degree(l_table, option, plonk_columns) + mask_degree);
+                                value_sizes.push_back(size);
+
+                                add_column(size, tag);
+                                for (std::size_t i = 0; i < l_table.columns_number; i++) {
+                                    add_column(size, DfsVariableType(
+                                        option[i].index, 0, false, DfsVariableType::column_type::constant));
+                                }
+                            }
+                        }
+                        return columns;
+                    }
+
+                    static const polynomial_dfs_type &get_column(
+                            const plonk_polynomial_dfs_table<FieldType> &assignments, const DfsVariableType &var) {
+                        switch (var.type) {
+                            case DfsVariableType::column_type::witness:
+                                return assignments.witness(var.index);
+                            case DfsVariableType::column_type::public_input:
+                                return assignments.public_input(var.index);
+                            case DfsVariableType::column_type::constant:
+                                return assignments.constant(var.index);
+                            case DfsVariableType::column_type::selector:
+                                return assignments.selector(var.index);
+                            default:
+                                std::cerr << "Invalid column type";
+                                std::abort();
+                        }
+                    }
+
 
                     math::polynomial_dfs<typename FieldType::value_type> reduce_dfs_polynomial_domain(
                         const math::polynomial_dfs<typename FieldType::value_type> &polynomial,
@@ -672,6 +955,7 @@ namespace nil {
                     const std::vector<plonk_lookup_table<FieldType>>& lookup_tables;
                     typename FieldType::value_type theta;
                     std::size_t lookup_chunks;
+                    extended_columns_type extended_columns;
                 };
 
                 template<typename FieldType, typename CommitmentSchemeTypePermutation, typename ParamsType>
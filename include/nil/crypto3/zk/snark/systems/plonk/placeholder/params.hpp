@@ -58,6 +58,7 @@ namespace nil {
                     using commitment_scheme_params_type = typename CommitmentScheme::params_type;
                     using public_input_type = typename CircuitParams::public_input_type;
 
+                    // A transcript::duplex_sponge<Hash> transcript hash selects the duplex-sponge transcript.
                     using transcript_hash_type = typename CommitmentScheme::transcript_hash_type;
                     using circuit_params_type = CircuitParams;
                 };
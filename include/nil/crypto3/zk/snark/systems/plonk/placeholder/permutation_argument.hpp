@@ -40,6 +40,8 @@
 #include <nil/crypto3/container/merkle/tree.hpp>
 
 #include <nil/crypto3/zk/transcript/fiat_shamir.hpp>
+#include <nil/crypto3/zk/math/shifted_polynomial_dfs.hpp>
+#include <nil/crypto3/zk/math/polynomial_dfs_product.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/params.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/detail/placeholder_policy.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/detail/placeholder_scoped_profiler.hpp>
@@ -123,17 +125,12 @@ namespace nil {
                             h_v[i] += column_polynomials[global_indices[i]];
                         }, ThreadPool::PoolLevel::HIGH);
 
-                        // TODO(martun): parallelize the loop below, it takes ~20 seconds on 256 leaves.
+                        // Row ratios are computed in parallel, only the running product is sequential.
+                        std::vector<typename FieldType::value_type> V_P_ratios =
+                            row_ratios(g_v, h_v, 0, g_v.size(), basic_domain->size() - 1);
                         V_P[0] = FieldType::value_type::one();
                         for (std::size_t j = 1; j < basic_domain->size(); j++) {
-                            typename FieldType::value_type nom = FieldType::value_type::one();
-                            typename FieldType::value_type denom = FieldType::value_type::one();
-
-                            for (std::size_t i = 0; i < S_id.size(); i++) {
-                                nom *= g_v[i][j - 1];
-                                denom *= h_v[i][j - 1];
-                            }
-                            V_P[j] = V_P[j - 1] * nom * denom.inversed();
+                            V_P[j] = V_P[j - 1] * V_P_ratios[j - 1];
                         }
 
                         // 4. Compute and add commitment to $V_P$ to $\text{transcript}$.
@@ -141,25 +138,26 @@ namespace nil {
                         commitment_scheme.append_to_batch(PERMUTATION_BATCH, V_P);
 
                         // 5. Calculate g_perm, h_perm
+                        // Factors [part_bounds[k], part_bounds[k + 1]) form the k-th part.
+                        std::vector<std::size_t> part_bounds = {0};
+                        std::size_t part_size = preprocessed_data.common_data.max_quotient_chunks > 1 ?
+                            preprocessed_data.common_data.max_quotient_chunks - 1 : g_v.size();
+                        for (std::size_t i = part_size; i < g_v.size(); i += part_size) {
+                            part_bounds.push_back(i);
+                        }
+                        if (part_bounds.back() != g_v.size()) {
+                            part_bounds.push_back(g_v.size());
+                        }
+
                         std::vector<math::polynomial_dfs<typename FieldType::value_type>> gs;
                         std::vector<math::polynomial_dfs<typename FieldType::value_type>> hs;
-                        std::vector<math::polynomial_dfs<typename FieldType::value_type>> g_factors;
-                        std::vector<math::polynomial_dfs<typename FieldType::value_type>> h_factors;
-                        for(std::size_t i = 0; i < g_v.size(); i++){
-                            g_factors.push_back(g_v[i]);
-                            h_factors.push_back(h_v[i]);
-                            if( preprocessed_data.common_data.max_quotient_chunks != 0 && g_factors.size() == (preprocessed_data.common_data.max_quotient_chunks - 1)) {
-                                gs.push_back(math::polynomial_product<FieldType>(g_factors));
-                                hs.push_back(math::polynomial_product<FieldType>(h_factors));
-                                g_factors.clear();
-                                h_factors.clear();
-                            }
-                        }
-                        if( g_factors.size() != 0 ){
-                            gs.push_back(math::polynomial_product<FieldType>(g_factors));
-                            hs.push_back(math::polynomial_product<FieldType>(h_factors));
-                            g_factors.clear();
-                            h_factors.clear();
+                        for (std::size_t k = 0; k + 1 < part_bounds.size(); k++) {
+                            gs.push_back(math::polynomial_product_tree<FieldType>(
+                                std::vector<math::polynomial_dfs<typename FieldType::value_type>>(
+                                    g_v.begin() + part_bounds[k], g_v.begin() + part_bounds[k + 1])));
+                            hs.push_back(math::polynomial_product_tree<FieldType>(
+                                std::vector<math::polynomial_dfs<typename FieldType::value_type>>(
+                                    h_v.begin() + part_bounds[k], h_v.begin() + part_bounds[k + 1])));
                         }
                         BOOST_ASSERT(gs.size() == preprocessed_data.common_data.permutation_parts);
                         BOOST_ASSERT(gs.size() == hs.size());
@@ -167,8 +165,6 @@ namespace nil {
                         math::polynomial_dfs<typename FieldType::value_type> one_polynomial(
                             0, V_P.size(), FieldType::value_type::one());
                         std::array<math::polynomial_dfs<typename FieldType::value_type>, argument_size> F_dfs;
-                        math::polynomial_dfs<typename FieldType::value_type> V_P_shifted =
-                            math::polynomial_shift(V_P, 1, basic_domain->m);
 
                         /* F_dfs[0] = preprocessed_data.common_data.lagrange_0 * (one_polynomial - V_P); */
 
@@ -184,7 +180,11 @@ namespace nil {
                         if ( preprocessed_data.common_data.permutation_parts == 1 ){
                             auto &g = gs[0];
                             auto &h = hs[0];
+                            // Extend V_P once, its shift is a rotation of the extended values.
                             math::polynomial_dfs<typename FieldType::value_type> t1 = V_P;
+                            t1.resize(h.size());
+                            math::polynomial_dfs<typename FieldType::value_type> V_P_shifted =
+                                math::extended_polynomial_shift(t1, 1, basic_domain->m);
                             t1 *= g;
                             V_P_shifted *= h;
                             V_P_shifted -= t1;
@@ -197,13 +197,15 @@ namespace nil {
                             math::polynomial_dfs<typename FieldType::value_type> previous_poly = V_P;
                             math::polynomial_dfs<typename FieldType::value_type> current_poly = V_P;
                             for( std::size_t i = 0; i < preprocessed_data.common_data.permutation_parts-1; i++ ){
-                                auto g = gs[i];
-                                auto h = hs[i];
-                                auto reduced_g = reduce_dfs_polynomial_domain(g, basic_domain->m);
-                                auto reduced_h = reduce_dfs_polynomial_domain(h, basic_domain->m);
-                                for(std::size_t j = 0; j < preprocessed_data.common_data.desc.usable_rows_amount; j++){
-                                    current_poly[j] = (previous_poly[j] * reduced_g[j]) * reduced_h[j].inversed();
-                                }
+                                auto &g = gs[i];
+                                auto &h = hs[i];
+                                // g and h on the basic domain are the products of the base values of their factors.
+                                std::vector<typename FieldType::value_type> ratios = row_ratios(
+                                    g_v, h_v, part_bounds[i], part_bounds[i + 1],
+                                    preprocessed_data.common_data.desc.usable_rows_amount);
+                                parallel_for(0, ratios.size(), [&current_poly, &previous_poly, &ratios](std::size_t j) {
+                                    current_poly[j] = previous_poly[j] * ratios[j];
+                                });
                                 commitment_scheme.append_to_batch(PERMUTATION_BATCH, current_poly);
                                 auto part = permutation_alphas[i] * (previous_poly * g - current_poly * h);
                                 F_dfs[1] += part;
@@ -212,6 +214,8 @@ namespace nil {
                             std::size_t last = permutation_alphas.size();
                             auto &g = gs[last];
                             auto &h = hs[last];
+                            math::polynomial_dfs<typename FieldType::value_type> V_P_shifted =
+                                math::polynomial_shift(V_P, 1, basic_domain->m);
                             F_dfs[1] += (previous_poly * g - V_P_shifted * h);
                             F_dfs[1] *= (preprocessed_data.q_last + preprocessed_data.q_blind) - one_polynomial;
                         }
@@ -335,6 +339,38 @@ namespace nil {
                         return F;
                     }
 
+                    /**
+                     * ratios[j] = prod_{i in [first, last)} g_v[i][j] / h_v[i][j] for rows j < rows_amount,
+                     * computed on row chunks in parallel with one batched inversion per chunk.
+                     */
+                    static std::vector<typename FieldType::value_type> row_ratios(
+                        const std::vector<math::polynomial_dfs<typename FieldType::value_type>> &g_v,
+                        const std::vector<math::polynomial_dfs<typename FieldType::value_type>> &h_v,
+                        std::size_t first,
+                        std::size_t last,
+                        std::size_t rows_amount
+                    ) {
+                        std::vector<typename FieldType::value_type> ratios(rows_amount);
+                        wait_for_all(parallel_run_in_chunks<void>(
+                            rows_amount, [&g_v, &h_v, first, last, &ratios](std::size_t begin, std::size_t end) {
+                                std::vector<typename FieldType::value_type> denominators(
+                                    end - begin, FieldType::value_type::one());
+                                for (std::size_t j = begin; j < end; j++) {
+                                    typename FieldType::value_type numerator = FieldType::value_type::one();
+                                    for (std::size_t i = first; i < last; i++) {
+                                        numerator *= g_v[i][j];
+                                        denominators[j - begin] *= h_v[i][j];
+                                    }
+                                    ratios[j] = numerator;
+                                }
+                                math::batch_inverse(denominators.begin(), denominators.end());
+                                for (std::size_t j = begin; j < end; j++) {
+                                    ratios[j] *= denominators[j - begin];
+                                }
+                            }));
+                        return ratios;
+                    }
+
                     static math::polynomial_dfs<typename FieldType::value_type> reduce_dfs_polynomial_domain(
                         const math::polynomial_dfs<typename FieldType::value_type> &polynomial,
                         const std::size_t &new_domain_size
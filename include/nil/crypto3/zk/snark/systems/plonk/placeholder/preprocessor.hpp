@@ -28,6 +28,7 @@
 #ifndef CRYPTO3_ZK_PLONK_PLACEHOLDER_PREPROCESSOR_HPP
 #define CRYPTO3_ZK_PLONK_PLACEHOLDER_PREPROCESSOR_HPP
 
+#include <algorithm>
 #include <set>
 #include <iostream>
 #include <sstream>
@@ -263,8 +264,24 @@ namespace nil {
                         polynomial_dfs_type               q_blind;
 
                         common_data_type                  common_data;
+
+                        // Used by prover only, not marshalled. active_selectors[i] is false iff selector i is
+                        // zero on every row, the prover skips the gates of such selectors.
+                        std::vector<bool> active_selectors;
                     };
 
+                    static inline std::vector<bool> active_selectors(
+                        const plonk_public_polynomial_dfs_table<FieldType> &public_polynomial_table
+                    ) {
+                        std::vector<bool> result(public_polynomial_table.selectors_amount());
+                        for (std::size_t i = 0; i < result.size(); ++i) {
+                            const polynomial_dfs_type &selector = public_polynomial_table.selector(i);
+                            result[i] = std::any_of(selector.begin(), selector.end(),
+                                [](const typename FieldType::value_type &v) { return !v.is_zero(); });
+                        }
+                        return result;
+                    }
+
                 private:
                     static polynomial_dfs_type lagrange_polynomial(
                         std::shared_ptr<math::evaluation_domain<FieldType>> domain,
@@ -597,6 +614,8 @@ namespace nil {
                             max_quotient_poly_chunks
                         );
 
+                        auto selectors_flags = active_selectors(public_polynomial_table);
+
                         // Push circuit description to transcript
                         preprocessed_data_type preprocessed_data({
                             std::move(public_polynomial_table),
@@ -604,7 +623,8 @@ namespace nil {
                             std::move(id_perm_polys),
                             std::move(q_last_q_blind[0]),
                             std::move(q_last_q_blind[1]),
-                            std::move(common_data)
+                            std::move(common_data),
+                            std::move(selectors_flags)
                         });
 
                         return preprocessed_data;
@@ -41,6 +41,7 @@
 #include <nil/crypto3/zk/snark/arithmetization/plonk/assignment.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/detail/placeholder_policy.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/detail/placeholder_scoped_profiler.hpp>
+#include <nil/crypto3/zk/snark/systems/plonk/placeholder/detail/placeholder_prover_scheduler.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/permutation_argument.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/lookup_argument.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/gates_argument.hpp>
@@ -85,6 +86,10 @@ namespace nil {
                     using public_preprocessor_type = placeholder_public_preprocessor<FieldType, ParamsType>;
                     using private_preprocessor_type = placeholder_private_preprocessor<FieldType, ParamsType>;
 
+                    using gates_argument_type = placeholder_gates_argument<FieldType, ParamsType>;
+                    using lookup_argument_prover_type =
+                        placeholder_lookup_argument_prover<FieldType, commitment_scheme_type, ParamsType>;
+
                     constexpr static const std::size_t gate_parts = 1;
                     constexpr static const std::size_t permutation_parts = 3;
                     constexpr static const std::size_t lookup_parts = 6;
@@ -109,7 +114,8 @@ namespace nil {
                         typename private_preprocessor_type::preprocessed_data_type preprocessed_private_data,
                         const plonk_table_description<FieldType> &table_description,
                         const plonk_constraint_system<FieldType> &constraint_system,
-                        const commitment_scheme_type &commitment_scheme
+                        const commitment_scheme_type &commitment_scheme,
+                        bool overlap = true
                     )
                             : preprocessed_public_data(preprocessed_public_data)
                             , table_description(table_description)
@@ -121,6 +127,7 @@ namespace nil {
                             , transcript(std::vector<std::uint8_t>({}))
                             , _is_lookup_enabled(constraint_system.lookup_gates().size() > 0)
                             , _commitment_scheme(commitment_scheme)
+                            , _scheduler(overlap)
                     {
                         std::cout << "Table has " << table_description.rows_amount << " rows." << std::endl;
 
@@ -134,12 +141,19 @@ namespace nil {
 
                     placeholder_proof<FieldType, ParamsType> process() {
                         PROFILE_PLACEHOLDER_SCOPE("Placeholder prover, total time");
+                        _scheduler.start();
 
                         // 2. Commit witness columns and public_input columns
+                        // Witness column i is polynomial i of the batch, so LPC callers proving mostly static tables
+                        // can mark unchanged witness ranges with mark_unchanged(VARIABLE_VALUES_BATCH, ...).
                         _commitment_scheme.append_to_batch(VARIABLE_VALUES_BATCH, _polynomial_table->witnesses());
                         _commitment_scheme.append_to_batch(VARIABLE_VALUES_BATCH, _polynomial_table->public_inputs());
                         _proof.commitments[VARIABLE_VALUES_BATCH] = _commitment_scheme.commit(VARIABLE_VALUES_BATCH);
                         transcript(_proof.commitments[VARIABLE_VALUES_BATCH]);
+                        _scheduler.stage_done("Witness commitment");
+
+                        // 3. Start the work that does not depend on the transcript
+                        start_transcript_independent_work();
 
                         // 4. permutation_argument
                         if( constraint_system.copy_constraints().size() > 0 ){
@@ -154,6 +168,7 @@ namespace nil {
                             _F_dfs[0] = std::move(permutation_argument.F_dfs[0]);
                             _F_dfs[1] = std::move(permutation_argument.F_dfs[1]);
                             _F_dfs[2] = std::move(permutation_argument.F_dfs[2]);
+                            _scheduler.stage_done("Permutation argument");
                         }
 
                         // 5. lookup_argument
@@ -168,23 +183,20 @@ namespace nil {
                         if( constraint_system.copy_constraints().size() > 0 || constraint_system.lookup_gates().size() > 0){
                             _proof.commitments[PERMUTATION_BATCH] = _commitment_scheme.commit(PERMUTATION_BATCH);
                             transcript(_proof.commitments[PERMUTATION_BATCH]);
+                            _scheduler.stage_done("Permutation commitment");
                         }
 
                         // 6. circuit-satisfability
-
-                        polynomial_dfs_type mask_polynomial(
-                            0, preprocessed_public_data.common_data.basic_domain->m,
-                            typename FieldType::value_type(1u)
-                        );
-                        mask_polynomial -= preprocessed_public_data.q_last;
-                        mask_polynomial -= preprocessed_public_data.q_blind;
-                        _F_dfs[7] = placeholder_gates_argument<FieldType, ParamsType>::prove_eval(
+                        _F_dfs[7] = gates_argument_type::prove_eval(
                             constraint_system, *_polynomial_table,
                             preprocessed_public_data.common_data.basic_domain,
                             preprocessed_public_data.common_data.max_gates_degree,
-                            mask_polynomial,
-                            transcript
+                            _mask_polynomial.get(),
+                            transcript,
+                            _gate_variable_values.get(),
+                            &preprocessed_public_data.active_selectors
                         )[0];
+                        _scheduler.stage_done("Gates argument");
 
                         /////TEST
 #ifdef ZK_PLACEHOLDER_DEBUG_ENABLED
@@ -201,6 +213,7 @@ namespace nil {
                             _proof.commitments[QUOTIENT_BATCH] = T_commit(T_splitted_dfs);
                         }
                         transcript(_proof.commitments[QUOTIENT_BATCH]);
+                        _scheduler.stage_done("Quotient commitment");
 
                         // 8. Run evaluation proofs
                         _proof.eval_proof.challenge = transcript.template challenge<FieldType>();
@@ -211,11 +224,51 @@ namespace nil {
                             PROFILE_PLACEHOLDER_SCOPE("commitment scheme proof eval time");
                             _proof.eval_proof.eval_proof = _commitment_scheme.proof_eval(transcript);
                         }
+                        _scheduler.stage_done("Evaluation proof");
 
+#ifdef ZK_PLACEHOLDER_PROFILING_ENABLED
+                        _scheduler.print(std::cout);
+#endif
                         return _proof;
                     }
 
+                    // Time from the start of the last process() call to the end of each of its stages.
+                    std::vector<detail::placeholder_prover_scheduler::stage_latency> stage_latencies() const {
+                        return _scheduler.stage_latencies();
+                    }
+
                 private:
+                    // Column extensions for the gates, shifted lookup columns and the mask polynomial depend on
+                    // the table only. They are computed in the background while the permutation and lookup
+                    // rounds run, and picked up through futures by the rounds that need them. Without overlap they
+                    // are computed in place, the proof is the same.
+                    void start_transcript_independent_work() {
+                        _mask_polynomial = _scheduler.run_async("Mask polynomial", [this]() {
+                            polynomial_dfs_type mask_polynomial(
+                                0, preprocessed_public_data.common_data.basic_domain->m,
+                                typename FieldType::value_type(1u)
+                            );
+                            mask_polynomial -= preprocessed_public_data.q_last;
+                            mask_polynomial -= preprocessed_public_data.q_blind;
+                            return mask_polynomial;
+                        });
+
+                        _gate_variable_values = _scheduler.run_async("Gates argument column extensions", [this]() {
+                            return gates_argument_type::prepare_variable_values(
+                                constraint_system, *_polynomial_table,
+                                preprocessed_public_data.common_data.basic_domain,
+                                preprocessed_public_data.common_data.max_gates_degree,
+                                &preprocessed_public_data.active_selectors);
+                        });
+
+                        if (_is_lookup_enabled) {
+                            _lookup_extended_columns = _scheduler.run_async("Lookup argument column extensions", [this]() {
+                                return lookup_argument_prover_type::prepare_extended_columns(
+                                    constraint_system, preprocessed_public_data, *_polynomial_table);
+                            });
+                        }
+                    }
+
                     std::vector<polynomial_dfs_type> quotient_polynomial_split_dfs() {
                         // TODO: pass max_degree parameter placeholder
                         std::vector<polynomial_type> T_splitted = detail::split_polynomial<FieldType>(
@@ -296,16 +349,18 @@ namespace nil {
                         lookup_argument_result.F_dfs[3] = polynomial_dfs_type(0, table_description.rows_amount, FieldType::value_type::zero());
 
                         if (_is_lookup_enabled) {
-                            placeholder_lookup_argument_prover<FieldType, commitment_scheme_type, ParamsType> lookup_argument_prover(
+                            lookup_argument_prover_type lookup_argument_prover(
                                 constraint_system,
                                 preprocessed_public_data,
                                 *_polynomial_table,
                                 _commitment_scheme,
-                                transcript
+                                transcript,
+                                _lookup_extended_columns.get()
                             );
-;
+
                             lookup_argument_result = lookup_argument_prover.prove_eval();
                             _proof.commitments[LOOKUP_BATCH] = lookup_argument_result.lookup_commitment;
+                            _scheduler.stage_done("Lookup argument");
                         }
                         return lookup_argument_result;
                     }
@@ -476,6 +531,13 @@ namespace nil {
                     typename FieldType::value_type _omega;
                     std::vector<typename FieldType::value_type> _challenge_point;
                     commitment_scheme_type _commitment_scheme;
+
+                    // Background work. The futures are declared last, so they are joined before the
+                    // members the work reads from are destroyed.
+                    detail::placeholder_prover_scheduler _scheduler;
+                    std::future<polynomial_dfs_type> _mask_polynomial;
+                    std::future<typename gates_argument_type::prepared_variable_values_type> _gate_variable_values;
+                    std::future<typename lookup_argument_prover_type::extended_columns_type> _lookup_extended_columns;
                 };
             }    // namespace snark
         }        // namespace zk
@@ -0,0 +1,128 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+// @file Declaration of the batched authentication tag algorithms of the R1CS ppzkADSNARK.
+//
+// The tag of a label is Lambda = lambda * g2, for the PRF output lambda of the label, and
+// the authenticated value mu = lambda + i * data is checked against it publicly with
+// mu * g2 == Lambda - data * minusI2, minusI2 = -i * g2. For a batch, the tags share one
+// fixed-base window table of g2, and the checks are folded into a single one with random
+// coefficients, which costs one multi-exponentiation.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_R1CS_PPZKADSNARK_BATCH_AUTH_HPP
+#define CRYPTO3_R1CS_PPZKADSNARK_BATCH_AUTH_HPP
+
+#include <vector>
+
+#include <boost/assert.hpp>
+#include <boost/random/random_device.hpp>
+
+#include <nil/crypto3/algebra/multiexp/multiexp.hpp>
+#include <nil/crypto3/algebra/multiexp/policies.hpp>
+#include <nil/crypto3/algebra/random_element.hpp>
+
+#include <nil/actor/core/thread_pool.hpp>
+#include <nil/actor/core/parallelization_utils.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace zk {
+            namespace snark {
+                namespace detail {
+
+                    /**
+                     * Tags lambda_i * g2 of a batch of labels, from one fixed-base window table of g2.
+                     */
+                    template<typename CurveType>
+                    std::vector<typename CurveType::template g2_type<>::value_type>
+                        batch_auth_tags(const std::vector<typename CurveType::scalar_field_type::value_type> &lambdas) {
+                        typedef typename CurveType::template g2_type<> g2_type;
+                        typedef typename CurveType::scalar_field_type scalar_field_type;
+
+                        std::vector<typename g2_type::value_type> tags(lambdas.size());
+                        if (lambdas.empty()) {
+                            return tags;
+                        }
+
+                        const std::size_t scalar_size = scalar_field_type::value_bits;
+                        const std::size_t window_size = algebra::get_exp_window_size<g2_type>(lambdas.size());
+                        const algebra::window_table<g2_type> table =
+                            algebra::get_window_table<g2_type>(scalar_size, window_size, g2_type::value_type::one());
+
+                        parallel_for(0, lambdas.size(), [&tags, &lambdas, &table, scalar_size,
+                                                         window_size](std::size_t i) {
+                            tags[i] = algebra::windowed_exp<g2_type, scalar_field_type>(scalar_size, window_size, table,
+                                                                                        lambdas[i]);
+                        });
+                        return tags;
+                    }
+
+                    /**
+                     * Checks mu_j * g2 == Lambda_j - data_j * minusI2 for all j at once, as
+                     *     (sum r_j * mu_j) * g2 + (sum r_j * data_j) * minusI2 == sum r_j * Lambda_j
+                     * for non-zero r_j drawn from rng. A batch with a false tag passes with probability
+                     * about 1 / |Fr| as long as whoever produced the batch cannot predict the r_j, so rng
+                     * must be a cryptographic generator.
+                     */
+                    template<typename CurveType, typename RNG = boost::random_device>
+                    bool batch_auth_tags_verify(
+                        const std::vector<typename CurveType::scalar_field_type::value_type> &mus,
+                        const std::vector<typename CurveType::scalar_field_type::value_type> &data,
+                        const std::vector<typename CurveType::template g2_type<>::value_type> &tags,
+                        const typename CurveType::template g2_type<>::value_type &minusI2,
+                        RNG &&rng = boost::random_device()) {
+                        typedef typename CurveType::template g2_type<> g2_type;
+                        typedef typename CurveType::scalar_field_type scalar_field_type;
+
+                        BOOST_ASSERT(mus.size() == data.size() && tags.size() == data.size());
+                        const std::size_t n = data.size();
+                        if (n == 0) {
+                            return true;
+                        }
+
+                        std::vector<typename scalar_field_type::value_type> coeffs(n);
+                        typename scalar_field_type::value_type mu_acc = scalar_field_type::value_type::zero();
+                        typename scalar_field_type::value_type data_acc = scalar_field_type::value_type::zero();
+                        for (std::size_t j = 0; j < n; j++) {
+                            do {
+                                coeffs[j] = algebra::random_element<scalar_field_type>(rng);
+                            } while (coeffs[j].is_zero());
+                            mu_acc += coeffs[j] * mus[j];
+                            data_acc += coeffs[j] * data[j];
+                        }
+
+                        typename g2_type::value_type tags_acc = algebra::multiexp<
+                            g2_type, scalar_field_type,
+                            algebra::policies::multiexp_method_bos_coster<g2_type, scalar_field_type>>(
+                            tags.begin(), tags.end(), coeffs.begin(), coeffs.end(), 1);
+
+                        return mu_acc * g2_type::value_type::one() + data_acc * minusI2 == tags_acc;
+                    }
+                }    // namespace detail
+            }        // namespace snark
+        }            // namespace zk
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_R1CS_PPZKADSNARK_BATCH_AUTH_HPP
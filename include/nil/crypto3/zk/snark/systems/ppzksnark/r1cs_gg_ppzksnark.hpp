@@ -28,6 +28,7 @@
 #define CRYPTO3_R1CS_GG_PPZKSNARK_HPP
 
 #include <type_traits>
+#include <vector>
 
 #include <nil/crypto3/zk/snark/systems/ppzksnark/r1cs_gg_ppzksnark/detail/basic_policy.hpp>
 
@@ -121,6 +122,7 @@ namespace nil {
                     typedef typename policy_type::auxiliary_input_type auxiliary_input_type;
 
                     typedef typename policy_type::proving_key_type proving_key_type;
+                    typedef typename policy_type::prepared_proving_key_type prepared_proving_key_type;
                     typedef typename policy_type::verification_key_type verification_key_type;
                     typedef typename policy_type::processed_verification_key_type processed_verification_key_type;
 
@@ -139,6 +141,13 @@ namespace nil {
                         return Prover::process(pk, primary_input, auxiliary_input);
                     }
 
+                    static inline proof_type prove(const prepared_proving_key_type &pk,
+                                                   const primary_input_type &primary_input,
+                                                   const auxiliary_input_type &auxiliary_input) {
+
+                        return Prover::process(pk, primary_input, auxiliary_input);
+                    }
+
                     template<typename VerificationKey>
                     static inline bool verify(const VerificationKey &vk,
                                               const primary_input_type &primary_input,
@@ -284,6 +293,15 @@ namespace nil {
                                               const proof_type &proof) {
                         return Verifier::process(first, last, vk, pubkey, unencrypted_primary_input, proof);
                     }
+
+                    // Batched verification against keys processed once by Verifier::process_keys
+                    template<typename ProcessedKeys, typename CipherText>
+                    static inline bool batch_verify(const ProcessedKeys &keys,
+                                                    const std::vector<CipherText> &ciphertexts,
+                                                    const std::vector<primary_input_type> &unencrypted_primary_inputs,
+                                                    const std::vector<proof_type> &proofs) {
+                        return Verifier::batch_process(keys, ciphertexts, unencrypted_primary_inputs, proofs);
+                    }
                 };
             }    // namespace snark
         }        // namespace zk
@@ -59,6 +59,7 @@
 
 #include <nil/crypto3/zk/snark/systems/ppzksnark/r1cs_gg_ppzksnark/modes.hpp>
 #include <nil/crypto3/zk/snark/systems/ppzksnark/r1cs_gg_ppzksnark/proving_key.hpp>
+#include <nil/crypto3/zk/snark/systems/ppzksnark/r1cs_gg_ppzksnark/prepared_proving_key.hpp>
 #include <nil/crypto3/zk/snark/systems/ppzksnark/r1cs_gg_ppzksnark/verification_key.hpp>
 #include <nil/crypto3/zk/snark/systems/ppzksnark/r1cs_gg_ppzksnark/keypair.hpp>
 #include <nil/crypto3/zk/snark/systems/ppzksnark/r1cs_gg_ppzksnark/proof.hpp>
@@ -98,6 +99,13 @@ namespace nil {
                          */
                         typedef r1cs_gg_ppzksnark_proving_key<curve_type, constraint_system_type> proving_key_type;
 
+                        /*************************** Prepared proving key ****************************/
+
+                        /**
+                         * A proving key with precomputed fixed-base tables for the prover multi-exponentiations.
+                         */
+                        typedef r1cs_gg_ppzksnark_prepared_proving_key<proving_key_type> prepared_proving_key_type;
+
                         /******************************* Verification key ****************************/
 
                         /**
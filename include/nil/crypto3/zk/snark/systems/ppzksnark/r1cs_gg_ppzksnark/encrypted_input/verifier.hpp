@@ -50,12 +50,31 @@
 #ifndef CRYPTO3_ZK_R1CS_GG_PPZKSNARK_ENCRYPTED_INPUT_VERIFIER_HPP
 #define CRYPTO3_ZK_R1CS_GG_PPZKSNARK_ENCRYPTED_INPUT_VERIFIER_HPP
 
+#include <future>
+#include <iterator>
+#include <vector>
+
+#include <boost/random/random_device.hpp>
+
+#include <nil/crypto3/algebra/random_element.hpp>
+
 #include <nil/crypto3/zk/snark/systems/ppzksnark/r1cs_gg_ppzksnark/verifier.hpp>
 
+#include <nil/actor/core/thread_pool.hpp>
+#include <nil/actor/core/parallelization_utils.hpp>
+
 namespace nil {
     namespace crypto3 {
         namespace zk {
             namespace snark {
+                /**
+                 * Verifier of the encrypted-input mode. Both checks
+                 *   \prod_i e(ct_i, t_i) = e(ct_{last}, h)
+                 *   e(A, B) = e(alpha, beta) e(acc, gamma) e(C, delta)
+                 * are evaluated as a product of Miller loops followed by a single final exponentiation.
+                 * The G2 points of the verification and public keys are fixed, their line coefficients
+                 * are precomputed once by process_keys() and can be reused for any number of proofs.
+                 */
                 template<typename CurveType>
                 class r1cs_gg_ppzksnark_verifier_strong_input_consistency<CurveType, proving_mode::encrypted_input> {
                     typedef detail::r1cs_gg_ppzksnark_basic_policy<CurveType, proving_mode::encrypted_input>
@@ -69,12 +88,50 @@ namespace nil {
                     typedef typename pairing::pairing_policy<CurveType>::g1_precomputed_type g1_precomputed_type;
                     typedef typename pairing::pairing_policy<CurveType>::g2_precomputed_type g2_precomputed_type;
 
+                    typedef typename scalar_field_type::value_type scalar_field_value_type;
+                    typedef typename g1_type::value_type g1_value_type;
+                    typedef typename g2_type::value_type g2_value_type;
+                    typedef typename gt_type::value_type gt_value_type;
+
                 public:
                     typedef typename policy_type::primary_input_type primary_input_type;
                     typedef typename policy_type::keypair_type keypair_type;
                     typedef typename policy_type::verification_key_type verification_key_type;
                     typedef typename policy_type::proof_type proof_type;
 
+                    /**
+                     * Verification and public keys with the Miller-loop line coefficients of their G2
+                     * points precomputed.
+                     */
+                    struct processed_keys_type {
+                        gt_value_type vk_alpha_g1_beta_g2;
+                        g2_precomputed_type vk_gamma_g2_precomp;
+                        g2_precomputed_type vk_delta_g2_precomp;
+                        container::accumulation_vector<g1_type> gamma_ABC_g1;
+                        /// (t_0, ..., t_{k}, h): the G2 side of the ciphertext check, the last ciphertext
+                        /// element is paired with the G2 generator h.
+                        std::vector<g2_precomputed_type> cipher_g2_precomp;
+                    };
+
+                    template<typename PublicKey>
+                    static processed_keys_type process_keys(const verification_key_type &gg_vk,
+                                                            const PublicKey &pubkey) {
+                        processed_keys_type keys;
+                        keys.vk_alpha_g1_beta_g2 = gg_vk.alpha_g1_beta_g2;
+                        keys.vk_gamma_g2_precomp = algebra::precompute_g2<CurveType>(gg_vk.gamma_g2);
+                        keys.vk_delta_g2_precomp = algebra::precompute_g2<CurveType>(gg_vk.delta_g2);
+                        keys.gamma_ABC_g1 = gg_vk.gamma_ABC_g1;
+
+                        const std::size_t t_size = std::distance(std::cbegin(pubkey.t_g2), std::cend(pubkey.t_g2));
+                        keys.cipher_g2_precomp.resize(t_size + 1);
+                        parallel_for(0, t_size + 1, [&keys, &pubkey, t_size](std::size_t i) {
+                            keys.cipher_g2_precomp[i] = algebra::precompute_g2<CurveType>(
+                                i < t_size ? *(std::cbegin(pubkey.t_g2) + i) : g2_value_type::one());
+                        });
+
+                        return keys;
+                    }
+
                     // TODO: add type constraints on PublicKey
                     template<typename CipherTextIterator, typename PublicKey>
                     static inline typename std::enable_if<
@@ -84,68 +141,183 @@ namespace nil {
                         process(CipherTextIterator first, CipherTextIterator last, const verification_key_type &gg_vk,
                                 const PublicKey &pubkey, const primary_input_type &unencrypted_primary_input,
                                 const proof_type &proof) {
-
-                        const std::size_t input_size = gg_vk.gamma_ABC_g1.rest.size();
                         const std::size_t ct_size = std::distance(first, last);
-                        assert(input_size - 1 > ct_size - 2);
-                        assert(unencrypted_primary_input.size() + (ct_size - 2) == input_size);
                         assert(ct_size - 2 == pubkey.delta_s_g1.size());
                         assert(ct_size - 2 == pubkey.t_g1.size());
                         assert(ct_size - 2 == pubkey.t_g2.size() - 1);
-                        typename g1_type::value_type acc = gg_vk.gamma_ABC_g1.first;
-                        typename gt_type::value_type sum_cipher = gt_type::value_type::one();
-
-                        auto it1 = first;
-                        auto it2 = std::cbegin(pubkey.t_g2);
-                        while (it1 != last - 1 && it2 != std::cend(pubkey.t_g2)) {
-                            acc = acc + *it1;
-                            sum_cipher = sum_cipher * algebra::pair_reduced<CurveType>(*it1++, *it2++);
+
+                        return process(first, last, process_keys(gg_vk, pubkey), unencrypted_primary_input, proof);
+                    }
+
+                    template<typename CipherTextIterator>
+                    static inline typename std::enable_if<
+                        std::is_same<typename g1_type::value_type,
+                                     typename std::iterator_traits<CipherTextIterator>::value_type>::value,
+                        bool>::type
+                        process(CipherTextIterator first, CipherTextIterator last, const processed_keys_type &keys,
+                                const primary_input_type &unencrypted_primary_input, const proof_type &proof) {
+                        const std::size_t ct_size = std::distance(first, last);
+                        assert(ct_size == keys.cipher_g2_precomp.size());
+
+                        // \prod_i e(ct_i, t_i) * e(-ct_{last}, h) == 1
+                        std::vector<g1_value_type> cipher_g1(first, last);
+                        cipher_g1.back() = -cipher_g1.back();
+                        bool ans1 = algebra::final_exponentiation<CurveType>(multi_miller_loop(
+                                        cipher_g1.begin(), cipher_g1.end(), keys.cipher_g2_precomp.begin())) ==
+                                    gt_value_type::one();
+
+                        // e(A, B) * e(-acc, gamma) * e(-C, delta) == e(alpha, beta)
+                        const g1_value_type acc = accumulate_input(first, last, keys, unencrypted_primary_input);
+                        gt_value_type QAP =
+                            algebra::miller_loop<CurveType>(algebra::precompute_g1<CurveType>(proof.g_A),
+                                                            algebra::precompute_g2<CurveType>(proof.g_B)) *
+                            algebra::double_miller_loop<CurveType>(
+                                algebra::precompute_g1<CurveType>(-acc), keys.vk_gamma_g2_precomp,
+                                algebra::precompute_g1<CurveType>(-proof.g_C), keys.vk_delta_g2_precomp);
+                        bool ans2 = algebra::final_exponentiation<CurveType>(QAP) == keys.vk_alpha_g1_beta_g2;
+
+                        return (ans1 && ans2);
+                    }
+
+                    /**
+                     * Verifies many proofs against the same keys with a single final exponentiation.
+                     * Every proof j is weighted by random non-zero rho_j (QAP check) and sigma_j (ciphertext
+                     * check). All G1 points paired with the same fixed G2 point are summed before the
+                     * Miller loop, so only the e(rho_j A_j, B_j) terms grow with the number of proofs.
+                     */
+                    template<typename RNG = boost::random_device>
+                    static bool batch_process(const processed_keys_type &keys,
+                                              const std::vector<std::vector<g1_value_type>> &ciphertexts,
+                                              const std::vector<primary_input_type> &unencrypted_primary_inputs,
+                                              const std::vector<proof_type> &proofs,
+                                              RNG &&rng = boost::random_device()) {
+                        const std::size_t proofs_count = proofs.size();
+                        assert(ciphertexts.size() == proofs_count);
+                        assert(unencrypted_primary_inputs.size() == proofs_count);
+                        if (proofs_count == 0) {
+                            return true;
                         }
-                        assert((it1 == last - 1) && (it2 == std::cend(pubkey.t_g2)));
 
+                        const std::size_t ct_size = keys.cipher_g2_precomp.size();
+                        for (const std::vector<g1_value_type> &ct : ciphertexts) {
+                            if (ct.size() != ct_size) {
+                                return false;
+                            }
+                        }
+
+                        std::vector<scalar_field_value_type> rho(proofs_count), sigma(proofs_count);
+                        for (std::size_t j = 0; j < proofs_count; ++j) {
+                            rho[j] = derive_non_zero(rng);
+                            sigma[j] = derive_non_zero(rng);
+                        }
+
+                        // per-proof scaled points: rho_j A_j, rho_j acc_j, rho_j C_j and sigma_j ct_{j, i}
+                        std::vector<g1_value_type> scaled_A(proofs_count), scaled_acc(proofs_count),
+                            scaled_C(proofs_count);
+                        std::vector<std::vector<g1_value_type>> scaled_cipher(proofs_count);
+                        parallel_for(0, proofs_count, [&](std::size_t j) {
+                            const std::vector<g1_value_type> &ct = ciphertexts[j];
+                            scaled_A[j] = rho[j] * proofs[j].g_A;
+                            scaled_acc[j] =
+                                rho[j] * accumulate_input(ct.begin(), ct.end(), keys, unencrypted_primary_inputs[j]);
+                            scaled_C[j] = rho[j] * proofs[j].g_C;
+                            scaled_cipher[j].resize(ct_size);
+                            for (std::size_t i = 0; i < ct_size; ++i) {
+                                scaled_cipher[j][i] = sigma[j] * ct[i];
+                            }
+                        });
+
+                        // fold every G1 point paired with a fixed G2 point across proofs
+                        g1_value_type acc_sum = g1_value_type::zero();
+                        g1_value_type C_sum = g1_value_type::zero();
+                        std::vector<g1_value_type> cipher_sum(ct_size, g1_value_type::zero());
+                        scalar_field_value_type rho_sum = scalar_field_value_type::zero();
+                        for (std::size_t j = 0; j < proofs_count; ++j) {
+                            acc_sum = acc_sum + scaled_acc[j];
+                            C_sum = C_sum + scaled_C[j];
+                            for (std::size_t i = 0; i < ct_size; ++i) {
+                                cipher_sum[i] = cipher_sum[i] + scaled_cipher[j][i];
+                            }
+                            rho_sum = rho_sum + rho[j];
+                        }
+                        cipher_sum.back() = -cipher_sum.back();
+
+                        std::vector<g2_value_type> B(proofs_count);
+                        for (std::size_t j = 0; j < proofs_count; ++j) {
+                            B[j] = proofs[j].g_B;
+                        }
+
+                        gt_value_type left =
+                            multi_miller_loop(scaled_A.begin(), scaled_A.end(), B.begin()) *
+                            multi_miller_loop(cipher_sum.begin(), cipher_sum.end(), keys.cipher_g2_precomp.begin()) *
+                            algebra::double_miller_loop<CurveType>(
+                                algebra::precompute_g1<CurveType>(-acc_sum), keys.vk_gamma_g2_precomp,
+                                algebra::precompute_g1<CurveType>(-C_sum), keys.vk_delta_g2_precomp);
+
+                        return algebra::final_exponentiation<CurveType>(left) ==
+                               keys.vk_alpha_g1_beta_g2.pow(rho_sum.data);
+                    }
+
+                private:
+                    /// acc = gamma_ABC_0 + \sum_{i < last} ct_i + \sum_i x_i gamma_ABC_{i + 1} over the
+                    /// unencrypted part x of the primary input.
+                    template<typename CipherTextIterator>
+                    static g1_value_type accumulate_input(CipherTextIterator first, CipherTextIterator last,
+                                                          const processed_keys_type &keys,
+                                                          const primary_input_type &unencrypted_primary_input) {
+                        const std::size_t input_size = keys.gamma_ABC_g1.rest.size();
+                        const std::size_t ct_size = std::distance(first, last);
+                        assert(input_size - 1 > ct_size - 2);
+                        assert(unencrypted_primary_input.size() + (ct_size - 2) == input_size);
+
+                        g1_value_type acc = keys.gamma_ABC_g1.first;
+                        for (auto it = first; it != last - 1; ++it) {
+                            acc = acc + *it;
+                        }
                         for (std::size_t i = ct_size - 2; i < input_size; ++i) {
-                            acc = acc + unencrypted_primary_input[i - ct_size + 2] * gg_vk.gamma_ABC_g1.rest[i];
+                            acc = acc + unencrypted_primary_input[i - ct_size + 2] * keys.gamma_ABC_g1.rest[i];
                         }
-                        typename gt_type::value_type presum_cipher =
-                            algebra::pair_reduced<CurveType>(*(last - 1), g2_type::value_type::one());
-                        bool ans1 = (sum_cipher == presum_cipher);
-
-                        // TODO: optimize
-                        typename gt_type::value_type QAPl = algebra::pair_reduced<CurveType>(proof.g_A, proof.g_B);
-                        typename gt_type::value_type QAPr = gg_vk.alpha_g1_beta_g2 *
-                                                            algebra::pair_reduced<CurveType>(acc, gg_vk.gamma_g2) *
-                                                            algebra::pair_reduced<CurveType>(proof.g_C, gg_vk.delta_g2);
-                        // const g1_precomputed_type proof_g1_A_precomp = precompute_g1<CurveType>(proof.g_A);
-                        // const g2_precomputed_type proof_g2_B_precomp = precompute_g2<CurveType>(proof.g_B);
-                        //
-                        // const g1_precomputed_type pk_g1_alpha_precomp =
-                        //     precompute_g1<CurveType>(gg_keypair.first.alpha_g1);
-                        // const g2_precomputed_type pk_g2_beta_precomp =
-                        //     precompute_g2<CurveType>(gg_keypair.first.beta_g2);
-                        //
-                        // const g1_precomputed_type proof_g1_C_precomp = precompute_g1<CurveType>(proof.g_C);
-                        // const g2_precomputed_type vk_g2_delta_precomp =
-                        //     precompute_g2<CurveType>(gg_keypair.second.delta_g2);
-                        //
-                        // const g1_precomputed_type proof_g1_cn_precomp = precompute_g1<CurveType>(acc);
-                        // const g2_precomputed_type vk_g2_gamma_precomp =
-                        //     precompute_g2<CurveType>(gg_keypair.second.gamma_g2);
-                        //
-                        // typename gt_type::value_type QAPl_1 =
-                        //     miller_loop<CurveType>(proof_g1_A_precomp, proof_g2_B_precomp);
-                        // typename gt_type::value_type QAPl_2 = double_miller_loop<CurveType>(
-                        //     proof_g1_C_precomp, vk_g2_delta_precomp, pk_g1_alpha_precomp, pk_g2_beta_precomp);
-                        //
-                        // typename gt_type::value_type QAPr_2 =
-                        //     miller_loop<CurveType>(proof_g1_cn_precomp, vk_g2_gamma_precomp);
-                        //
-                        // typename gt_type::value_type QAPl = final_exponentiation<CurveType>(QAPl_1 *
-                        // QAPl_2.inversed()); typename gt_type::value_type QAPr =
-                        // final_exponentiation<CurveType>(QAPr_2);
-
-                        bool ans2 = (QAPl == QAPr);
+                        return acc;
+                    }
 
-                        return (ans1 && ans2);
+                    static gt_value_type miller_loop_term(const g1_value_type &p, const g2_value_type &q) {
+                        return algebra::miller_loop<CurveType>(algebra::precompute_g1<CurveType>(p),
+                                                               algebra::precompute_g2<CurveType>(q));
+                    }
+
+                    static gt_value_type miller_loop_term(const g1_value_type &p, const g2_precomputed_type &q) {
+                        return algebra::miller_loop<CurveType>(algebra::precompute_g1<CurveType>(p), q);
+                    }
+
+                    /// \prod_i ML(P_i, Q_i) over parallel chunks, without the final exponentiation.
+                    template<typename InputG1Iterator, typename InputG2Iterator>
+                    static gt_value_type multi_miller_loop(InputG1Iterator g1_first, InputG1Iterator g1_last,
+                                                           InputG2Iterator g2_first) {
+                        std::vector<std::future<gt_value_type>> partial_products =
+                            parallel_run_in_chunks<gt_value_type>(
+                                std::distance(g1_first, g1_last),
+                                [&g1_first, &g2_first](std::size_t begin, std::size_t end) {
+                                    gt_value_type acc = gt_value_type::one();
+                                    for (std::size_t i = begin; i < end; ++i) {
+                                        acc = acc * miller_loop_term(*(g1_first + i), *(g2_first + i));
+                                    }
+                                    return acc;
+                                });
+
+                        gt_value_type result = gt_value_type::one();
+                        for (auto &partial_product : partial_products) {
+                            result = result * partial_product.get();
+                        }
+                        return result;
+                    }
+
+                    template<typename RNG>
+                    static scalar_field_value_type derive_non_zero(RNG &rng) {
+                        scalar_field_value_type coeff = algebra::random_element<scalar_field_type>(rng);
+                        while (coeff.is_zero()) {
+                            coeff = algebra::random_element<scalar_field_type>(rng);
+                        }
+                        return coeff;
                     }
                 };
             }    // namespace snark
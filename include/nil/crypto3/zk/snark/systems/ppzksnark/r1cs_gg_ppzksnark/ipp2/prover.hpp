@@ -55,20 +55,6 @@ namespace nil {
     namespace crypto3 {
         namespace zk {
             namespace snark {
-                /// Returns the vector used for the linear combination fo the inner pairing product
-                /// between A and B for the Groth16 aggregation: A^r * B. It is required as it
-                /// is not enough to simply prove the ipp of A*B, we need a random linear
-                /// combination of those.
-                template<typename FieldType>
-                std::vector<typename FieldType::value_type>
-                    structured_scalar_power(std::size_t num, const typename FieldType::value_type &s) {
-                    std::vector<typename FieldType::value_type> powers = {FieldType::value_type::one()};
-                    for (int i = 1; i < num; i++) {
-                        powers.emplace_back(powers.back() * s);
-                    }
-                    return powers;
-                }
-
                 /// compress is similar to commit::{V,W}KEY::compress: it modifies the `vec`
                 /// vector by setting the value at index $i:0 -> split$  $vec[i] = vec[i] +
                 /// vec[i+split]^scaler$. The `vec` vector is half of its size after this call.
@@ -286,6 +272,8 @@ namespace nil {
                 /// It returns a proof containing all intermediate committed values, as well as
                 /// the challenges generated necessary to do the polynomial commitment proof
                 /// later in TIPP.
+                /// If prepared_vkey holds the line coefficients of vkey_input, the first (and largest)
+                /// round pairs against them instead of vkey_input.
                 template<typename CurveType, typename Hash = hashes::sha2<256>, typename InputG1Iterator1,
                          typename InputG2Iterator, typename InputG1Iterator2, typename InputScalarIterator>
                 typename std::enable_if<
@@ -304,7 +292,11 @@ namespace nil {
                                    InputG1Iterator2 c_last,
                                    const typename commitments::kzg_ipp2<CurveType>::vkey_type &vkey_input,
                                    const typename commitments::kzg_ipp2<CurveType>::wkey_type &wkey_input,
-                                   InputScalarIterator r_first, InputScalarIterator r_last) {
+                                   InputScalarIterator r_first, InputScalarIterator r_last,
+                                   const typename commitments::kzg_ipp2<CurveType>::prepared_vkey_type *prepared_vkey =
+                                       nullptr) {
+                    typedef commitments::kzg_ipp2<CurveType> commitment_type;
+
                     std::size_t input_len = std::distance(a_first, a_last);
                     BOOST_ASSERT(input_len >= 2);
                     BOOST_ASSERT((input_len & (input_len - 1)) == 0);
@@ -350,35 +342,34 @@ namespace nil {
                         auto [vk_left, vk_right] = vkey.split(split);
                         auto [wk_left, wk_right] = wkey.split(split);
 
-                        // TODO: parallel
+                        // Commitment keys are compressed after every round, so the prepared key only
+                        // matches in the first one.
+                        const bool use_prepared_vkey = prepared_vkey != nullptr && m_a.size() == input_len &&
+                                                       prepared_vkey->has_correct_len(input_len);
+
                         // See section 3.3 for paper version with equivalent names
                         // TIPP part
-                        typename commitments::kzg_ipp2<CurveType>::output_type tab_l =
-                            commitments::kzg_ipp2<CurveType>::pair(vk_left, wk_right, m_a.begin() + split, m_a.end(),
-                                                                   m_b.begin(), m_b.begin() + split);
-                        typename commitments::kzg_ipp2<CurveType>::output_type tab_r =
-                            commitments::kzg_ipp2<CurveType>::pair(vk_right, wk_left, m_a.begin(), m_a.begin() + split,
-                                                                   m_b.begin() + split, m_b.end());
+                        typename commitment_type::output_type tab_l =
+                            use_prepared_vkey ?
+                                commitment_type::pair_with_keys(prepared_vkey->a.begin(), prepared_vkey->b.begin(),
+                                                                wk_right.a.begin(), wk_right.b.begin(),
+                                                                m_a.begin() + split, m_a.end(), m_b.begin()) :
+                                commitment_type::pair(vk_left, wk_right, m_a.begin() + split, m_a.end(), m_b.begin(),
+                                                      m_b.begin() + split);
+                        typename commitment_type::output_type tab_r =
+                            use_prepared_vkey ?
+                                commitment_type::pair_with_keys(
+                                    prepared_vkey->a.begin() + split, prepared_vkey->b.begin() + split,
+                                    wk_left.a.begin(), wk_left.b.begin(), m_a.begin(), m_a.begin() + split,
+                                    m_b.begin() + split) :
+                                commitment_type::pair(vk_right, wk_left, m_a.begin(), m_a.begin() + split,
+                                                      m_b.begin() + split, m_b.end());
 
                         // \prod e(A_right,B_left)
-                        typename CurveType::gt_type::value_type zab_l = CurveType::gt_type::value_type::one();
-                        std::for_each(
-                            boost::make_zip_iterator(boost::make_tuple(m_a.begin() + split, m_b.begin())),
-                            boost::make_zip_iterator(boost::make_tuple(m_a.end(), m_b.begin() + split)),
-                            [&](const boost::tuple<const typename CurveType::template g1_type<>::value_type &,
-                                                   const typename CurveType::template g2_type<>::value_type &> &t) {
-                                zab_l = zab_l * algebra::pair<CurveType>(t.template get<0>(), t.template get<1>());
-                            });
-                        zab_l = algebra::final_exponentiation<CurveType>(zab_l);
-                        typename CurveType::gt_type::value_type zab_r = CurveType::gt_type::value_type::one();
-                        std::for_each(
-                            boost::make_zip_iterator(boost::make_tuple(m_a.begin(), m_b.begin() + split)),
-                            boost::make_zip_iterator(boost::make_tuple(m_a.begin() + split, m_b.end())),
-                            [&](const boost::tuple<const typename CurveType::template g1_type<>::value_type &,
-                                                   const typename CurveType::template g2_type<>::value_type &> &t) {
-                                zab_r = zab_r * algebra::pair<CurveType>(t.template get<0>(), t.template get<1>());
-                            });
-                        zab_r = algebra::final_exponentiation<CurveType>(zab_r);
+                        typename CurveType::gt_type::value_type zab_l = algebra::final_exponentiation<CurveType>(
+                            commitment_type::multi_miller_loop(m_a.begin() + split, m_a.end(), m_b.begin()));
+                        typename CurveType::gt_type::value_type zab_r = algebra::final_exponentiation<CurveType>(
+                            commitment_type::multi_miller_loop(m_a.begin(), m_a.begin() + split, m_b.begin() + split));
 
                         // MIPP part
                         // z_l = c[n':] ^ r[:n']
@@ -390,11 +381,18 @@ namespace nil {
                             algebra::multiexp<algebra::policies::multiexp_method_bos_coster>(
                                 m_c.begin(), m_c.begin() + split, m_r.begin() + split, m_r.end(), 1);
                         // u_l = c[n':] * v[:n']
-                        typename commitments::kzg_ipp2<CurveType>::output_type tuc_l =
-                            commitments::kzg_ipp2<CurveType>::single(vk_left, m_c.begin() + split, m_c.end());
+                        typename commitment_type::output_type tuc_l =
+                            use_prepared_vkey ?
+                                commitment_type::single_with_keys(prepared_vkey->a.begin(), prepared_vkey->b.begin(),
+                                                                  m_c.begin() + split, m_c.end()) :
+                                commitment_type::single(vk_left, m_c.begin() + split, m_c.end());
                         // u_r = c[:n'] * v[n':]
-                        typename commitments::kzg_ipp2<CurveType>::output_type tuc_r =
-                            commitments::kzg_ipp2<CurveType>::single(vk_right, m_c.begin(), m_c.begin() + split);
+                        typename commitment_type::output_type tuc_r =
+                            use_prepared_vkey ?
+                                commitment_type::single_with_keys(prepared_vkey->a.begin() + split,
+                                                                  prepared_vkey->b.begin() + split, m_c.begin(),
+                                                                  m_c.begin() + split) :
+                                commitment_type::single(vk_right, m_c.begin(), m_c.begin() + split);
 
                         // Fiat-Shamir challenge
                         // combine both TIPP and MIPP transcript
@@ -476,8 +474,9 @@ namespace nil {
                                     InputScalarIterator r_first, InputScalarIterator r_last) {
                     typename CurveType::scalar_field_type::value_type r_shift = *(r_first + 1);
                     // Run GIPA
-                    auto [proof, challenges, challenges_inv] = gipa_tipp_mipp<CurveType>(
-                        tr, a_first, a_last, b_first, b_last, c_first, c_last, srs.vkey, wkey, r_first, r_last);
+                    auto [proof, challenges, challenges_inv] =
+                        gipa_tipp_mipp<CurveType>(tr, a_first, a_last, b_first, b_last, c_first, c_last, srs.vkey,
+                                                  wkey, r_first, r_last, &srs.prepared_vkey);
 
                     // Prove final commitment keys are wellformed
                     // we reverse the transcript so the polynomial in kzg opening is constructed
@@ -542,11 +541,16 @@ namespace nil {
                     // A and B are committed together in this scheme
                     // we need to take the reference so the macro doesn't consume the value
                     // first
+                    const bool use_prepared_vkey = srs.prepared_vkey.has_correct_len(nproofs);
                     typename commitments::kzg_ipp2<CurveType>::output_type com_ab =
-                        commitments::kzg_ipp2<CurveType>::pair(srs.vkey, srs.wkey, a.begin(), a.end(), b.begin(),
-                                                               b.end());
+                        use_prepared_vkey ? commitments::kzg_ipp2<CurveType>::pair(
+                                                srs.prepared_vkey, srs.wkey, a.begin(), a.end(), b.begin(), b.end()) :
+                                            commitments::kzg_ipp2<CurveType>::pair(srs.vkey, srs.wkey, a.begin(),
+                                                                                   a.end(), b.begin(), b.end());
                     typename commitments::kzg_ipp2<CurveType>::output_type com_c =
-                        commitments::kzg_ipp2<CurveType>::single(srs.vkey, c.begin(), c.end());
+                        use_prepared_vkey ?
+                            commitments::kzg_ipp2<CurveType>::single(srs.prepared_vkey, c.begin(), c.end()) :
+                            commitments::kzg_ipp2<CurveType>::single(srs.vkey, c.begin(), c.end());
 
                     // Derive a random scalar to perform a linear combination of proofs
                     constexpr std::array<std::uint8_t, 9> application_tag = {'s', 'n', 'a', 'r', 'k',
@@ -579,18 +583,9 @@ namespace nil {
                                                const typename CurveType::scalar_field_type::value_type &> &t) {
                             b_r.emplace_back((t.template get<0>() * t.template get<1>()));
                         });
-                    // TODO: parallel
                     // compute A * B^r for the verifier
-                    // auto ip_ab = algebra::pair<CurveType>(a, b_r);
-                    typename CurveType::gt_type::value_type ip_ab = CurveType::gt_type::value_type::one();
-                    std::for_each(
-                        boost::make_zip_iterator(boost::make_tuple(a.begin(), b_r.begin())),
-                        boost::make_zip_iterator(boost::make_tuple(a.end(), b_r.end())),
-                        [&](const boost::tuple<const typename CurveType::template g1_type<>::value_type &,
-                                               const typename CurveType::template g2_type<>::value_type &> &t) {
-                            ip_ab = ip_ab * algebra::pair<CurveType>(t.template get<0>(), t.template get<1>());
-                        });
-                    ip_ab = algebra::final_exponentiation<CurveType>(ip_ab);
+                    typename CurveType::gt_type::value_type ip_ab = algebra::final_exponentiation<CurveType>(
+                        commitments::kzg_ipp2<CurveType>::multi_miller_loop(a.begin(), a.end(), b_r.begin()));
                     // compute C^r for the verifier
                     typename CurveType::template g1_type<>::value_type agg_c =
                         algebra::multiexp<algebra::policies::multiexp_method_bos_coster>(c.begin(), c.end(),
@@ -27,33 +27,80 @@
 #ifndef CRYPTO3_R1CS_GG_PPZKSNARK_AGGREGATE_IPP2_SRS_HPP
 #define CRYPTO3_R1CS_GG_PPZKSNARK_AGGREGATE_IPP2_SRS_HPP
 
+#include <cstdint>
 #include <vector>
 #include <tuple>
+#include <utility>
+
+#include <nil/crypto3/algebra/multiexp/multiexp.hpp>
+#include <nil/crypto3/algebra/marshalling.hpp>
 
 #include <nil/crypto3/zk/commitments/polynomial/kzg_ipp2.hpp>
 
 #include <nil/crypto3/zk/snark/systems/ppzksnark/r1cs_gg_ppzksnark/keypair.hpp>
 #include <nil/crypto3/zk/snark/systems/ppzksnark/r1cs_gg_ppzksnark/modes.hpp>
 
+#include <nil/actor/core/thread_pool.hpp>
+#include <nil/actor/core/parallelization_utils.hpp>
+
 namespace nil {
     namespace crypto3 {
         namespace zk {
             namespace snark {
+                /// Returns the vector used for the linear combination fo the inner pairing product
+                /// between A and B for the Groth16 aggregation: A^r * B. It is required as it
+                /// is not enough to simply prove the ipp of A*B, we need a random linear
+                /// combination of those.
+                /// The powers are computed in parallel blocks, every block starting from $s^{begin}$.
+                template<typename FieldType>
+                std::vector<typename FieldType::value_type>
+                    structured_scalar_power(std::size_t num, const typename FieldType::value_type &s) {
+                    std::vector<typename FieldType::value_type> powers(num);
+                    wait_for_all(parallel_run_in_chunks<void>(num, [&powers, &s](std::size_t begin, std::size_t end) {
+                        typename FieldType::value_type power = s.pow(begin);
+                        for (std::size_t i = begin; i < end; ++i) {
+                            powers[i] = power;
+                            power = power * s;
+                        }
+                    }));
+                    return powers;
+                }
+
+                /// Returns $\{g^{s_i}\}$ for the generator $g$ of GroupType, in affine form.
+                /// All exponentiations share one fixed-base window table of $g$ and are spread
+                /// across the thread pool.
                 template<typename GroupType,
                          typename ScalarFieldType = typename GroupType::curve_type::scalar_field_type>
                 std::vector<typename GroupType::value_type>
-                    structured_generators_scalar_power(std::size_t n, const typename ScalarFieldType::value_type &s) {
-                    BOOST_ASSERT(n > 0);
+                    structured_generators_scalar_power(
+                        const std::vector<typename ScalarFieldType::value_type> &powers) {
+                    BOOST_ASSERT(!powers.empty());
 
-                    std::vector<typename GroupType::value_type> powers_of_g {GroupType::value_type::one()};
+                    const std::size_t scalar_size = ScalarFieldType::value_bits;
+                    const std::size_t window_size = algebra::get_exp_window_size<GroupType>(powers.size());
+                    const algebra::window_table<GroupType> table =
+                        algebra::get_window_table<GroupType>(scalar_size, window_size, GroupType::value_type::one());
 
-                    for (std::size_t i = 1; i < n; i++) {
-                        powers_of_g.emplace_back(powers_of_g.back() * s);
-                    }
+                    std::vector<typename GroupType::value_type> powers_of_g(powers.size());
+                    parallel_for(0, powers.size(), [&](std::size_t i) {
+                        powers_of_g[i] = algebra::windowed_exp<GroupType, ScalarFieldType>(scalar_size, window_size,
+                                                                                           table, powers[i]);
+                    });
+                    algebra::batch_to_special<GroupType>(powers_of_g);
 
                     return powers_of_g;
                 }
 
+                template<typename GroupType,
+                         typename ScalarFieldType = typename GroupType::curve_type::scalar_field_type>
+                std::vector<typename GroupType::value_type>
+                    structured_generators_scalar_power(std::size_t n, const typename ScalarFieldType::value_type &s) {
+                    BOOST_ASSERT(n > 0);
+
+                    return structured_generators_scalar_power<GroupType, ScalarFieldType>(
+                        structured_scalar_power<ScalarFieldType>(n, s));
+                }
+
                 /// ProverSRS is the specialized SRS version for the prover for a specific number of proofs to
                 /// aggregate. It contains as well the commitment keys for this specific size.
                 /// Note the size must be a power of two for the moment - if it is not, padding must be
@@ -70,6 +117,7 @@ namespace nil {
                     typedef commitments::kzg_ipp2<CurveType> commitment_type;
                     typedef typename commitment_type::vkey_type vkey_type;
                     typedef typename commitment_type::wkey_type wkey_type;
+                    typedef typename commitment_type::prepared_vkey_type prepared_vkey_type;
 
                     /// Returns true if commitment keys have the exact required length.
                     /// It is necessary for the IPP scheme to work that commitment
@@ -93,6 +141,9 @@ namespace nil {
                     vkey_type vkey;
                     /// commitment key using in TIPP
                     wkey_type wkey;
+                    /// Miller-loop line coefficients of vkey, filled by specialize(). Left empty, the
+                    /// prover falls back to pairing against vkey directly.
+                    prepared_vkey_type prepared_vkey;
                 };
 
                 /// Contains the necessary elements to verify an aggregated Groth16 proof; it is of fixed size
@@ -128,6 +179,7 @@ namespace nil {
                     typedef typename g1_type::value_type g1_value_type;
                     typedef typename g2_type::value_type g2_value_type;
                     typedef typename scalar_field_type::value_type scalar_field_value_type;
+                    typedef nil::marshalling::bincode::curve<curve_type> bincode;
 
                     typedef r1cs_gg_ppzksnark_aggregate_proving_srs<CurveType> proving_srs_type;
                     typedef r1cs_gg_ppzksnark_aggregate_verification_srs<CurveType> verification_srs_type;
@@ -144,11 +196,104 @@ namespace nil {
 
                     r1cs_gg_ppzksnark_aggregate_srs() = default;
                     r1cs_gg_ppzksnark_aggregate_srs(std::size_t num_proofs, const scalar_field_value_type &alpha,
-                                                    const scalar_field_value_type &beta) :
-                        g_alpha_powers(structured_generators_scalar_power<g1_type>(2 * num_proofs, alpha)),
-                        h_alpha_powers(structured_generators_scalar_power<g2_type>(2 * num_proofs, alpha)),
-                        g_beta_powers(structured_generators_scalar_power<g1_type>(2 * num_proofs, beta)),
-                        h_beta_powers(structured_generators_scalar_power<g2_type>(2 * num_proofs, beta)) {
+                                                    const scalar_field_value_type &beta) {
+                        // the scalar powers are shared between the G1 and G2 halves
+                        const std::vector<scalar_field_value_type> alpha_powers =
+                            structured_scalar_power<scalar_field_type>(2 * num_proofs, alpha);
+                        const std::vector<scalar_field_value_type> beta_powers =
+                            structured_scalar_power<scalar_field_type>(2 * num_proofs, beta);
+
+                        g_alpha_powers = structured_generators_scalar_power<g1_type>(alpha_powers);
+                        h_alpha_powers = structured_generators_scalar_power<g2_type>(alpha_powers);
+                        g_beta_powers = structured_generators_scalar_power<g1_type>(beta_powers);
+                        h_beta_powers = structured_generators_scalar_power<g2_type>(beta_powers);
+                    }
+
+                    /// Serialises the SRS: the number of powers as a little-endian 64-bit word, followed
+                    /// by g_alpha_powers, h_alpha_powers, g_beta_powers and h_beta_powers as compressed
+                    /// points. Generating the SRS is far more expensive than reading it back, so the
+                    /// result is meant to be stored and reused.
+                    std::vector<std::uint8_t> to_bytes() const {
+                        BOOST_ASSERT(h_alpha_powers.size() == g_alpha_powers.size());
+                        BOOST_ASSERT(g_beta_powers.size() == g_alpha_powers.size());
+                        BOOST_ASSERT(h_beta_powers.size() == g_alpha_powers.size());
+
+                        const std::size_t n = g_alpha_powers.size();
+                        std::vector<std::uint8_t> result(serialized_size(n));
+
+                        std::uint64_t len = n;
+                        for (std::size_t i = 0; i < sizeof(std::uint64_t); ++i) {
+                            result[i] = static_cast<std::uint8_t>(len >> (8 * i));
+                        }
+
+                        auto g1_first = result.begin() + sizeof(std::uint64_t);
+                        auto h1_first = g1_first + n * bincode::g1_octets_num;
+                        auto g2_first = h1_first + n * bincode::g2_octets_num;
+                        auto h2_first = g2_first + n * bincode::g1_octets_num;
+                        parallel_for(0, n, [&](std::size_t i) {
+                            bincode::template point_to_bytes<g1_type>(g_alpha_powers[i],
+                                                                      g1_first + i * bincode::g1_octets_num,
+                                                                      g1_first + (i + 1) * bincode::g1_octets_num);
+                            bincode::template point_to_bytes<g2_type>(h_alpha_powers[i],
+                                                                      h1_first + i * bincode::g2_octets_num,
+                                                                      h1_first + (i + 1) * bincode::g2_octets_num);
+                            bincode::template point_to_bytes<g1_type>(g_beta_powers[i],
+                                                                      g2_first + i * bincode::g1_octets_num,
+                                                                      g2_first + (i + 1) * bincode::g1_octets_num);
+                            bincode::template point_to_bytes<g2_type>(h_beta_powers[i],
+                                                                      h2_first + i * bincode::g2_octets_num,
+                                                                      h2_first + (i + 1) * bincode::g2_octets_num);
+                        });
+
+                        return result;
+                    }
+
+                    /// Reads back an SRS written by to_bytes(). Returns false in the first element if the
+                    /// input length does not match the encoded number of powers.
+                    template<typename InputIterator>
+                    static std::pair<bool, r1cs_gg_ppzksnark_aggregate_srs> from_bytes(InputIterator first,
+                                                                                      InputIterator last) {
+                        r1cs_gg_ppzksnark_aggregate_srs srs;
+
+                        const std::size_t size = std::distance(first, last);
+                        if (size < sizeof(std::uint64_t)) {
+                            return std::make_pair(false, srs);
+                        }
+                        std::uint64_t len = 0;
+                        for (std::size_t i = 0; i < sizeof(std::uint64_t); ++i) {
+                            len |= static_cast<std::uint64_t>(static_cast<std::uint8_t>(*(first + i))) << (8 * i);
+                        }
+                        // compare before multiplying, a corrupted length must not overflow serialized_size
+                        const std::size_t n = len;
+                        if (n > size || size != serialized_size(n)) {
+                            return std::make_pair(false, srs);
+                        }
+
+                        srs.g_alpha_powers.resize(n);
+                        srs.h_alpha_powers.resize(n);
+                        srs.g_beta_powers.resize(n);
+                        srs.h_beta_powers.resize(n);
+
+                        InputIterator g1_first = first + sizeof(std::uint64_t);
+                        InputIterator h1_first = g1_first + n * bincode::g1_octets_num;
+                        InputIterator g2_first = h1_first + n * bincode::g2_octets_num;
+                        InputIterator h2_first = g2_first + n * bincode::g1_octets_num;
+                        parallel_for(0, n, [&](std::size_t i) {
+                            srs.g_alpha_powers[i] = bincode::g1_point_from_bytes(
+                                g1_first + i * bincode::g1_octets_num, g1_first + (i + 1) * bincode::g1_octets_num);
+                            srs.h_alpha_powers[i] = bincode::g2_point_from_bytes(
+                                h1_first + i * bincode::g2_octets_num, h1_first + (i + 1) * bincode::g2_octets_num);
+                            srs.g_beta_powers[i] = bincode::g1_point_from_bytes(
+                                g2_first + i * bincode::g1_octets_num, g2_first + (i + 1) * bincode::g1_octets_num);
+                            srs.h_beta_powers[i] = bincode::g2_point_from_bytes(
+                                h2_first + i * bincode::g2_octets_num, h2_first + (i + 1) * bincode::g2_octets_num);
+                        });
+
+                        return std::make_pair(true, srs);
+                    }
+
+                    static std::size_t serialized_size(std::size_t n) {
+                        return sizeof(std::uint64_t) + 2 * n * (bincode::g1_octets_num + bincode::g2_octets_num);
                     }
 
                     /// specializes returns the prover and verifier SRS for a specific number of
@@ -192,7 +337,8 @@ namespace nil {
                                                {g_beta_powers.begin() + g_low, g_beta_powers.begin() + g_up},
                                                {h_beta_powers.begin() + h_low, h_beta_powers.begin() + h_up},
                                                vkey,
-                                               wkey};
+                                               wkey,
+                                               proving_srs_type::commitment_type::prepare(vkey)};
                         verification_srs_type vk = {n,
                                                     g_alpha_powers[0],
                                                     h_alpha_powers[0],
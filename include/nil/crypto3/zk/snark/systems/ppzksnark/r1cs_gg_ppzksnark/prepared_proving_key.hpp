@@ -0,0 +1,125 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_R1CS_GG_PPZKSNARK_PREPARED_PROVING_KEY_HPP
+#define CRYPTO3_R1CS_GG_PPZKSNARK_PREPARED_PROVING_KEY_HPP
+
+#include <nil/crypto3/zk/math/fixed_base_multiexp.hpp>
+#include <nil/crypto3/zk/snark/systems/ppzksnark/r1cs_gg_ppzksnark/proving_key.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace zk {
+            namespace snark {
+                /**
+                 * A proving key for the R1CS GG-ppzkSNARK together with precomputed fixed-base
+                 * tables for its A, B, H and L queries.
+                 *
+                 * The queries never change between proofs for the same circuit, so the window
+                 * shifts of every base are computed once and reused by every proof. The total
+                 * size of the tables is bounded by a user-set memory limit, split between the
+                 * queries proportionally to their sizes. A query whose table does not fit into
+                 * its share is left unprepared and proven with the regular multi-exponentiation.
+                 */
+                template<typename ProvingKeyType>
+                struct r1cs_gg_ppzksnark_prepared_proving_key {
+                    typedef ProvingKeyType proving_key_type;
+                    typedef typename proving_key_type::curve_type curve_type;
+
+                    typedef typename curve_type::scalar_field_type scalar_field_type;
+                    typedef typename curve_type::template g1_type<> g1_type;
+                    typedef typename curve_type::template g2_type<> g2_type;
+                    typedef typename commitments::knowledge_commitment<g2_type, g1_type>::value_type kc_value_type;
+
+                    typedef math::fixed_base_multiexp_table<typename g1_type::value_type, scalar_field_type>
+                        g1_table_type;
+                    typedef math::fixed_base_multiexp_table<kc_value_type, scalar_field_type> kc_table_type;
+
+                    proving_key_type proving_key;
+
+                    g1_table_type A_table;
+                    kc_table_type B_table;
+                    g1_table_type H_table;
+                    g1_table_type L_table;
+
+                    r1cs_gg_ppzksnark_prepared_proving_key() = default;
+
+                    r1cs_gg_ppzksnark_prepared_proving_key(const proving_key_type &proving_key,
+                                                           std::size_t memory_limit) :
+                        proving_key(proving_key) {
+                        prepare(memory_limit);
+                    }
+
+                    r1cs_gg_ppzksnark_prepared_proving_key(proving_key_type &&proving_key, std::size_t memory_limit) :
+                        proving_key(std::move(proving_key)) {
+                        prepare(memory_limit);
+                    }
+
+                    /**
+                     * Memory taken by the precomputed tables, in bytes.
+                     */
+                    std::size_t tables_size_in_bytes() const {
+                        return A_table.size_in_bytes() + B_table.size_in_bytes() + H_table.size_in_bytes() +
+                               L_table.size_in_bytes();
+                    }
+
+                private:
+                    template<typename TableType, typename InputIterator>
+                    static TableType make_table(InputIterator bases_begin, InputIterator bases_end,
+                                                std::size_t memory_limit) {
+                        const std::size_t window_bits =
+                            TableType::window_bits_for_budget(std::distance(bases_begin, bases_end), memory_limit);
+                        if (window_bits == 0) {
+                            return TableType();
+                        }
+                        return TableType(bases_begin, bases_end, window_bits);
+                    }
+
+                    void prepare(std::size_t memory_limit) {
+                        const std::size_t A_bytes = proving_key.A_query.size() * sizeof(typename g1_type::value_type);
+                        const std::size_t B_bytes = proving_key.B_query.values.size() * sizeof(kc_value_type);
+                        const std::size_t H_bytes = proving_key.H_query.size() * sizeof(typename g1_type::value_type);
+                        const std::size_t L_bytes = proving_key.L_query.size() * sizeof(typename g1_type::value_type);
+                        const double total_bytes = A_bytes + B_bytes + H_bytes + L_bytes;
+                        if (total_bytes == 0) {
+                            return;
+                        }
+
+                        A_table = make_table<g1_table_type>(proving_key.A_query.begin(), proving_key.A_query.end(),
+                                                            memory_limit * (A_bytes / total_bytes));
+                        B_table = make_table<kc_table_type>(proving_key.B_query.values.begin(),
+                                                            proving_key.B_query.values.end(),
+                                                            memory_limit * (B_bytes / total_bytes));
+                        H_table = make_table<g1_table_type>(proving_key.H_query.begin(), proving_key.H_query.end(),
+                                                            memory_limit * (H_bytes / total_bytes));
+                        L_table = make_table<g1_table_type>(proving_key.L_query.begin(), proving_key.L_query.end(),
+                                                            memory_limit * (L_bytes / total_bytes));
+                    }
+                };
+            }    // namespace snark
+        }        // namespace zk
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_R1CS_GG_PPZKSNARK_PREPARED_PROVING_KEY_HPP
@@ -39,6 +39,10 @@
 
 #include <nil/crypto3/zk/snark/reductions/r1cs_to_qap.hpp>
 #include <nil/crypto3/zk/snark/systems/ppzksnark/r1cs_gg_ppzksnark/detail/basic_policy.hpp>
+#include <nil/crypto3/zk/snark/systems/ppzksnark/r1cs_gg_ppzksnark/prepared_proving_key.hpp>
+
+#include <nil/actor/core/thread_pool.hpp>
+#include <nil/actor/core/parallelization_utils.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -68,6 +72,7 @@ namespace nil {
                     typedef typename policy_type::primary_input_type primary_input_type;
                     typedef typename policy_type::auxiliary_input_type auxiliary_input_type;
                     typedef typename policy_type::proving_key_type proving_key_type;
+                    typedef typename policy_type::prepared_proving_key_type prepared_proving_key_type;
                     typedef typename policy_type::proof_type proof_type;
 
                     static inline proof_type process(const proving_key_type &proving_key,
@@ -156,6 +161,129 @@ namespace nil {
 
                         return proof_type(std::move(g1_A), std::move(g2_B), std::move(g1_C));
                     }
+
+                    /**
+                     * Same as above, but the A, B, H and L multi-exponentiations use the fixed-base
+                     * tables of a prepared proving key (where present) and run concurrently.
+                     */
+                    static inline proof_type process(const prepared_proving_key_type &prepared_proving_key,
+                                                     const primary_input_type &primary_input,
+                                                     const auxiliary_input_type &auxiliary_input) {
+                        const proving_key_type &proving_key = prepared_proving_key.proving_key;
+
+                        BOOST_ASSERT(proving_key.constraint_system.is_satisfied(primary_input, auxiliary_input));
+
+                        const qap_witness<scalar_field_type> qap_wit =
+                            reductions::r1cs_to_qap<scalar_field_type>::witness_map(
+                                proving_key.constraint_system, primary_input, auxiliary_input,
+                                scalar_field_type::value_type::zero(), scalar_field_type::value_type::zero(),
+                                scalar_field_type::value_type::zero());
+
+                        BOOST_ASSERT(qap_wit.coefficients_for_H[qap_wit.degree - 1].is_zero());
+                        BOOST_ASSERT(qap_wit.coefficients_for_H[qap_wit.degree].is_zero());
+
+                        const typename scalar_field_type::value_type r = algebra::random_element<scalar_field_type>();
+                        const typename scalar_field_type::value_type s = algebra::random_element<scalar_field_type>();
+
+                        std::vector<typename scalar_field_type::value_type> const_padded_assignment(
+                            1, scalar_field_type::value_type::one());
+                        const_padded_assignment.insert(const_padded_assignment.end(),
+                                                       qap_wit.coefficients_for_ABCs.begin(),
+                                                       qap_wit.coefficients_for_ABCs.end());
+
+                        // Each query is a separate task on the HIGH level pool, table evaluation uses the LOW one.
+                        ThreadPool &pool = ThreadPool::get_instance(ThreadPool::PoolLevel::HIGH);
+
+                        std::future<typename g1_type::value_type> evaluation_At =
+                            pool.post<typename g1_type::value_type>([&]() {
+                                if (!prepared_proving_key.A_table.empty()) {
+                                    return prepared_proving_key.A_table.evaluate(
+                                        const_padded_assignment.begin(),
+                                        const_padded_assignment.begin() + qap_wit.num_variables + 1);
+                                }
+                                return algebra::multiexp_with_mixed_addition<algebra::policies::multiexp_method_BDLO12>(
+                                    proving_key.A_query.begin(),
+                                    proving_key.A_query.begin() + qap_wit.num_variables + 1,
+                                    const_padded_assignment.begin(),
+                                    const_padded_assignment.begin() + qap_wit.num_variables + 1,
+                                    1);
+                            });
+
+                        typedef typename commitments::knowledge_commitment<g2_type, g1_type>::value_type kc_value_type;
+
+                        std::future<kc_value_type> evaluation_Bt = pool.post<kc_value_type>([&]() {
+                            if (!prepared_proving_key.B_table.empty()) {
+                                // B_query is sparse: gather the scalars of its non-zero positions.
+                                std::vector<typename scalar_field_type::value_type> B_scalars;
+                                B_scalars.reserve(proving_key.B_query.indices.size());
+                                for (std::size_t index : proving_key.B_query.indices) {
+                                    if (index >= qap_wit.num_variables + 1) {
+                                        break;
+                                    }
+                                    B_scalars.emplace_back(const_padded_assignment[index]);
+                                }
+                                return prepared_proving_key.B_table.evaluate(B_scalars.begin(), B_scalars.end());
+                            }
+                            return commitments::kc_multiexp_with_mixed_addition<
+                                algebra::policies::multiexp_method_BDLO12>(
+                                proving_key.B_query,
+                                0,
+                                qap_wit.num_variables + 1,
+                                const_padded_assignment.begin(),
+                                const_padded_assignment.begin() + qap_wit.num_variables + 1,
+                                1);
+                        });
+
+                        std::future<typename g1_type::value_type> evaluation_Ht =
+                            pool.post<typename g1_type::value_type>([&]() {
+                                if (!prepared_proving_key.H_table.empty()) {
+                                    return prepared_proving_key.H_table.evaluate(
+                                        qap_wit.coefficients_for_H.begin(),
+                                        qap_wit.coefficients_for_H.begin() + (qap_wit.degree - 1));
+                                }
+                                return algebra::multiexp<algebra::policies::multiexp_method_BDLO12>(
+                                    proving_key.H_query.begin(),
+                                    proving_key.H_query.begin() + (qap_wit.degree - 1),
+                                    qap_wit.coefficients_for_H.begin(),
+                                    qap_wit.coefficients_for_H.begin() + (qap_wit.degree - 1),
+                                    1);
+                            });
+
+                        std::future<typename g1_type::value_type> evaluation_Lt =
+                            pool.post<typename g1_type::value_type>([&]() {
+                                if (!prepared_proving_key.L_table.empty()) {
+                                    return prepared_proving_key.L_table.evaluate(
+                                        const_padded_assignment.begin() + qap_wit.num_inputs + 1,
+                                        const_padded_assignment.begin() + qap_wit.num_variables + 1);
+                                }
+                                return algebra::multiexp_with_mixed_addition<algebra::policies::multiexp_method_BDLO12>(
+                                    proving_key.L_query.begin(),
+                                    proving_key.L_query.end(),
+                                    const_padded_assignment.begin() + qap_wit.num_inputs + 1,
+                                    const_padded_assignment.begin() + qap_wit.num_variables + 1,
+                                    1);
+                            });
+
+                        const typename g1_type::value_type At = evaluation_At.get();
+                        const kc_value_type Bt = evaluation_Bt.get();
+                        const typename g1_type::value_type Ht = evaluation_Ht.get();
+                        const typename g1_type::value_type Lt = evaluation_Lt.get();
+
+                        /* A = alpha + sum_i(a_i*A_i(t)) + r*delta */
+                        typename g1_type::value_type g1_A = proving_key.alpha_g1 + At + r * proving_key.delta_g1;
+
+                        /* B = beta + sum_i(a_i*B_i(t)) + s*delta */
+                        typename g1_type::value_type g1_B = proving_key.beta_g1 + Bt.h + s * proving_key.delta_g1;
+                        typename g2_type::value_type g2_B = proving_key.beta_g2 + Bt.g + s * proving_key.delta_g2;
+
+                        /* C = sum_i(a_i*((beta*A_i(t) + alpha*B_i(t) + C_i(t)) + H(t)*Z(t))/delta) + A*s + r*b -
+                         * r*s*delta
+                         */
+                        typename g1_type::value_type g1_C =
+                            Ht + Lt + s * g1_A + r * g1_B - (r * s) * proving_key.delta_g1;
+
+                        return proof_type(std::move(g1_A), std::move(g2_B), std::move(g1_C));
+                    }
                 };
             }    // namespace snark
         }        // namespace zk
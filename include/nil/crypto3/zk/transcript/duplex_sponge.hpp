@@ -0,0 +1,310 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+// @file Declaration of the duplex-sponge Fiat-Shamir transcript.
+//
+// The sequential transcript hashes the previous state together with every absorbed
+// item, so each item costs a whole hash. The duplex transcript keeps the sponge state
+// in place instead: absorbed data only fills the rate, a permutation runs when the rate
+// is full or a challenge is needed, and copies of the transcript, e.g. for grinding,
+// never allocate.
+//
+// It is selected by using duplex_sponge<Hash> as the transcript hash of the commitment
+// scheme, which the placeholder params take their transcript from:
+//
+//     using lpc_params_type = commitments::list_polynomial_commitment_params<
+//         merkle_hash_type, transcript::duplex_sponge<transcript_hash_type>, m>;
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ZK_TRANSCRIPT_DUPLEX_SPONGE_HPP
+#define CRYPTO3_ZK_TRANSCRIPT_DUPLEX_SPONGE_HPP
+
+#include <array>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+
+#include <nil/crypto3/zk/transcript/fiat_shamir.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace zk {
+            namespace transcript {
+
+                /*!
+                 * @brief Transcript hash tag: Hash used as a duplex sponge by fiat_shamir_heuristic_sequential.
+                 * Everything else sees the same hash, all typedefs of Hash are inherited.
+                 */
+                template<typename Hash>
+                struct duplex_sponge : public Hash {
+                    typedef Hash hash_type;
+                };
+
+                namespace detail {
+
+                    /*!
+                     * @brief Duplex sponge over the Poseidon permutation. Field elements are added to the
+                     * rate, a permutation runs when the rate is full, and up to rate challenges are squeezed
+                     * per permutation.
+                     *
+                     * The capacity starts from domain_tag, so the sponge never starts from the zero state of
+                     * the plain Poseidon hash. Before the first squeeze after absorbing, the absorbed elements
+                     * are padded with a single one, so [x] and [x, 0] give different challenges.
+                     */
+                    template<typename Hash>
+                    class algebraic_duplex_transcript {
+                    public:
+                        typedef Hash hash_type;
+                        typedef typename hash_type::policy_type policy_type;
+                        typedef typename policy_type::field_type field_type;
+                        typedef hashes::detail::poseidon_permutation<policy_type> permutation_type;
+                        typedef typename permutation_type::state_type state_type;
+
+                        constexpr static const std::size_t rate = policy_type::rate;
+                        constexpr static const std::size_t capacity = policy_type::state_words - policy_type::rate;
+
+                        // "duplex" in ASCII.
+                        constexpr static const std::uint64_t domain_tag = 0x6475706c6578;
+
+                        algebraic_duplex_transcript() : squeezing(false), position(0) {
+                            state.fill(field_type::value_type::zero());
+                            state[0] = typename field_type::value_type(domain_tag);
+                        }
+
+                        template<typename InputRange>
+                        algebraic_duplex_transcript(const InputRange &r) : algebraic_duplex_transcript() {
+                            if (r.size() != 0) {
+                                (*this)(r);
+                            }
+                        }
+
+                        template<typename InputIterator>
+                        algebraic_duplex_transcript(InputIterator first, InputIterator last) :
+                            algebraic_duplex_transcript() {
+                            (*this)(first, last);
+                        }
+
+                        template<typename Input>
+                        void operator()(const Input &input) {
+                            if constexpr (algebra::is_field_element<Input>::value) {
+                                absorb(input);
+                            } else if constexpr (algebra::is_field_element<typename Input::value_type>::value) {
+                                for (const auto &element : input) {
+                                    absorb(element);
+                                }
+                            } else {
+                                absorb(static_cast<typename hash_type::digest_type>(hash<hash_type>(input)));
+                            }
+                        }
+
+                        template<typename InputIterator>
+                        void operator()(InputIterator first, InputIterator last) {
+                            for (; first != last; ++first) {
+                                (*this)(*first);
+                            }
+                        }
+
+                        template<typename Field>
+                        typename Field::value_type challenge() {
+                            return squeeze();
+                        }
+
+                        template<typename Integral>
+                        Integral int_challenge() {
+                            typedef typename std::make_unsigned<Integral>::type unsigned_type;
+                            typename field_type::integral_type raw_result(squeeze().data);
+                            raw_result &= typename field_type::integral_type(std::numeric_limits<unsigned_type>::max());
+                            return static_cast<Integral>(raw_result);
+                        }
+
+                    private:
+                        void absorb(const typename field_type::value_type &element) {
+                            if (squeezing) {
+                                squeezing = false;
+                                position = 0;
+                            }
+                            if (position == rate) {
+                                permutation_type::permute(state);
+                                position = 0;
+                            }
+                            state[capacity + position] += element;
+                            position++;
+                        }
+
+                        typename field_type::value_type squeeze() {
+                            if (!squeezing) {
+                                // 10* padding of the absorbed elements.
+                                if (position == rate) {
+                                    permutation_type::permute(state);
+                                    position = 0;
+                                }
+                                state[capacity + position] += field_type::value_type::one();
+                                permutation_type::permute(state);
+                                squeezing = true;
+                                position = 0;
+                            } else if (position == rate) {
+                                permutation_type::permute(state);
+                                position = 0;
+                            }
+                            return state[capacity + position++];
+                        }
+
+                        state_type state;
+                        bool squeezing;
+                        std::size_t position;
+                    };
+
+                    /*!
+                     * @brief Duplex transcript over a byte-oriented hash. The absorbed bytes go straight into
+                     * an accumulator seeded with the state, so consecutive absorbs cost a single hash, and a
+                     * challenge folds them into the next state. Every challenge is one digest, as with the
+                     * sequential transcript.
+                     *
+                     * Every absorbed item is prefixed with its length, so the item boundaries are part of
+                     * the transcript: absorbing a and b differs from absorbing their concatenation.
+                     */
+                    template<typename Hash>
+                    class byte_duplex_transcript {
+                    public:
+                        typedef Hash hash_type;
+                        typedef typename boost::multiprecision::cpp_int_modular_backend<hash_type::digest_bits>
+                            modular_backend_of_hash_size;
+
+                        byte_duplex_transcript() : state(hash<hash_type>({0})), absorbed(false) {
+                            restart();
+                        }
+
+                        template<typename InputRange>
+                        byte_duplex_transcript(const InputRange &r) : state(hash<hash_type>(r)), absorbed(false) {
+                            restart();
+                        }
+
+                        template<typename InputIterator>
+                        byte_duplex_transcript(InputIterator first, InputIterator last) :
+                            state(hash<hash_type>(first, last)), absorbed(false) {
+                            restart();
+                        }
+
+                        template<typename InputRange>
+                        void operator()(const InputRange &r) {
+                            absorb_length(std::distance(std::begin(r), std::end(r)));
+                            hash<hash_type>(r, acc);
+                            absorbed = true;
+                        }
+
+                        template<typename InputIterator>
+                        void operator()(InputIterator first, InputIterator last) {
+                            absorb_length(std::distance(first, last));
+                            hash<hash_type>(first, last, acc);
+                            absorbed = true;
+                        }
+
+                        template<typename Field>
+                        typename Field::value_type challenge() {
+                            squeeze();
+                            nil::marshalling::status_type status;
+                            boost::multiprecision::number<modular_backend_of_hash_size> raw_result =
+                                nil::marshalling::pack(state, status);
+                            BOOST_ASSERT(status == nil::marshalling::status_type::success);
+                            return raw_result;
+                        }
+
+                        template<typename Integral>
+                        Integral int_challenge() {
+                            typedef typename std::make_unsigned<Integral>::type unsigned_type;
+                            squeeze();
+                            nil::marshalling::status_type status;
+                            boost::multiprecision::number<modular_backend_of_hash_size> raw_result =
+                                nil::marshalling::pack(state, status);
+                            raw_result &= std::numeric_limits<unsigned_type>::max();
+                            return static_cast<Integral>(raw_result);
+                        }
+
+                    private:
+                        // Length of an item in its elements, as 8 big-endian bytes.
+                        void absorb_length(std::uint64_t length) {
+                            std::array<std::uint8_t, 8> bytes;
+                            for (std::size_t i = 0; i < bytes.size(); i++) {
+                                bytes[bytes.size() - 1 - i] = std::uint8_t(length >> (8 * i));
+                            }
+                            hash<hash_type>(bytes, acc);
+                        }
+
+                        void squeeze() {
+                            if (absorbed) {
+                                state = accumulators::extract::hash<hash_type>(acc);
+                                absorbed = false;
+                            } else {
+                                state = hash<hash_type>(state);
+                            }
+                            restart();
+                        }
+
+                        void restart() {
+                            acc = accumulator_set<hash_type>();
+                            hash<hash_type>(state, acc);
+                        }
+
+                        typename hash_type::digest_type state;
+                        accumulator_set<hash_type> acc;
+                        bool absorbed;
+                    };
+                }    // namespace detail
+
+                /*!
+                 * @brief Duplex-sponge Fiat–Shamir transcript, selected by the duplex_sponge<Hash> tag.
+                 */
+                template<typename Hash>
+                struct fiat_shamir_heuristic_sequential<duplex_sponge<Hash>, void>
+                    : public std::conditional<
+                          nil::crypto3::hashes::is_specialization_of<nil::crypto3::hashes::poseidon, Hash>::value,
+                          detail::algebraic_duplex_transcript<Hash>,
+                          detail::byte_duplex_transcript<Hash>>::type {
+                    typedef typename std::conditional<
+                        nil::crypto3::hashes::is_specialization_of<nil::crypto3::hashes::poseidon, Hash>::value,
+                        detail::algebraic_duplex_transcript<Hash>,
+                        detail::byte_duplex_transcript<Hash>>::type base_type;
+                    typedef Hash hash_type;
+
+                    using base_type::base_type;
+
+                    fiat_shamir_heuristic_sequential() : base_type() {
+                    }
+
+                    template<typename Field, std::size_t N>
+                    std::array<typename Field::value_type, N> challenges() {
+                        std::array<typename Field::value_type, N> result;
+                        for (auto &ch : result) {
+                            ch = this->template challenge<Field>();
+                        }
+                        return result;
+                    }
+                };
+
+            }    // namespace transcript
+        }        // namespace zk
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ZK_TRANSCRIPT_DUPLEX_SPONGE_HPP
@@ -119,8 +119,8 @@ namespace nil {
                         return scalar_challenge_type(squeeze(CHALLENGE_LENGTH_IN_LIMBS));
                     }
 
-                    void absorb_evaluations(std::vector<typename scalar_field_type::value_type>& p,
-                                            snark::proof_evaluation_type<std::vector<typename scalar_field_type::value_type>>& e){
+                    void absorb_evaluations(const std::vector<typename scalar_field_type::value_type>& p,
+                                            const snark::proof_evaluation_type<std::vector<typename scalar_field_type::value_type>>& e){
                         this->last_squeezed.clear();
                         this->sponge.absorb(p);
 
@@ -202,7 +202,7 @@ namespace nil {
                         return res;
                     }
 
-                    void absorb_g(std::vector<typename group_type::value_type>& gs){
+                    void absorb_g(const std::vector<typename group_type::value_type>& gs){
                         this->last_squeezed.clear();
                         for(auto &g : gs){
                             absorb_g(g);
@@ -143,4 +143,100 @@ BOOST_AUTO_TEST_CASE(fri_basic_test) {
     typename FieldType::value_type prover_next_challenge = transcript.template challenge<FieldType>();
     BOOST_CHECK(verifier_next_challenge == prover_next_challenge);
 }
+
+BOOST_AUTO_TEST_CASE(fri_verify_lambda_test) {
+    using curve_type = algebra::curves::pallas;
+    using FieldType = typename curve_type::base_field_type;
+
+    typedef hashes::sha2<256> merkle_hash_type;
+    typedef hashes::sha2<256> transcript_hash_type;
+
+    constexpr static const std::size_t d = 1 << 8;
+
+    constexpr static const std::size_t r = boost::static_log2<d>::value;
+    constexpr static const std::size_t m = 2;
+
+    typedef zk::commitments::fri<FieldType, merkle_hash_type, transcript_hash_type, m> fri_type;
+
+    typedef typename fri_type::proof_type proof_type;
+    typedef typename fri_type::params_type params_type;
+
+    std::vector<std::shared_ptr<math::evaluation_domain<FieldType>>> D =
+        math::calculate_domain_set<FieldType>(r + 1, r);
+
+    math::polynomial<typename FieldType::value_type> f(d);
+    for (std::size_t i = 0; i < d; ++i) {
+        f[i] = algebra::random_element<FieldType>();
+    }
+
+    std::vector<std::uint8_t> init_blob {0u, 1u, 2u, 3u, 4u, 5u, 6u, 7u, 8u, 9u};
+    for (std::size_t lambda : {20, 60}) {
+        params_type params(
+            d - 1, // max_degree
+            D,
+            generate_random_step_list(r, 3),
+            2, //expand_factor
+            lambda,
+            true,
+            0xFFFFF
+        );
+
+        typename fri_type::merkle_tree_type tree =
+            zk::algorithms::precommit<fri_type>(f, params.D[0], params.step_list[0]);
+        auto root = zk::algorithms::commit<fri_type>(tree);
+
+        zk::transcript::fiat_shamir_heuristic_sequential<transcript_hash_type> transcript(init_blob);
+        proof_type proof = zk::algorithms::proof_eval<fri_type>(f, tree, params, transcript);
+
+        zk::transcript::fiat_shamir_heuristic_sequential<transcript_hash_type> transcript_verifier(init_blob);
+        BOOST_CHECK(zk::algorithms::verify_eval<fri_type>(proof, root, params, transcript_verifier));
+
+        BOOST_CHECK(transcript_verifier.template challenge<FieldType>() == transcript.template challenge<FieldType>());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(fri_merkle_opening_cache_test) {
+    using curve_type = algebra::curves::pallas;
+    using FieldType = typename curve_type::base_field_type;
+
+    typedef hashes::sha2<256> merkle_hash_type;
+    typedef hashes::sha2<256> transcript_hash_type;
+
+    typedef zk::commitments::fri<FieldType, merkle_hash_type, transcript_hash_type, 2> fri_type;
+    typedef zk::algorithms::detail::fri_field_element_consumer<fri_type> leaf_type;
+
+    std::vector<leaf_type> leaves;
+    for (std::size_t i = 0; i < 8; i++) {
+        leaves.emplace_back(algebra::random_element<FieldType>());
+    }
+    typename fri_type::merkle_tree_type tree =
+        containers::make_merkle_tree<merkle_hash_type, 2>(leaves.begin(), leaves.end());
+    auto proof = [&tree](std::size_t leaf_index) {
+        return typename fri_type::merkle_proof_type(tree, leaf_index);
+    };
+
+    zk::algorithms::detail::fri_merkle_opening_cache<fri_type> cache;
+
+    // The first path is hashed up to the root.
+    BOOST_CHECK(cache.validate(false, 0, 0, proof(0), leaves[0]));
+    BOOST_CHECK_EQUAL(cache.hashed_nodes(), 4);
+    BOOST_CHECK_EQUAL(cache.hits(), 0);
+
+    // Paths stop at their first verified ancestor.
+    BOOST_CHECK(cache.validate(false, 0, 1, proof(1), leaves[1]));
+    BOOST_CHECK_EQUAL(cache.hashed_nodes(), 6);
+    BOOST_CHECK(cache.validate(false, 0, 2, proof(2), leaves[2]));
+    BOOST_CHECK_EQUAL(cache.hashed_nodes(), 9);
+    BOOST_CHECK(cache.validate(false, 0, 0, proof(0), leaves[0]));
+    BOOST_CHECK_EQUAL(cache.hashed_nodes(), 10);
+    BOOST_CHECK_EQUAL(cache.hits(), 3);
+
+    // A wrong leaf reaches a verified node with another value.
+    BOOST_CHECK(!cache.validate(false, 0, 3, proof(3), leaves[2]));
+    BOOST_CHECK(cache.validate(false, 0, 3, proof(3), leaves[3]));
+
+    // Other trees do not share the verified nodes.
+    BOOST_CHECK(cache.validate(true, 0, 0, proof(0), leaves[0]));
+    BOOST_CHECK_EQUAL(cache.hashed_nodes(), 18);
+}
 BOOST_AUTO_TEST_SUITE_END()
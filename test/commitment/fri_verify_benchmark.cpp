@@ -0,0 +1,129 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+// @file Benchmark of FRI verification for growing numbers of queries.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE fri_verify_benchmark
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/pallas.hpp>
+#include <nil/crypto3/algebra/random_element.hpp>
+
+#include <nil/crypto3/hash/sha2.hpp>
+
+#include <nil/crypto3/math/polynomial/polynomial.hpp>
+#include <nil/crypto3/math/algorithms/calculate_domain_set.hpp>
+
+#include <nil/crypto3/zk/transcript/fiat_shamir.hpp>
+#include <nil/crypto3/zk/commitments/polynomial/fri.hpp>
+
+using namespace nil::crypto3;
+
+inline std::vector<std::size_t> generate_random_step_list(const std::size_t r, const std::size_t max_step) {
+    using dist_type = std::uniform_int_distribution<int>;
+    static std::random_device random_engine;
+
+    std::vector<std::size_t> step_list;
+    std::size_t steps_sum = 0;
+    while (steps_sum != r) {
+        if (r - steps_sum <= max_step) {
+            while (r - steps_sum != 1) {
+                step_list.emplace_back(r - steps_sum - 1);
+                steps_sum += step_list.back();
+            }
+            step_list.emplace_back(1);
+            steps_sum += step_list.back();
+        } else {
+            step_list.emplace_back(dist_type(1, max_step)(random_engine));
+            steps_sum += step_list.back();
+        }
+    }
+    return step_list;
+}
+
+BOOST_AUTO_TEST_SUITE(fri_verify_benchmark_suite)
+
+BOOST_AUTO_TEST_CASE(fri_verify_benchmark) {
+    using curve_type = algebra::curves::pallas;
+    using FieldType = typename curve_type::base_field_type;
+
+    typedef hashes::sha2<256> merkle_hash_type;
+    typedef hashes::sha2<256> transcript_hash_type;
+
+    constexpr static const std::size_t d = 1 << 12;
+
+    constexpr static const std::size_t r = boost::static_log2<d>::value;
+    constexpr static const std::size_t m = 2;
+
+    typedef zk::commitments::fri<FieldType, merkle_hash_type, transcript_hash_type, m> fri_type;
+
+    typedef typename fri_type::proof_type proof_type;
+    typedef typename fri_type::params_type params_type;
+
+    std::vector<std::shared_ptr<math::evaluation_domain<FieldType>>> D =
+        math::calculate_domain_set<FieldType>(r + 1, r);
+
+    math::polynomial<typename FieldType::value_type> f(d);
+    for (std::size_t i = 0; i < d; ++i) {
+        f[i] = algebra::random_element<FieldType>();
+    }
+
+    std::vector<std::uint8_t> init_blob {0u, 1u, 2u, 3u, 4u, 5u, 6u, 7u, 8u, 9u};
+    for (std::size_t lambda : {20, 40, 60, 100}) {
+        params_type params(
+            d - 1, // max_degree
+            D,
+            generate_random_step_list(r, 3),
+            2, //expand_factor
+            lambda,
+            true,
+            0xFFFFF
+        );
+
+        typename fri_type::merkle_tree_type tree =
+            zk::algorithms::precommit<fri_type>(f, params.D[0], params.step_list[0]);
+        auto root = zk::algorithms::commit<fri_type>(tree);
+
+        zk::transcript::fiat_shamir_heuristic_sequential<transcript_hash_type> transcript(init_blob);
+        proof_type proof = zk::algorithms::proof_eval<fri_type>(f, tree, params, transcript);
+
+        zk::transcript::fiat_shamir_heuristic_sequential<transcript_hash_type> transcript_verifier(init_blob);
+        auto begin = std::chrono::high_resolution_clock::now();
+        BOOST_CHECK(zk::algorithms::verify_eval<fri_type>(proof, root, params, transcript_verifier));
+        auto end = std::chrono::high_resolution_clock::now();
+        std::cout << "FRI verify, lambda " << lambda << ", time: "
+                  << std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count() << " us" << std::endl;
+
+        BOOST_CHECK(transcript_verifier.template challenge<FieldType>() == transcript.template challenge<FieldType>());
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
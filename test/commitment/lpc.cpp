@@ -28,6 +28,7 @@
 
 #define BOOST_TEST_MODULE lpc_test
 
+#include <future>
 #include <string>
 #include <random>
 #include <regex>
@@ -54,6 +55,14 @@
 #include <nil/crypto3/random/algebraic_engine.hpp>
 #include <nil/crypto3/algebra/random_element.hpp>
 
+#include <nil/crypto3/zk/test_tools/resident_memory.hpp>
+
+#include <nil/marshalling/status_type.hpp>
+#include <nil/marshalling/field_type.hpp>
+#include <nil/marshalling/endianness.hpp>
+#include <nil/crypto3/marshalling/zk/types/commitments/lpc.hpp>
+#include <nil/crypto3/zk/commitments/polynomial/compressed_proof_marshalling.hpp>
+
 using namespace nil::crypto3;
 
 using dist_type = std::uniform_int_distribution<int>;
@@ -641,4 +650,302 @@ BOOST_FIXTURE_TEST_CASE(lpc_different_hash_types_test, test_fixture) {
     typename FieldType::value_type prover_next_challenge = transcript.template challenge<FieldType>();
     BOOST_CHECK(verifier_next_challenge == prover_next_challenge);
 }
+BOOST_FIXTURE_TEST_CASE(lpc_incremental_commit_test, test_fixture) {
+    // Setup types
+    typedef algebra::curves::bls12<381> curve_type;
+    typedef typename curve_type::scalar_field_type FieldType;
+
+    typedef hashes::sha2<256> merkle_hash_type;
+    typedef hashes::sha2<256> transcript_hash_type;
+
+    constexpr static const std::size_t lambda = 10;
+    constexpr static const std::size_t k = 1;
+
+    constexpr static const std::size_t d = 16;
+
+    constexpr static const std::size_t r = boost::static_log2<(d - k)>::value;
+    constexpr static const std::size_t m = 2;
+
+    typedef zk::commitments::fri<FieldType, merkle_hash_type, transcript_hash_type, m> fri_type;
+
+    typedef zk::commitments::
+        list_polynomial_commitment_params<merkle_hash_type, transcript_hash_type, m>
+            lpc_params_type;
+    typedef zk::commitments::list_polynomial_commitment<FieldType, lpc_params_type> lpc_type;
+
+    // Setup params
+    std::size_t extended_log = boost::static_log2<d>::value;
+    std::vector<std::shared_ptr<math::evaluation_domain<FieldType>>> D =
+        math::calculate_domain_set<FieldType>(extended_log, r + 1);
+
+    typename fri_type::params_type fri_params(
+        d - 1, // max_degree
+        D,
+        generate_random_step_list(r, 1, test_global_rnd_engine),
+        2, //expand_factor
+        lambda,
+        true
+    );
+
+    using lpc_scheme_type = nil::crypto3::zk::commitments::lpc_commitment_scheme<lpc_type>;
+    lpc_scheme_type lpc_scheme(fri_params);
+    lpc_scheme.enable_incremental_commit(0);
+
+    auto polys = generate_random_polynomial_dfs_batch<FieldType>(4, d, test_global_alg_rnd_engine<FieldType>);
+
+    auto commit_fresh = [&fri_params](const auto &batch) {
+        lpc_scheme_type scheme(fri_params);
+        scheme.append_to_batch(0, batch);
+        return scheme.commit(0);
+    };
+    // Every proof works on its own copy of the scheme, the cache is shared between them.
+    auto commit_incremental = [&lpc_scheme](const auto &batch) {
+        lpc_scheme_type scheme = lpc_scheme;
+        scheme.append_to_batch(0, batch);
+        return scheme.commit(0);
+    };
+
+    BOOST_CHECK(commit_incremental(polys) == commit_fresh(polys));
+    BOOST_CHECK_EQUAL(lpc_scheme.incremental_statistics().extended_polys, 4u);
+
+    // Change the last polynomial only
+    polys[3] = generate_random_polynomial_dfs_batch<FieldType>(1, d, test_global_alg_rnd_engine<FieldType>)[0];
+    lpc_scheme.mark_unchanged(0, 0, 3);
+    BOOST_CHECK(commit_incremental(polys) == commit_fresh(polys));
+    BOOST_CHECK_EQUAL(lpc_scheme.incremental_statistics().reused_polys, 3u);
+    BOOST_CHECK_EQUAL(lpc_scheme.incremental_statistics().extended_polys, 5u);
+
+    // Nothing changed, the whole tree is reused
+    lpc_scheme.mark_unchanged(0, 0, 4);
+    BOOST_CHECK(commit_incremental(polys) == commit_fresh(polys));
+    BOOST_CHECK_EQUAL(lpc_scheme.incremental_statistics().reused_trees, 1u);
+
+    // Marks apply to one commitment only
+    polys[0] = generate_random_polynomial_dfs_batch<FieldType>(1, d, test_global_alg_rnd_engine<FieldType>)[0];
+    BOOST_CHECK(commit_incremental(polys) == commit_fresh(polys));
+    BOOST_CHECK_EQUAL(lpc_scheme.incremental_statistics().extended_polys, 9u);
+
+    // Copies sharing the cache commit concurrently
+    auto expected = commit_fresh(polys);
+    std::vector<std::future<typename lpc_type::commitment_type>> commitments;
+    lpc_scheme.mark_unchanged(0, 0, 4);
+    for (std::size_t i = 0; i < 4; i++) {
+        commitments.push_back(std::async(std::launch::async, [&]() { return commit_incremental(polys); }));
+    }
+    for (auto &commitment : commitments) {
+        BOOST_CHECK(commitment.get() == expected);
+    }
+}
+
+BOOST_FIXTURE_TEST_CASE(lpc_compressed_proof_test, test_fixture) {
+    typedef algebra::curves::bls12<381> curve_type;
+    typedef typename curve_type::scalar_field_type FieldType;
+    typedef hashes::sha2<256> merkle_hash_type;
+    typedef hashes::sha2<256> transcript_hash_type;
+
+    constexpr static const std::size_t lambda = 40;
+    constexpr static const std::size_t k = 1;
+
+    constexpr static const std::size_t d = 1 << 10;
+    constexpr static const std::size_t r = boost::static_log2<(d - k)>::value;
+
+    constexpr static const std::size_t m = 2;
+
+    typedef zk::commitments::fri<FieldType, merkle_hash_type, transcript_hash_type, m> fri_type;
+
+    typedef zk::commitments::
+        list_polynomial_commitment_params<merkle_hash_type, transcript_hash_type, m>
+            lpc_params_type;
+    typedef zk::commitments::list_polynomial_commitment<FieldType, lpc_params_type> lpc_type;
+
+    constexpr static const std::size_t d_extended = d;
+    std::size_t extended_log = boost::static_log2<d_extended>::value;
+    std::vector<std::shared_ptr<math::evaluation_domain<FieldType>>> D =
+        math::calculate_domain_set<FieldType>(extended_log, r + 1);
+
+    typename fri_type::params_type fri_params(
+        d - 1, // max_degree
+        D,
+        generate_random_step_list(r, 1, test_global_rnd_engine),
+        2, //expand_factor
+        lambda,
+        true,
+        0xFFF
+    );
+
+    using lpc_scheme_type = nil::crypto3::zk::commitments::lpc_commitment_scheme<lpc_type, math::polynomial_dfs<typename FieldType::value_type>>;
+    lpc_scheme_type lpc_scheme_prover(fri_params);
+    lpc_scheme_type lpc_scheme_verifier(fri_params);
+
+    lpc_scheme_prover.append_to_batch(0, generate_random_polynomial_dfs_batch<FieldType>(4, d, test_global_alg_rnd_engine<FieldType>));
+    lpc_scheme_prover.append_to_batch(1, generate_random_polynomial_dfs_batch<FieldType>(2, d, test_global_alg_rnd_engine<FieldType>));
+
+    std::map<std::size_t, typename lpc_type::commitment_type> commitments;
+    commitments[0] = lpc_scheme_prover.commit(0);
+    commitments[1] = lpc_scheme_prover.commit(1);
+
+    auto point = algebra::fields::arithmetic_params<FieldType>::multiplicative_generator;
+    lpc_scheme_prover.append_eval_point(0, point);
+    lpc_scheme_prover.append_eval_point(1, point);
+
+    std::array<std::uint8_t, 96> x_data {};
+
+    zk::transcript::fiat_shamir_heuristic_sequential<transcript_hash_type> transcript(x_data);
+    auto proof = lpc_scheme_prover.proof_eval(transcript);
+
+    typename FieldType::value_type prover_next_challenge = transcript.template challenge<FieldType>();
+
+    auto compressed_proof = lpc_scheme_type::compress_proof(proof);
+    BOOST_CHECK(lpc_scheme_type::decompress_proof(compressed_proof) == proof);
+
+    // A round tree has at most 2^depth distinct openings, and level l of their paths at most 2^(depth - l)
+    // distinct siblings
+    std::size_t t = 0;
+    for (std::size_t i = 0; i < fri_params.step_list.size(); i++) {
+        std::size_t depth = boost::static_log2<d>::value - t - fri_params.step_list[i];
+        const auto &openings = compressed_proof.fri_proof.round_openings[i];
+        BOOST_CHECK(openings.leaf_indices.size() <= std::min(lambda, std::size_t(1) << depth));
+        BOOST_CHECK_EQUAL(openings.depth, depth);
+
+        std::size_t max_nodes = 0;
+        for (std::size_t level = 0; level < depth; level++) {
+            max_nodes += std::min(openings.leaf_indices.size(), std::size_t(1) << (depth - level));
+        }
+        BOOST_CHECK(openings.nodes.size() <= max_nodes);
+        if (openings.leaf_indices.size() > 2) {
+            BOOST_CHECK(openings.nodes.size() < openings.leaf_indices.size() * depth);
+        }
+        t += fri_params.step_list[i];
+    }
+
+    // Serialization round trip, the compressed proof is smaller than the serialized proof
+    using endianness = nil::marshalling::option::big_endian;
+    using filled_compressed_type = typename nil::crypto3::marshalling::types::compressed_lpc_proof<
+        nil::marshalling::field_type<endianness>, lpc_scheme_type>::type;
+
+    auto filled_compressed =
+        nil::crypto3::marshalling::types::fill_compressed_lpc_proof<endianness, lpc_scheme_type>(compressed_proof);
+    std::vector<std::uint8_t> compressed_bytes(filled_compressed.length(), 0x00);
+    auto write_iter = compressed_bytes.begin();
+    BOOST_CHECK(filled_compressed.write(write_iter, compressed_bytes.size()) == nil::marshalling::status_type::success);
+
+    filled_compressed_type read_compressed;
+    auto read_iter = compressed_bytes.cbegin();
+    BOOST_CHECK(read_compressed.read(read_iter, compressed_bytes.size()) == nil::marshalling::status_type::success);
+    auto unpacked_proof =
+        nil::crypto3::marshalling::types::make_compressed_lpc_proof<endianness, lpc_scheme_type>(read_compressed);
+    BOOST_CHECK(unpacked_proof == compressed_proof);
+    BOOST_CHECK(unpacked_proof.fri_proof.proof_of_work == compressed_proof.fri_proof.proof_of_work);
+
+    auto filled_proof =
+        nil::crypto3::marshalling::types::fill_eval_proof<endianness, lpc_scheme_type>(proof, fri_params);
+    BOOST_CHECK(filled_compressed.length() < filled_proof.length());
+
+    auto verify = [&](const auto &p) {
+        lpc_scheme_type verifier = lpc_scheme_verifier;
+        verifier.set_batch_size(0, proof.z.get_batch_size(0));
+        verifier.set_batch_size(1, proof.z.get_batch_size(1));
+        verifier.append_eval_point(0, point);
+        verifier.append_eval_point(1, point);
+
+        zk::transcript::fiat_shamir_heuristic_sequential<transcript_hash_type> transcript_verifier(x_data);
+        bool result = verifier.verify_eval(p, commitments, transcript_verifier);
+        BOOST_CHECK(transcript_verifier.template challenge<FieldType>() == prover_next_challenge);
+        return result;
+    };
+
+    BOOST_CHECK(verify(proof));
+    BOOST_CHECK(verify(compressed_proof));
+    BOOST_CHECK(verify(unpacked_proof));
+}
+
+BOOST_FIXTURE_TEST_CASE(lpc_out_of_core_test, test_fixture) {
+    typedef algebra::curves::bls12<381> curve_type;
+    typedef typename curve_type::scalar_field_type FieldType;
+    typedef hashes::sha2<256> merkle_hash_type;
+    typedef hashes::sha2<256> transcript_hash_type;
+
+    constexpr static const std::size_t lambda = 40;
+    constexpr static const std::size_t k = 1;
+
+    constexpr static const std::size_t d = 1 << 14;
+    constexpr static const std::size_t r = boost::static_log2<(d - k)>::value;
+
+    constexpr static const std::size_t m = 2;
+
+    typedef zk::commitments::fri<FieldType, merkle_hash_type, transcript_hash_type, m> fri_type;
+
+    typedef zk::commitments::
+        list_polynomial_commitment_params<merkle_hash_type, transcript_hash_type, m>
+            lpc_params_type;
+    typedef zk::commitments::list_polynomial_commitment<FieldType, lpc_params_type> lpc_type;
+
+    constexpr static const std::size_t d_extended = d;
+    std::size_t extended_log = boost::static_log2<d_extended>::value;
+    std::vector<std::shared_ptr<math::evaluation_domain<FieldType>>> D =
+        math::calculate_domain_set<FieldType>(extended_log, r + 1);
+
+    typename fri_type::params_type fri_params(
+        d - 1, // max_degree
+        D,
+        generate_random_step_list(r, 1, test_global_rnd_engine),
+        2, //expand_factor
+        lambda,
+        true,
+        0xFFF
+    );
+
+    using lpc_scheme_type = nil::crypto3::zk::commitments::lpc_commitment_scheme<lpc_type, math::polynomial_dfs<typename FieldType::value_type>>;
+    lpc_scheme_type lpc_scheme_in_memory(fri_params);
+    lpc_scheme_type lpc_scheme_prover(fri_params);
+    lpc_scheme_type lpc_scheme_verifier(fri_params);
+
+    // Room for about two extended polynomials out of the 16 of the batch.
+    std::size_t budget = 4 * fri_params.D[0]->size() * sizeof(typename FieldType::value_type);
+    lpc_scheme_prover.enable_out_of_core_commit(zk::detail::out_of_core_commit_params(budget));
+    zk::detail::out_of_core_statistics &statistics = zk::detail::out_of_core_statistics::instance();
+    statistics.reset();
+
+    auto batch = generate_random_polynomial_dfs_batch<FieldType>(16, d, test_global_alg_rnd_engine<FieldType>);
+    lpc_scheme_in_memory.append_to_batch(0, batch);
+    lpc_scheme_prover.append_to_batch(0, batch);
+
+    // Growth of the resident memory of the process during each commit.
+    std::map<std::size_t, typename lpc_type::commitment_type> commitments;
+    std::size_t out_of_core_growth;
+    {
+        zk::test_tools::resident_memory_sampler sampler;
+        commitments[0] = lpc_scheme_prover.commit(0);
+        out_of_core_growth = sampler.peak();
+    }
+    typename lpc_type::commitment_type in_memory_commitment;
+    std::size_t in_memory_growth;
+    {
+        zk::test_tools::resident_memory_sampler sampler;
+        in_memory_commitment = lpc_scheme_in_memory.commit(0);
+        in_memory_growth = sampler.peak();
+    }
+
+    BOOST_CHECK(commitments[0] == in_memory_commitment);
+    BOOST_CHECK(statistics.files == 2);
+    BOOST_CHECK(statistics.mapped_bytes == 0);
+    if (zk::test_tools::resident_memory_available()) {
+        // The batch is 16 columns, the extended evaluations and leaves of the in-memory commit are both that large.
+        std::size_t extended_bytes = 16 * fri_params.D[0]->size() * sizeof(typename FieldType::value_type);
+        BOOST_CHECK_GE(in_memory_growth, extended_bytes);
+        BOOST_CHECK_LE(out_of_core_growth, extended_bytes / 2);
+    }
+
+    auto point = algebra::fields::arithmetic_params<FieldType>::multiplicative_generator;
+    lpc_scheme_prover.append_eval_point(0, point);
+
+    std::array<std::uint8_t, 96> x_data {};
+    zk::transcript::fiat_shamir_heuristic_sequential<transcript_hash_type> transcript(x_data);
+    auto proof = lpc_scheme_prover.proof_eval(transcript);
+
+    lpc_scheme_verifier.set_batch_size(0, proof.z.get_batch_size(0));
+    lpc_scheme_verifier.append_eval_point(0, point);
+    zk::transcript::fiat_shamir_heuristic_sequential<transcript_hash_type> transcript_verifier(x_data);
+    BOOST_CHECK(lpc_scheme_verifier.verify_eval(proof, commitments, transcript_verifier));
+}
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,142 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+// Benchmark of compressed LPC proofs: serialized size and verification time of the proof and of its
+// compressed form.
+
+#define BOOST_TEST_MODULE lpc_compressed_benchmark
+
+#include <chrono>
+#include <algorithm>
+#include <iostream>
+#include <map>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/bls12.hpp>
+
+#include <nil/crypto3/hash/sha2.hpp>
+
+#include <nil/crypto3/math/polynomial/polynomial_dfs.hpp>
+#include <nil/crypto3/math/algorithms/calculate_domain_set.hpp>
+
+#include <nil/crypto3/random/algebraic_engine.hpp>
+
+#include <nil/crypto3/zk/commitments/polynomial/lpc.hpp>
+#include <nil/crypto3/zk/commitments/polynomial/fri.hpp>
+
+#include <nil/marshalling/field_type.hpp>
+#include <nil/marshalling/endianness.hpp>
+#include <nil/crypto3/marshalling/zk/types/commitments/lpc.hpp>
+#include <nil/crypto3/zk/commitments/polynomial/compressed_proof_marshalling.hpp>
+
+using namespace nil::crypto3;
+
+namespace {
+    template<typename FieldType>
+    std::vector<math::polynomial_dfs<typename FieldType::value_type>>
+        random_polynomials(std::size_t amount, std::size_t size, random::algebraic_engine<FieldType> &rnd) {
+        std::vector<math::polynomial_dfs<typename FieldType::value_type>> result(amount);
+        for (auto &poly : result) {
+            math::polynomial<typename FieldType::value_type> coefficients(size);
+            std::generate(coefficients.begin(), coefficients.end(), [&rnd]() { return rnd(); });
+            poly.from_coefficients(coefficients);
+        }
+        return result;
+    }
+
+    void lpc_compressed_benchmark(std::size_t log_degree, std::size_t lambda) {
+        using field_type = algebra::curves::bls12<381>::scalar_field_type;
+        using merkle_hash_type = hashes::sha2<256>;
+        using transcript_hash_type = hashes::sha2<256>;
+        using fri_type = zk::commitments::fri<field_type, merkle_hash_type, transcript_hash_type, 2>;
+        using lpc_params_type = zk::commitments::list_polynomial_commitment_params<merkle_hash_type,
+                                                                                   transcript_hash_type, 2>;
+        using lpc_type = zk::commitments::list_polynomial_commitment<field_type, lpc_params_type>;
+        using lpc_scheme_type = zk::commitments::lpc_commitment_scheme<
+            lpc_type, math::polynomial_dfs<typename field_type::value_type>>;
+        using endianness = nil::marshalling::option::big_endian;
+
+        std::size_t d = std::size_t(1) << log_degree;
+        std::size_t r = log_degree - 1;
+        random::algebraic_engine<field_type> rnd(0);
+
+        typename fri_type::params_type fri_params(d - 1, math::calculate_domain_set<field_type>(log_degree, r),
+                                                  std::vector<std::size_t>(r, 1), 2, lambda, true, 0xFFF);
+
+        lpc_scheme_type prover(fri_params);
+        prover.append_to_batch(0, random_polynomials<field_type>(8, d, rnd));
+        prover.append_to_batch(1, random_polynomials<field_type>(4, d, rnd));
+
+        std::map<std::size_t, typename lpc_type::commitment_type> commitments;
+        commitments[0] = prover.commit(0);
+        commitments[1] = prover.commit(1);
+
+        auto point = algebra::fields::arithmetic_params<field_type>::multiplicative_generator;
+        prover.append_eval_point(0, point);
+        prover.append_eval_point(1, point);
+
+        std::vector<std::uint8_t> init_blob {0u};
+        zk::transcript::fiat_shamir_heuristic_sequential<transcript_hash_type> transcript(init_blob);
+        auto proof = prover.proof_eval(transcript);
+        auto compressed_proof = lpc_scheme_type::compress_proof(proof);
+
+        std::size_t proof_bytes =
+            marshalling::types::fill_eval_proof<endianness, lpc_scheme_type>(proof, fri_params).length();
+        std::size_t compressed_bytes =
+            marshalling::types::fill_compressed_lpc_proof<endianness, lpc_scheme_type>(compressed_proof).length();
+
+        auto verify = [&](const auto &p) {
+            lpc_scheme_type verifier(fri_params);
+            verifier.set_batch_size(0, proof.z.get_batch_size(0));
+            verifier.set_batch_size(1, proof.z.get_batch_size(1));
+            verifier.append_eval_point(0, point);
+            verifier.append_eval_point(1, point);
+
+            zk::transcript::fiat_shamir_heuristic_sequential<transcript_hash_type> transcript_verifier(init_blob);
+            auto begin = std::chrono::high_resolution_clock::now();
+            BOOST_CHECK(verifier.verify_eval(p, commitments, transcript_verifier));
+            auto end = std::chrono::high_resolution_clock::now();
+            return std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count();
+        };
+
+        std::cout << "LPC 2^" << log_degree << ", lambda " << lambda << ", serialized bytes: " << proof_bytes
+                  << ", compressed: " << compressed_bytes << std::endl;
+        std::cout << "LPC 2^" << log_degree << ", lambda " << lambda << ", verify: " << verify(proof)
+                  << " us, compressed: " << verify(compressed_proof) << " us" << std::endl;
+    }
+}    // namespace
+
+BOOST_AUTO_TEST_SUITE(lpc_compressed_benchmark_suite)
+
+BOOST_AUTO_TEST_CASE(lpc_compressed_benchmark_test) {
+    for (std::size_t log_degree : {10, 14}) {
+        for (std::size_t lambda : {20, 40, 80}) {
+            lpc_compressed_benchmark(log_degree, lambda);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
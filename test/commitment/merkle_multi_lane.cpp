@@ -0,0 +1,140 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE merkle_multi_lane_test
+
+#include <random>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/pallas.hpp>
+
+#include <nil/crypto3/hash/algorithm/hash.hpp>
+#include <nil/crypto3/hash/keccak.hpp>
+#include <nil/crypto3/hash/poseidon.hpp>
+
+#include <nil/crypto3/container/merkle/tree.hpp>
+
+#include <nil/crypto3/zk/detail/keccak_multi_lane.hpp>
+#include <nil/crypto3/zk/detail/merkle_multi_lane.hpp>
+
+using namespace nil::crypto3;
+using namespace nil::crypto3::zk;
+
+namespace {
+    std::vector<zk::detail::keccak_lanes> supported_lanes() {
+        std::vector<zk::detail::keccak_lanes> lanes = {zk::detail::keccak_lanes::scalar};
+        if (zk::detail::detect_keccak_lanes() != zk::detail::keccak_lanes::scalar) {
+            lanes.push_back(zk::detail::keccak_lanes::avx2);
+        }
+        if (zk::detail::detect_keccak_lanes() == zk::detail::keccak_lanes::avx512) {
+            lanes.push_back(zk::detail::keccak_lanes::avx512);
+        }
+        return lanes;
+    }
+}    // namespace
+
+BOOST_AUTO_TEST_SUITE(merkle_multi_lane_test_suite)
+
+BOOST_AUTO_TEST_CASE(keccak_multi_lane_test) {
+    using hash_type = hashes::keccak_1600<256>;
+    std::mt19937 generator(0x1234);
+
+    // Shorter than, equal to and longer than the rate, and odd counts to leave scalar tails.
+    for (std::size_t length : {0, 31, 64, 135, 136, 137, 300}) {
+        std::size_t count = 19;
+        std::vector<std::vector<std::uint8_t>> messages(count, std::vector<std::uint8_t>(length));
+        std::vector<const std::uint8_t *> message_pointers;
+        for (auto &message : messages) {
+            for (auto &byte : message) {
+                byte = std::uint8_t(generator());
+            }
+            message_pointers.push_back(message.data());
+        }
+
+        for (auto lanes : supported_lanes()) {
+            std::vector<std::array<std::uint8_t, 32>> digests(count);
+            std::vector<std::uint8_t *> digest_pointers;
+            for (auto &digest : digests) {
+                digest_pointers.push_back(digest.data());
+            }
+            zk::detail::keccak_256_batch(message_pointers.data(), length, digest_pointers.data(), count, lanes);
+
+            for (std::size_t i = 0; i < count; i++) {
+                typename hash_type::digest_type expected = hash<hash_type>(messages[i]);
+                BOOST_CHECK(std::equal(digests[i].begin(), digests[i].end(), expected.begin()));
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(merkle_multi_lane_root_test) {
+    using hash_type = hashes::keccak_1600<256>;
+    std::mt19937 generator(0x5678);
+
+    for (std::size_t leafs_number : {2, 8, 64, 1024}) {
+        std::vector<std::vector<std::uint8_t>> leaves(leafs_number, std::vector<std::uint8_t>(96));
+        for (auto &leaf : leaves) {
+            for (auto &byte : leaf) {
+                byte = std::uint8_t(generator());
+            }
+        }
+
+        auto expected = containers::make_merkle_tree<hash_type, 2>(leaves.begin(), leaves.end());
+        for (auto lanes : supported_lanes()) {
+            auto tree = zk::detail::make_merkle_tree_multi_lane<hash_type, 2>(leaves.begin(), leaves.end(), lanes);
+            BOOST_CHECK(tree.root() == expected.root());
+
+            // Proofs of the multi-lane tree verify as usual.
+            containers::merkle_proof<hash_type, 2> proof(tree, leafs_number / 2);
+            BOOST_CHECK(proof.validate(leaves[leafs_number / 2]));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(merkle_poseidon_batched_root_test) {
+    using field_type = algebra::curves::pallas::base_field_type;
+    using hash_type = hashes::poseidon<hashes::detail::mina_poseidon_policy<field_type>>;
+    using value_type = typename field_type::value_type;
+
+    for (std::size_t leafs_number : {2, 8, 64}) {
+        std::vector<std::vector<value_type>> leaves(leafs_number, std::vector<value_type>(4));
+        for (std::size_t i = 0; i < leafs_number; i++) {
+            for (std::size_t j = 0; j < leaves[i].size(); j++) {
+                leaves[i][j] = value_type(i * leaves[i].size() + j + 1);
+            }
+        }
+
+        auto expected = containers::make_merkle_tree<hash_type, 2>(leaves.begin(), leaves.end());
+        auto tree = zk::detail::make_merkle_tree_multi_lane<hash_type, 2>(leaves.begin(), leaves.end());
+        BOOST_CHECK(tree.root() == expected.root());
+
+        containers::merkle_proof<hash_type, 2> proof(tree, leafs_number / 2);
+        BOOST_CHECK(proof.validate(leaves[leafs_number / 2]));
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
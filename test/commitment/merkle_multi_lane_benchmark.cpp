@@ -0,0 +1,113 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+// Benchmark of FRI precommits with batched Merkle tree hashing against the generic tree
+// built over the same leaves.
+
+#define BOOST_TEST_MODULE merkle_multi_lane_benchmark
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/pallas.hpp>
+
+#include <nil/crypto3/hash/algorithm/hash.hpp>
+#include <nil/crypto3/hash/keccak.hpp>
+#include <nil/crypto3/hash/poseidon.hpp>
+
+#include <nil/crypto3/container/merkle/tree.hpp>
+
+#include <nil/crypto3/math/polynomial/polynomial_dfs.hpp>
+#include <nil/crypto3/math/algorithms/make_evaluation_domain.hpp>
+
+#include <nil/crypto3/zk/commitments/detail/polynomial/basic_fri.hpp>
+#include <nil/crypto3/zk/commitments/polynomial/fri.hpp>
+#include <nil/crypto3/zk/detail/keccak_multi_lane.hpp>
+#include <nil/crypto3/zk/detail/merkle_multi_lane.hpp>
+
+using namespace nil::crypto3;
+using namespace nil::crypto3::zk;
+
+namespace {
+    template<typename Hash>
+    void precommit_benchmark(const std::string &name, std::size_t log_domain_size, std::size_t polynomials) {
+        using field_type = algebra::curves::pallas::base_field_type;
+        using fri_type = commitments::fri<field_type, Hash, Hash, 2>;
+        using value_type = typename field_type::value_type;
+
+        std::shared_ptr<math::evaluation_domain<field_type>> D =
+            math::make_evaluation_domain<field_type>(1 << log_domain_size);
+
+        std::vector<math::polynomial_dfs<value_type>> poly(polynomials);
+        for (std::size_t i = 0; i < polynomials; i++) {
+            poly[i].resize(D->size());
+            for (std::size_t j = 0; j < D->size(); j++) {
+                poly[i][j] = value_type(i * D->size() + j + 1);
+            }
+        }
+
+        auto begin = std::chrono::high_resolution_clock::now();
+        auto tree = algorithms::precommit_extended<fri_type>(poly, D, 1);
+        auto end = std::chrono::high_resolution_clock::now();
+        std::cout << name << " batched precommit, time: "
+                  << std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count() << " ms" << std::endl;
+
+        /* The same leaves through the generic tree construction. */
+        std::size_t leafs_number = D->size() / 2;
+        std::vector<zk::algorithms::detail::fri_field_element_consumer<fri_type>> y_data(
+            leafs_number, zk::algorithms::detail::fri_field_element_consumer<fri_type>(2 * polynomials));
+        for (std::size_t x_index = 0; x_index < leafs_number; x_index++) {
+            auto &element_consumer = y_data[x_index].reset_cursor();
+            for (std::size_t i = 0; i < polynomials; i++) {
+                element_consumer.consume(poly[i][x_index]);
+                element_consumer.consume(poly[i][x_index + leafs_number]);
+            }
+        }
+        begin = std::chrono::high_resolution_clock::now();
+        auto expected = containers::make_merkle_tree<Hash, 2>(y_data.begin(), y_data.end());
+        end = std::chrono::high_resolution_clock::now();
+        std::cout << name << " generic Merkle tree of the same leaves, time: "
+                  << std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count() << " ms" << std::endl;
+
+        BOOST_CHECK(tree.root() == expected.root());
+    }
+}    // namespace
+
+BOOST_AUTO_TEST_SUITE(merkle_multi_lane_benchmark_suite)
+
+BOOST_AUTO_TEST_CASE(merkle_multi_lane_keccak_precommit_benchmark) {
+    std::cout << "Keccak lanes: " << int(zk::detail::detect_keccak_lanes()) << std::endl;
+    precommit_benchmark<hashes::keccak_1600<256>>("Keccak", 18, 8);
+}
+
+BOOST_AUTO_TEST_CASE(merkle_multi_lane_poseidon_precommit_benchmark) {
+    using field_type = algebra::curves::pallas::base_field_type;
+    precommit_benchmark<hashes::poseidon<hashes::detail::mina_poseidon_policy<field_type>>>("Poseidon", 16, 8);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
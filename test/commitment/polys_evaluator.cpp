@@ -0,0 +1,143 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+// @file Test of batched polynomial evaluation in polys_evaluator.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE polys_evaluator_test
+
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/bls12.hpp>
+
+#include <nil/crypto3/math/algorithms/unity_root.hpp>
+#include <nil/crypto3/math/polynomial/polynomial.hpp>
+#include <nil/crypto3/math/polynomial/polynomial_dfs.hpp>
+
+#include <nil/crypto3/hash/sha2.hpp>
+#include <nil/crypto3/zk/transcript/fiat_shamir.hpp>
+#include <nil/crypto3/zk/commitments/batched_commitment.hpp>
+
+#include <nil/crypto3/random/algebraic_engine.hpp>
+
+using namespace nil::crypto3;
+
+template<typename FieldType>
+using test_params_type = zk::commitments::commitment_scheme_params_type<FieldType, std::vector<std::uint8_t>>;
+
+using test_transcript_type = zk::transcript::fiat_shamir_heuristic_sequential<hashes::sha2<256>>;
+
+// Exposes the evaluation internals of polys_evaluator.
+template<typename FieldType>
+class test_polys_evaluator
+    : public zk::commitments::polys_evaluator<test_params_type<FieldType>, test_transcript_type> {
+    using base_type = zk::commitments::polys_evaluator<test_params_type<FieldType>, test_transcript_type>;
+
+public:
+    using base_type::eval_polys;
+    using base_type::state_commited;
+};
+
+template<typename FieldType>
+std::vector<math::polynomial_dfs<typename FieldType::value_type>>
+    generate_random_polynomial_dfs_batch(std::size_t batch_size, std::size_t size,
+                                         random::algebraic_engine<FieldType> &rnd) {
+    std::vector<math::polynomial_dfs<typename FieldType::value_type>> result(batch_size);
+    for (auto &dfs : result) {
+        math::polynomial<typename FieldType::value_type> coefficients(size);
+        std::generate(std::begin(coefficients), std::end(coefficients), [&rnd]() { return rnd(); });
+        dfs.from_coefficients(coefficients);
+    }
+    return result;
+}
+
+/**
+ * Evaluates batches shaped like the ones of a placeholder proof: witness columns opened at the
+ * challenge and its rotations, fixed columns opened at the challenge, and quotient chunks.
+ */
+template<typename FieldType>
+void test_polys_evaluator_batches(std::size_t rows, std::size_t witness_columns, std::size_t fixed_columns,
+                                  std::size_t quotient_chunks) {
+    using value_type = typename FieldType::value_type;
+
+    random::algebraic_engine<FieldType> rnd;
+    test_polys_evaluator<FieldType> evaluator;
+
+    std::vector<std::vector<math::polynomial_dfs<value_type>>> batches = {
+        generate_random_polynomial_dfs_batch<FieldType>(witness_columns, rows, rnd),
+        generate_random_polynomial_dfs_batch<FieldType>(fixed_columns, rows, rnd),
+        generate_random_polynomial_dfs_batch<FieldType>(quotient_chunks, rows, rnd)};
+    for (std::size_t batch = 0; batch < batches.size(); ++batch) {
+        evaluator.append_to_batch(batch, batches[batch]);
+        evaluator.state_commited(batch);
+    }
+
+    const value_type challenge = rnd();
+    const value_type omega = math::unity_root<FieldType>(rows);
+    evaluator.append_eval_point(0, challenge);
+    evaluator.append_eval_point(0, challenge * omega);
+    evaluator.append_eval_point(0, challenge * omega.inversed());
+    evaluator.append_eval_point(1, challenge);
+    // A point of the domain itself, where the barycentric formula does not apply.
+    evaluator.append_eval_point(1, 0, omega.pow(3));
+    evaluator.append_eval_point(2, challenge);
+
+    evaluator.eval_polys();
+
+    const std::vector<std::vector<std::vector<value_type>>> points = {
+        std::vector<std::vector<value_type>>(witness_columns,
+                                             {challenge, challenge * omega, challenge * omega.inversed()}),
+        std::vector<std::vector<value_type>>(fixed_columns, {challenge}),
+        std::vector<std::vector<value_type>>(quotient_chunks, {challenge})};
+
+    for (std::size_t batch = 0; batch < batches.size(); ++batch) {
+        for (std::size_t i = 0; i < batches[batch].size(); ++i) {
+            std::vector<value_type> poly_points = points[batch][i];
+            if (batch == 1 && i == 0) {
+                poly_points.push_back(omega.pow(3));
+            }
+            BOOST_CHECK_EQUAL(evaluator._z.get_poly_points_number(batch, i), poly_points.size());
+            for (std::size_t j = 0; j < poly_points.size(); ++j) {
+                BOOST_CHECK(evaluator._z.get(batch, i, j) == batches[batch][i].evaluate(poly_points[j]));
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(polys_evaluator_test_suite)
+
+BOOST_AUTO_TEST_CASE(polys_evaluator_small_test_case) {
+    using field_type = typename algebra::curves::bls12<381>::scalar_field_type;
+    test_polys_evaluator_batches<field_type>(1 << 8, 16, 4, 3);
+}
+
+BOOST_AUTO_TEST_CASE(polys_evaluator_medium_test_case) {
+    using field_type = typename algebra::curves::bls12<381>::scalar_field_type;
+    test_polys_evaluator_batches<field_type>(1 << 12, 8, 4, 2);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
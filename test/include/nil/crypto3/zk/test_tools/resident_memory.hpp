@@ -0,0 +1,130 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+// @file Measurement of the resident memory of the test process.
+//
+// Tests bounding the memory of a computation sample the resident anonymous memory of the process,
+// RssAnon of /proc/self/status, while it runs. File-backed pages, e.g. of memory-mapped storage which
+// was written back, are left out, the kernel reclaims them without swapping. Freed heap memory is
+// returned to the system before the baseline is taken, so earlier allocations do not hide growth.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ZK_TEST_TOOLS_RESIDENT_MEMORY_HPP
+#define CRYPTO3_ZK_TEST_TOOLS_RESIDENT_MEMORY_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <thread>
+
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+namespace nil {
+    namespace crypto3 {
+        namespace zk {
+            namespace test_tools {
+
+                // Resident anonymous memory of the process in bytes, 0 where /proc is not available.
+                inline std::size_t resident_anonymous_bytes() {
+                    std::ifstream status("/proc/self/status");
+                    std::string key;
+                    while (status >> key) {
+                        if (key == "RssAnon:") {
+                            std::size_t kilobytes = 0;
+                            status >> kilobytes;
+                            return kilobytes * 1024;
+                        }
+                        status.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+                    }
+                    return 0;
+                }
+
+                inline bool resident_memory_available() {
+                    return resident_anonymous_bytes() != 0;
+                }
+
+                /**
+                 * Samples resident_anonymous_bytes() on a background thread from construction until peak()
+                 * is called, which returns the highest growth over the value at construction.
+                 */
+                class resident_memory_sampler {
+                public:
+                    explicit resident_memory_sampler(
+                            std::chrono::microseconds period = std::chrono::microseconds(500)) :
+                        _baseline(trimmed_baseline()), _peak(_baseline), _running(true),
+                        _thread([this, period]() {
+                            while (_running.load()) {
+                                sample();
+                                std::this_thread::sleep_for(period);
+                            }
+                        }) {
+                    }
+
+                    ~resident_memory_sampler() {
+                        stop();
+                    }
+
+                    std::size_t peak() {
+                        stop();
+                        sample();
+                        return _peak.load() - _baseline;
+                    }
+
+                private:
+                    static std::size_t trimmed_baseline() {
+#ifdef __GLIBC__
+                        malloc_trim(0);
+#endif
+                        return resident_anonymous_bytes();
+                    }
+
+                    void sample() {
+                        std::size_t current = resident_anonymous_bytes();
+                        std::size_t peak = _peak.load();
+                        while (current > peak && !_peak.compare_exchange_weak(peak, current)) {
+                        }
+                    }
+
+                    void stop() {
+                        if (_running.exchange(false)) {
+                            _thread.join();
+                        }
+                    }
+
+                    std::size_t _baseline;
+                    std::atomic<std::size_t> _peak;
+                    std::atomic<bool> _running;
+                    std::thread _thread;
+                };
+            }    // namespace test_tools
+        }        // namespace zk
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ZK_TEST_TOOLS_RESIDENT_MEMORY_HPP
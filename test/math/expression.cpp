@@ -39,7 +39,9 @@
 #include <nil/crypto3/zk/math/expression.hpp>
 #include <nil/crypto3/zk/math/expression_visitors.hpp>
 #include <nil/crypto3/zk/math/expression_evaluator.hpp>
+#include <nil/crypto3/zk/math/expression_arena.hpp>
 #include <nil/crypto3/zk/snark/arithmetization/plonk/variable.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/plonk/detail/constraint_system_digest.hpp>
 
 using namespace nil::crypto3;
 using namespace nil::crypto3::math;
@@ -152,4 +154,108 @@ BOOST_AUTO_TEST_CASE(expression_for_each_variable_visitor_test) {
         expected_rotations.begin(), expected_rotations.end());
 }
 
+BOOST_AUTO_TEST_CASE(expression_arena_test) {
+
+    // setup
+    using curve_type = algebra::curves::pallas;
+    using FieldType = typename curve_type::base_field_type;
+    using variable_type = typename nil::crypto3::zk::snark::plonk_variable<typename FieldType::value_type>;
+
+    variable_type w0(0, 0, variable_type::column_type::witness);
+    variable_type w1(3, -1, variable_type::column_type::public_input);
+    variable_type w2(4, 1, variable_type::column_type::public_input);
+    variable_type w3(6, 2, variable_type::column_type::constant);
+
+    expression<variable_type> expr1 = (w0 + w1) * (w2 + w3) + w0 * w1 * (w2 + w3);
+    expression<variable_type> expr2 = (w0 + w1) * (w2 + w3) + w0 * w1 * (w2 + w3);
+    expression<variable_type> expr3 = (w2 + w3).pow(2) - (w0 + w1) * (w2 + w3);
+
+    expression_arena<variable_type> arena;
+    expression<variable_type> interned1 = arena.intern(expr1);
+    std::size_t unique_nodes = arena.size();
+    expression<variable_type> interned2 = arena.intern(expr2);
+
+    BOOST_CHECK(interned1 == expr1);
+    BOOST_CHECK(interned2 == expr2);
+    BOOST_CHECK_EQUAL(arena.size(), unique_nodes);
+
+    // (w2 + w3) occurs twice in expr1 and is stored once.
+    const auto &sum = boost::get<binary_arithmetic_operation<variable_type>>(interned1.get_expr());
+    const auto &left = boost::get<binary_arithmetic_operation<variable_type>>(sum.get_expr_left().get_expr());
+    const auto &right = boost::get<binary_arithmetic_operation<variable_type>>(sum.get_expr_right().get_expr());
+    BOOST_CHECK(left.get_expr_right_ptr() == right.get_expr_right_ptr());
+
+    // Only the new root and pow node of expr3 are added, everything else is shared.
+    expression<variable_type> interned3 = arena.intern(expr3);
+    BOOST_CHECK(interned3 == expr3);
+    BOOST_CHECK_EQUAL(arena.size(), unique_nodes + 2);
+
+    expression_max_degree_visitor<variable_type> visitor;
+    BOOST_CHECK_EQUAL(visitor.compute_max_degree(interned1), 3);
+    BOOST_CHECK_EQUAL(visitor.compute_max_degree(interned3), 2);
+
+    std::function<variable_type::assignment_type(const variable_type&)> get_var_value =
+        [](const variable_type& var) {
+            return variable_type::assignment_type(var.index + 1);
+    };
+    BOOST_CHECK(expression_evaluator<variable_type>(interned3, get_var_value).evaluate() ==
+                expression_evaluator<variable_type>(expr3, get_var_value).evaluate());
+}
+
+BOOST_AUTO_TEST_CASE(expression_arena_sharing_test) {
+
+    // setup
+    using curve_type = algebra::curves::pallas;
+    using FieldType = typename curve_type::base_field_type;
+    using variable_type = typename nil::crypto3::zk::snark::plonk_variable<typename FieldType::value_type>;
+
+    // Many constraints over a few columns share most of their subexpressions.
+    constexpr static const std::size_t constraints_amount = 1 << 8;
+    constexpr static const std::size_t columns_amount = 15;
+
+    std::vector<expression<variable_type>> constraints;
+    for (std::size_t i = 0; i < constraints_amount; ++i) {
+        std::size_t c = i % columns_amount;
+        variable_type x(c, 0, variable_type::column_type::witness);
+        variable_type y((c + 1) % columns_amount, 0, variable_type::column_type::witness);
+        variable_type z((c + 2) % columns_amount, 1, variable_type::column_type::witness);
+        variable_type q(c % 3, 0, variable_type::column_type::constant);
+
+        expression<variable_type> constraint = (x + y) * (x + y) - z;
+        constraint += q * (x + y).pow(2);
+        constraint *= (x - y);
+        constraints.push_back(constraint);
+    }
+
+    expression_arena<variable_type> arena;
+    std::vector<expression<variable_type>> interned;
+    for (const auto &constraint : constraints) {
+        interned.push_back(arena.intern(constraint));
+    }
+    BOOST_CHECK(arena.size() < arena.requests() / 10);
+
+    expression_max_degree_visitor<variable_type> visitor;
+    expression_variable_type_converter<variable_type, variable_type> converter;
+    for (std::size_t i = 0; i < constraints.size(); ++i) {
+        BOOST_CHECK(interned[i] == constraints[i]);
+        BOOST_CHECK(converter.convert(interned[i]) == constraints[i]);
+        BOOST_CHECK_EQUAL(visitor.compute_max_degree(interned[i]), 4);
+    }
+    // Shared subexpressions are converted once.
+    BOOST_CHECK_EQUAL(converter.converted_count(), arena.size());
+
+    // Digests do not depend on sharing, and shared subexpressions are hashed once.
+    zk::snark::detail::plonk_expression_digest<FieldType> tree_digest;
+    zk::snark::detail::plonk_expression_digest<FieldType> interned_digest;
+    for (std::size_t i = 0; i < constraints.size(); ++i) {
+        BOOST_CHECK(tree_digest.digest(constraints[i]) == interned_digest.digest(interned[i]));
+    }
+    BOOST_CHECK(interned_digest.hashed_nodes() <= arena.size() + constraints.size());
+    BOOST_CHECK(interned_digest.hashed_nodes() < tree_digest.hashed_nodes());
+
+    variable_type w(0, 0, variable_type::column_type::witness);
+    BOOST_CHECK(interned_digest.digest(constraints[0]) != interned_digest.digest(constraints[0] + w));
+    BOOST_CHECK(interned_digest.digest(constraints[0]) != interned_digest.digest(constraints[1]));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,122 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+// @file Benchmark of constructing, hash-consing and converting the constraints of a circuit
+// built by repeating a component.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE expression_benchmark
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/pallas.hpp>
+
+#include <nil/crypto3/zk/math/expression.hpp>
+#include <nil/crypto3/zk/math/expression_visitors.hpp>
+#include <nil/crypto3/zk/math/expression_arena.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/plonk/variable.hpp>
+
+using namespace nil::crypto3;
+using namespace nil::crypto3::math;
+
+BOOST_AUTO_TEST_SUITE(expression_benchmark_suite)
+
+BOOST_AUTO_TEST_CASE(expression_construction_benchmark) {
+
+    // setup
+    using curve_type = algebra::curves::pallas;
+    using FieldType = typename curve_type::base_field_type;
+    using variable_type = typename nil::crypto3::zk::snark::plonk_variable<typename FieldType::value_type>;
+
+    // A circuit with many constraints over a few columns and rotations, like the ones
+    // produced by repeating a component.
+    constexpr static const std::size_t constraints_amount = 1 << 14;
+    constexpr static const std::size_t columns_amount = 15;
+
+    auto begin = std::chrono::high_resolution_clock::now();
+    std::vector<expression<variable_type>> constraints;
+    constraints.reserve(constraints_amount);
+    for (std::size_t i = 0; i < constraints_amount; ++i) {
+        std::size_t c = i % columns_amount;
+        variable_type x(c, 0, variable_type::column_type::witness);
+        variable_type y((c + 1) % columns_amount, 0, variable_type::column_type::witness);
+        variable_type z((c + 2) % columns_amount, 1, variable_type::column_type::witness);
+        variable_type q(c % 3, 0, variable_type::column_type::constant);
+
+        expression<variable_type> constraint = (x + y) * (x + y) - z;
+        constraint += q * (x + y).pow(2);
+        constraint *= (x - y);
+        constraints.push_back(constraint);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    std::cout << "Construction of " << constraints_amount << " constraints, time: "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count() << " ms" << std::endl;
+
+    begin = std::chrono::high_resolution_clock::now();
+    expression_max_degree_visitor<variable_type> visitor;
+    std::uint32_t max_degree = 0;
+    for (const auto &constraint : constraints) {
+        max_degree = std::max(max_degree, visitor.compute_max_degree(constraint));
+    }
+    end = std::chrono::high_resolution_clock::now();
+    BOOST_CHECK_EQUAL(max_degree, 4);
+    std::cout << "Max degree, time: "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count() << " ms" << std::endl;
+
+    begin = std::chrono::high_resolution_clock::now();
+    expression_arena<variable_type> arena;
+    std::vector<expression<variable_type>> interned;
+    interned.reserve(constraints.size());
+    for (const auto &constraint : constraints) {
+        interned.push_back(arena.intern(constraint));
+    }
+    end = std::chrono::high_resolution_clock::now();
+    std::cout << "Hash-consing, nodes: " << arena.requests() << ", unique nodes: " << arena.size() << ", time: "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count() << " ms" << std::endl;
+    BOOST_CHECK(arena.size() < arena.requests() / 100);
+
+    begin = std::chrono::high_resolution_clock::now();
+    expression_variable_type_converter<variable_type, variable_type> converter;
+    std::vector<expression<variable_type>> converted;
+    converted.reserve(interned.size());
+    for (const auto &constraint : interned) {
+        converted.push_back(converter.convert(constraint));
+    }
+    end = std::chrono::high_resolution_clock::now();
+    std::cout << "Conversion, converted subexpressions: " << converter.converted_count() << ", time: "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count() << " ms" << std::endl;
+
+    BOOST_CHECK_EQUAL(converter.converted_count(), arena.size());
+    for (std::size_t i = 0; i < constraints.size(); ++i) {
+        BOOST_CHECK(interned[i] == constraints[i]);
+        BOOST_CHECK(converted[i] == constraints[i]);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
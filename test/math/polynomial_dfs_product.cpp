@@ -0,0 +1,101 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+// @file Test of the balanced product tree used for the permutation argument factors
+// against the sequential polynomial product.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE polynomial_dfs_product_test
+
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/pallas.hpp>
+#include <nil/crypto3/algebra/random_element.hpp>
+
+#include <nil/crypto3/math/polynomial/polynomial_dfs.hpp>
+
+#include <nil/crypto3/zk/math/polynomial_dfs_product.hpp>
+
+using namespace nil::crypto3;
+
+template<typename FieldType>
+void test_polynomial_product_tree(std::size_t basic_size, std::size_t width) {
+    typedef typename FieldType::value_type value_type;
+
+    std::vector<math::polynomial_dfs<value_type>> factors(width);
+    for (auto &factor : factors) {
+        std::vector<value_type> values(basic_size);
+        for (auto &value : values) {
+            value = algebra::random_element<FieldType>();
+        }
+        factor = math::polynomial_dfs<value_type>(basic_size - 1, values.begin(), values.end());
+    }
+
+    math::polynomial_dfs<value_type> expected = math::polynomial_product<FieldType>(factors);
+    math::polynomial_dfs<value_type> product = math::polynomial_product_tree<FieldType>(factors);
+
+    BOOST_CHECK_EQUAL(product.degree(), expected.degree());
+    if (product.size() < expected.size()) {
+        product.resize(expected.size());
+    } else if (expected.size() < product.size()) {
+        expected.resize(product.size());
+    }
+    BOOST_CHECK(product == expected);
+
+    // On the basic domain the product is the product of the base values, row by row.
+    std::size_t step = product.size() / basic_size;
+    std::vector<value_type> row_products(basic_size, value_type::one());
+    for (const auto &factor : factors) {
+        for (std::size_t j = 0; j < basic_size; ++j) {
+            row_products[j] *= factor[j];
+        }
+    }
+    for (std::size_t j = 0; j < basic_size; ++j) {
+        BOOST_CHECK(product[j * step] == row_products[j]);
+    }
+
+    std::vector<value_type> inverses = row_products;
+    math::parallel_batch_inverse(inverses);
+    for (std::size_t j = 0; j < basic_size; ++j) {
+        BOOST_CHECK(inverses[j] * row_products[j] == value_type::one());
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(polynomial_dfs_product_test_suite)
+
+BOOST_AUTO_TEST_CASE(polynomial_dfs_product_small_test) {
+    using field_type = typename algebra::curves::pallas::base_field_type;
+    test_polynomial_product_tree<field_type>(8, 1);
+    test_polynomial_product_tree<field_type>(8, 5);
+    test_polynomial_product_tree<field_type>(16, 16);
+}
+
+BOOST_AUTO_TEST_CASE(polynomial_dfs_product_wide_test) {
+    using field_type = typename algebra::curves::pallas::base_field_type;
+    test_polynomial_product_tree<field_type>(1 << 6, 33);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
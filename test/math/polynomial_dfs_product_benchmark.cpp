@@ -0,0 +1,92 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+// @file Benchmark of the balanced product tree used for the permutation argument factors
+// against the sequential polynomial product, and of the parallel batch inversion.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE polynomial_dfs_product_benchmark
+
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/pallas.hpp>
+#include <nil/crypto3/algebra/random_element.hpp>
+
+#include <nil/crypto3/math/polynomial/polynomial_dfs.hpp>
+
+#include <nil/crypto3/zk/math/polynomial_dfs_product.hpp>
+
+using namespace nil::crypto3;
+
+template<typename FieldType>
+void polynomial_product_tree_benchmark(std::size_t basic_size, std::size_t width) {
+    typedef typename FieldType::value_type value_type;
+
+    std::vector<math::polynomial_dfs<value_type>> factors(width);
+    for (auto &factor : factors) {
+        std::vector<value_type> values(basic_size);
+        for (auto &value : values) {
+            value = algebra::random_element<FieldType>();
+        }
+        factor = math::polynomial_dfs<value_type>(basic_size - 1, values.begin(), values.end());
+    }
+
+    std::cout << "Rows " << basic_size << ", width " << width << std::endl;
+
+    auto begin = std::chrono::high_resolution_clock::now();
+    math::polynomial_dfs<value_type> expected = math::polynomial_product<FieldType>(factors);
+    auto end = std::chrono::high_resolution_clock::now();
+    std::cout << "Sequential product, time: "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count() << " ms" << std::endl;
+
+    begin = std::chrono::high_resolution_clock::now();
+    math::polynomial_dfs<value_type> product = math::polynomial_product_tree<FieldType>(factors);
+    end = std::chrono::high_resolution_clock::now();
+    std::cout << "Product tree, time: "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count() << " ms" << std::endl;
+
+    BOOST_CHECK_EQUAL(product.degree(), expected.degree());
+
+    std::vector<value_type> inverses(factors[0].begin(), factors[0].begin() + basic_size);
+    begin = std::chrono::high_resolution_clock::now();
+    math::parallel_batch_inverse(inverses);
+    end = std::chrono::high_resolution_clock::now();
+    std::cout << "Batch inversion of " << basic_size << " rows, time: "
+              << std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count() << " us" << std::endl;
+}
+
+BOOST_AUTO_TEST_SUITE(polynomial_dfs_product_benchmark_suite)
+
+BOOST_AUTO_TEST_CASE(polynomial_dfs_product_benchmark) {
+    using field_type = typename algebra::curves::pallas::base_field_type;
+    for (std::size_t width : {16, 64, 128, 256, 512}) {
+        polynomial_product_tree_benchmark<field_type>(1 << 8, width);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,107 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+// @file Test of the point-wise expression evaluator against the polynomial evaluator on
+// materialized rotations.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE rowwise_expression_evaluator_test
+
+#include <algorithm>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/pallas.hpp>
+#include <nil/crypto3/algebra/random_element.hpp>
+
+#include <nil/crypto3/math/polynomial/polynomial_dfs.hpp>
+
+#include <nil/crypto3/zk/math/expression.hpp>
+#include <nil/crypto3/zk/math/expression_evaluator.hpp>
+#include <nil/crypto3/zk/math/rowwise_expression_evaluator.hpp>
+#include <nil/crypto3/zk/math/shifted_polynomial_dfs.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/plonk/variable.hpp>
+
+using namespace nil::crypto3;
+
+template<typename FieldType>
+void test_rowwise_expression_evaluator(std::size_t basic_size, std::size_t extension) {
+    typedef typename FieldType::value_type value_type;
+    typedef math::polynomial_dfs<value_type> polynomial_type;
+    typedef zk::snark::plonk_variable<polynomial_type> variable_type;
+
+    std::vector<polynomial_type> columns(3);
+    for (auto &column : columns) {
+        std::vector<value_type> values(basic_size);
+        for (auto &value : values) {
+            value = algebra::random_element<FieldType>();
+        }
+        column = polynomial_type(basic_size - 1, values.begin(), values.end());
+        column.resize(basic_size * extension);
+    }
+
+    auto constant = [](const value_type &value) {
+        return polynomial_type(0, 1, value);
+    };
+
+    variable_type w0(0, 0), w0_prev(0, -1), w1_next(1, 1), w2(2, 0), w2_next2(2, 2);
+
+    // shared appears several times, so the evaluators cache it
+    math::expression<variable_type> shared = w0 * w1_next + w2_next2;
+    math::expression<variable_type> expr = shared * shared +
+                                           shared * constant(algebra::random_element<FieldType>()) -
+                                           w0_prev.pow(3) +
+                                           math::term<variable_type>({w0, w1_next, w2}, constant(value_type(5)));
+
+    math::cached_expression_evaluator<variable_type> polynomial_evaluator(
+        expr, [&columns, basic_size](const variable_type &var) {
+            return math::extended_polynomial_shift(columns[var.index], var.rotation, basic_size);
+        });
+    polynomial_type expected = polynomial_evaluator.evaluate();
+
+    math::rowwise_expression_evaluator<variable_type> rowwise_evaluator(
+        expr, basic_size * extension, [&columns, basic_size](const variable_type &var) {
+            return math::shifted_polynomial_dfs_view<value_type>(columns[var.index], var.rotation, basic_size);
+        });
+    polynomial_type result = rowwise_evaluator.evaluate();
+
+    BOOST_CHECK_EQUAL(result.degree(), expected.degree());
+    BOOST_CHECK_EQUAL(result.size(), expected.size());
+    BOOST_CHECK(std::equal(result.begin(), result.end(), expected.begin()));
+}
+
+BOOST_AUTO_TEST_SUITE(rowwise_expression_evaluator_test_suite)
+
+BOOST_AUTO_TEST_CASE(rowwise_expression_evaluator_small_test_case) {
+    using field_type = typename algebra::curves::pallas::base_field_type;
+    test_rowwise_expression_evaluator<field_type>(8, 8);
+}
+
+BOOST_AUTO_TEST_CASE(rowwise_expression_evaluator_medium_test_case) {
+    using field_type = typename algebra::curves::pallas::base_field_type;
+    test_rowwise_expression_evaluator<field_type>(1 << 8, 4);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,85 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+// @file Test of rotations of extended polynomials against shifting on the basic
+// domain followed by a new extension.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE shifted_polynomial_dfs_test
+
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/pallas.hpp>
+#include <nil/crypto3/algebra/random_element.hpp>
+
+#include <nil/crypto3/math/polynomial/polynomial_dfs.hpp>
+#include <nil/crypto3/math/polynomial/shift.hpp>
+
+#include <nil/crypto3/zk/math/shifted_polynomial_dfs.hpp>
+
+using namespace nil::crypto3;
+
+template<typename FieldType>
+void test_shifted_polynomial_dfs(std::size_t basic_size, std::size_t extension, const std::vector<int> &rotations) {
+    typedef typename FieldType::value_type value_type;
+
+    std::vector<value_type> values(basic_size);
+    for (auto &value : values) {
+        value = algebra::random_element<FieldType>();
+    }
+    math::polynomial_dfs<value_type> f(basic_size - 1, values.begin(), values.end());
+
+    math::polynomial_dfs<value_type> f_extended = f;
+    f_extended.resize(basic_size * extension);
+
+    for (std::size_t i = 0; i < rotations.size(); ++i) {
+        math::polynomial_dfs<value_type> expected = math::polynomial_shift(f, rotations[i], basic_size);
+        expected.resize(basic_size * extension);
+        BOOST_CHECK(math::extended_polynomial_shift(f_extended, rotations[i], basic_size) == expected);
+
+        math::shifted_polynomial_dfs_view<value_type> view(f_extended, rotations[i], basic_size);
+        BOOST_CHECK_EQUAL(view.size(), f_extended.size());
+        BOOST_CHECK(view[0] == expected[0]);
+        BOOST_CHECK(view[view.size() - 1] == expected[view.size() - 1]);
+    }
+
+    // Without extension the rotation is polynomial_shift itself.
+    BOOST_CHECK(math::extended_polynomial_shift(f, -1, basic_size) == math::polynomial_shift(f, -1, basic_size));
+}
+
+BOOST_AUTO_TEST_SUITE(shifted_polynomial_dfs_test_suite)
+
+BOOST_AUTO_TEST_CASE(shifted_polynomial_dfs_small_test_case) {
+    using field_type = typename algebra::curves::pallas::base_field_type;
+    test_shifted_polynomial_dfs<field_type>(8, 4, {1, -1, 2, 7, -7});
+}
+
+BOOST_AUTO_TEST_CASE(shifted_polynomial_dfs_medium_test_case) {
+    using field_type = typename algebra::curves::pallas::base_field_type;
+    test_shifted_polynomial_dfs<field_type>(1 << 10, 8, {1, -1, 2, -2, 3, -3});
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,200 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+// @file Test of the sparse (CSR) R1CS and USCS representations against the default
+// vector-of-constraints layout: satisfiability and the QAP, SAP and SSP witness maps.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE r1cs_sparse_test
+
+#include <boost/test/unit_test.hpp>
+
+#include <future>
+#include <vector>
+
+#include <nil/crypto3/zk/snark/reductions/r1cs_to_qap.hpp>
+#include <nil/crypto3/zk/snark/reductions/r1cs_to_sap.hpp>
+#include <nil/crypto3/zk/snark/reductions/uscs_to_ssp.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/constraint_satisfaction_problems/r1cs.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/constraint_satisfaction_problems/r1cs_sparse.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/constraint_satisfaction_problems/uscs.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/constraint_satisfaction_problems/uscs_sparse.hpp>
+
+#include <nil/crypto3/algebra/random_element.hpp>
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/bls12.hpp>
+
+#include "../../systems/ppzksnark/r1cs_examples.hpp"
+#include "uscs_examples.hpp"
+
+using namespace nil::crypto3::zk::snark;
+using namespace nil::crypto3::algebra;
+
+template<typename FieldType>
+void test_r1cs_sparse(const std::size_t num_constraints, const std::size_t num_inputs) {
+    r1cs_example<FieldType> example =
+        generate_r1cs_example_with_field_input<FieldType>(num_constraints, num_inputs);
+
+    r1cs_sparse_constraint_system<FieldType> sparse_cs =
+        make_r1cs_sparse_constraint_system(example.constraint_system);
+
+    BOOST_CHECK_EQUAL(sparse_cs.num_constraints(), example.constraint_system.num_constraints());
+    BOOST_CHECK_EQUAL(sparse_cs.num_variables(), example.constraint_system.num_variables());
+
+    BOOST_CHECK(example.constraint_system.is_satisfied(example.primary_input, example.auxiliary_input));
+    BOOST_CHECK(sparse_cs.is_satisfied(example.primary_input, example.auxiliary_input));
+
+    r1cs_auxiliary_input<FieldType> broken_auxiliary_input = example.auxiliary_input;
+    broken_auxiliary_input.back() += FieldType::value_type::one();
+    BOOST_CHECK_EQUAL(example.constraint_system.is_satisfied(example.primary_input, broken_auxiliary_input),
+                      sparse_cs.is_satisfied(example.primary_input, broken_auxiliary_input));
+
+    const typename FieldType::value_type d1 = random_element<FieldType>(), d2 = random_element<FieldType>(),
+                                         d3 = random_element<FieldType>();
+
+    reductions::detail::witness_map_statistics &statistics = reductions::r1cs_to_qap<FieldType>::statistics();
+    statistics.reset();
+
+    qap_witness<FieldType> witness = reductions::r1cs_to_qap<FieldType>::witness_map(
+        example.constraint_system, example.primary_input, example.auxiliary_input, d1, d2, d3);
+    qap_witness<FieldType> sparse_witness = reductions::r1cs_to_qap<FieldType>::witness_map(
+        sparse_cs, example.primary_input, example.auxiliary_input, d1, d2, d3);
+
+    /* three interpolations, three coset evaluations and the interpolation of H per witness map */
+    BOOST_CHECK_EQUAL(statistics.witness_maps.load(), 2u);
+    BOOST_CHECK_EQUAL(statistics.ffts.load(), 2u * 3);
+    BOOST_CHECK_EQUAL(statistics.inverse_ffts.load(), 2u * 4);
+
+    BOOST_CHECK(witness.coefficients_for_ABCs == sparse_witness.coefficients_for_ABCs);
+    BOOST_CHECK(witness.coefficients_for_H == sparse_witness.coefficients_for_H);
+
+    qap_instance<FieldType> qap_inst = reductions::r1cs_to_qap<FieldType>::instance_map(example.constraint_system);
+    BOOST_CHECK(qap_inst.is_satisfied(sparse_witness));
+}
+
+template<typename FieldType>
+void test_sap_sparse(const std::size_t num_constraints, const std::size_t num_inputs) {
+    r1cs_example<FieldType> example =
+        generate_r1cs_example_with_field_input<FieldType>(num_constraints, num_inputs);
+    r1cs_sparse_constraint_system<FieldType> sparse_cs =
+        make_r1cs_sparse_constraint_system(example.constraint_system);
+
+    const typename FieldType::value_type d1 = random_element<FieldType>(), d2 = random_element<FieldType>();
+
+    sap_witness<FieldType> witness = reductions::r1cs_to_sap<FieldType>::witness_map(
+        example.constraint_system, example.primary_input, example.auxiliary_input, d1, d2);
+    sap_witness<FieldType> sparse_witness = reductions::r1cs_to_sap<FieldType>::witness_map(
+        sparse_cs, example.primary_input, example.auxiliary_input, d1, d2);
+
+    BOOST_CHECK(witness.coefficients_for_ACs == sparse_witness.coefficients_for_ACs);
+    BOOST_CHECK(witness.coefficients_for_H == sparse_witness.coefficients_for_H);
+
+    sap_instance<FieldType> sap_inst = reductions::r1cs_to_sap<FieldType>::instance_map(example.constraint_system);
+    BOOST_CHECK(sap_inst.is_satisfied(sparse_witness));
+}
+
+template<typename FieldType>
+void test_ssp_sparse(const std::size_t num_constraints, const std::size_t num_inputs) {
+    uscs_example<FieldType> example = generate_uscs_example_with_field_input<FieldType>(num_constraints, num_inputs);
+    uscs_sparse_constraint_system<FieldType> sparse_cs = make_uscs_sparse_constraint_system(example.constraint_system);
+
+    BOOST_CHECK_EQUAL(sparse_cs.num_constraints(), example.constraint_system.num_constraints());
+    BOOST_CHECK_EQUAL(sparse_cs.num_variables(), example.constraint_system.num_variables());
+    BOOST_CHECK(sparse_cs.is_satisfied(example.primary_input, example.auxiliary_input));
+
+    uscs_auxiliary_input<FieldType> broken_auxiliary_input = example.auxiliary_input;
+    broken_auxiliary_input.back() += FieldType::value_type::one();
+    BOOST_CHECK_EQUAL(example.constraint_system.is_satisfied(example.primary_input, broken_auxiliary_input),
+                      sparse_cs.is_satisfied(example.primary_input, broken_auxiliary_input));
+
+    const typename FieldType::value_type d = random_element<FieldType>();
+
+    ssp_witness<FieldType> witness = reductions::uscs_to_ssp<FieldType>::witness_map(
+        example.constraint_system, example.primary_input, example.auxiliary_input, d);
+    ssp_witness<FieldType> sparse_witness = reductions::uscs_to_ssp<FieldType>::witness_map(
+        sparse_cs, example.primary_input, example.auxiliary_input, d);
+
+    BOOST_CHECK(witness.coefficients_for_Vs == sparse_witness.coefficients_for_Vs);
+    BOOST_CHECK(witness.coefficients_for_H == sparse_witness.coefficients_for_H);
+
+    ssp_instance<FieldType> ssp_inst = reductions::uscs_to_ssp<FieldType>::instance_map(example.constraint_system);
+    BOOST_CHECK(ssp_inst.is_satisfied(sparse_witness));
+}
+
+template<typename FieldType>
+void test_witness_map_domains(const std::size_t num_constraints, const std::size_t num_inputs) {
+    using engine_type = reductions::detail::witness_map_engine<FieldType>;
+
+    r1cs_example<FieldType> example =
+        generate_r1cs_example_with_field_input<FieldType>(num_constraints, num_inputs);
+    const std::size_t domain_size = num_constraints + num_inputs + 1;
+
+    /* the domain of a size is shared until max_cached_domains other sizes were requested after it */
+    auto domain = engine_type::get_domain(domain_size);
+    BOOST_CHECK(engine_type::get_domain(domain_size) == domain);
+    for (std::size_t i = 0; i < engine_type::max_cached_domains; ++i) {
+        engine_type::get_domain(std::size_t(2) << i);
+    }
+    BOOST_CHECK(engine_type::get_domain(domain_size) != domain);
+
+    /* concurrent witness maps run their transforms on the same domain instance */
+    const typename FieldType::value_type d1 = random_element<FieldType>(), d2 = random_element<FieldType>(),
+                                         d3 = random_element<FieldType>();
+    qap_witness<FieldType> witness = reductions::r1cs_to_qap<FieldType>::witness_map(
+        example.constraint_system, example.primary_input, example.auxiliary_input, d1, d2, d3);
+
+    std::vector<std::future<qap_witness<FieldType>>> concurrent_witnesses;
+    for (std::size_t i = 0; i < 4; ++i) {
+        concurrent_witnesses.emplace_back(std::async(std::launch::async, [&example, &d1, &d2, &d3]() {
+            return reductions::r1cs_to_qap<FieldType>::witness_map(
+                example.constraint_system, example.primary_input, example.auxiliary_input, d1, d2, d3);
+        }));
+    }
+    for (auto &concurrent_witness : concurrent_witnesses) {
+        BOOST_CHECK(concurrent_witness.get().coefficients_for_H == witness.coefficients_for_H);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(r1cs_sparse_test_suite)
+
+BOOST_AUTO_TEST_CASE(r1cs_sparse_small_test_case) {
+    using field_type = typename curves::bls12<381>::scalar_field_type;
+    test_r1cs_sparse<field_type>(1 << 10, 10);
+}
+
+BOOST_AUTO_TEST_CASE(sap_sparse_test_case) {
+    using field_type = typename curves::bls12<381>::scalar_field_type;
+    test_sap_sparse<field_type>(1 << 10, 10);
+}
+
+BOOST_AUTO_TEST_CASE(ssp_sparse_test_case) {
+    using field_type = typename curves::bls12<381>::scalar_field_type;
+    test_ssp_sparse<field_type>(1 << 10, 10);
+}
+
+BOOST_AUTO_TEST_CASE(r1cs_witness_map_domains_test_case) {
+    using field_type = typename curves::bls12<381>::scalar_field_type;
+    test_witness_map_domains<field_type>(1 << 10, 10);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
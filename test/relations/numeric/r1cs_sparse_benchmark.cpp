@@ -0,0 +1,111 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+// @file Benchmark of the sparse (CSR) R1CS representation against the default
+// vector-of-constraints layout: conversion, is_satisfied and the QAP witness map.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE r1cs_sparse_benchmark
+
+#include <boost/test/unit_test.hpp>
+
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+#include <nil/crypto3/zk/snark/reductions/r1cs_to_qap.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/constraint_satisfaction_problems/r1cs.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/constraint_satisfaction_problems/r1cs_sparse.hpp>
+
+#include <nil/crypto3/algebra/random_element.hpp>
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/bls12.hpp>
+
+#include "../../systems/ppzksnark/r1cs_examples.hpp"
+
+using namespace nil::crypto3::zk::snark;
+using namespace nil::crypto3::algebra;
+
+template<typename FieldType>
+void run_r1cs_sparse_benchmark(const std::size_t num_constraints, const std::size_t num_inputs) {
+    r1cs_example<FieldType> example =
+        generate_r1cs_example_with_field_input<FieldType>(num_constraints, num_inputs);
+
+    auto begin = std::chrono::high_resolution_clock::now();
+    r1cs_sparse_constraint_system<FieldType> sparse_cs =
+        make_r1cs_sparse_constraint_system(example.constraint_system);
+    auto end = std::chrono::high_resolution_clock::now();
+
+    std::cout << "Num constraints " << num_constraints << std::endl;
+    std::cout << "Conversion to CSR, time: "
+              << std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count() * 1e-9 << std::endl;
+
+    begin = std::chrono::high_resolution_clock::now();
+    BOOST_CHECK(example.constraint_system.is_satisfied(example.primary_input, example.auxiliary_input));
+    end = std::chrono::high_resolution_clock::now();
+    std::cout << "is_satisfied (vector layout), time: "
+              << std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count() * 1e-9 << std::endl;
+
+    begin = std::chrono::high_resolution_clock::now();
+    BOOST_CHECK(sparse_cs.is_satisfied(example.primary_input, example.auxiliary_input));
+    end = std::chrono::high_resolution_clock::now();
+    std::cout << "is_satisfied (CSR layout), time: "
+              << std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count() * 1e-9 << std::endl;
+
+    const typename FieldType::value_type d1 = random_element<FieldType>(), d2 = random_element<FieldType>(),
+                                         d3 = random_element<FieldType>();
+
+    reductions::detail::witness_map_statistics &statistics = reductions::r1cs_to_qap<FieldType>::statistics();
+    statistics.reset();
+
+    begin = std::chrono::high_resolution_clock::now();
+    qap_witness<FieldType> witness = reductions::r1cs_to_qap<FieldType>::witness_map(
+        example.constraint_system, example.primary_input, example.auxiliary_input, d1, d2, d3);
+    end = std::chrono::high_resolution_clock::now();
+    std::cout << "QAP witness map (vector layout), time: "
+              << std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count() * 1e-9 << std::endl;
+
+    begin = std::chrono::high_resolution_clock::now();
+    qap_witness<FieldType> sparse_witness = reductions::r1cs_to_qap<FieldType>::witness_map(
+        sparse_cs, example.primary_input, example.auxiliary_input, d1, d2, d3);
+    end = std::chrono::high_resolution_clock::now();
+    std::cout << "QAP witness map (CSR layout), time: "
+              << std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count() * 1e-9 << std::endl;
+
+    std::cout << "QAP witness maps: " << statistics.witness_maps.load() << ", FFTs: " << statistics.ffts.load()
+              << ", inverse FFTs: " << statistics.inverse_ffts.load()
+              << ", FFT time: " << statistics.fft_nanoseconds.load() * 1e-9
+              << ", total time: " << statistics.total_nanoseconds.load() * 1e-9 << std::endl;
+
+    BOOST_CHECK(witness.coefficients_for_H == sparse_witness.coefficients_for_H);
+}
+
+BOOST_AUTO_TEST_SUITE(r1cs_sparse_benchmark_suite)
+
+BOOST_AUTO_TEST_CASE(r1cs_sparse_benchmark_test_case) {
+    using field_type = typename curves::bls12<381>::scalar_field_type;
+    run_r1cs_sparse_benchmark<field_type>(1 << 16, 10);
+    run_r1cs_sparse_benchmark<field_type>(1 << 18, 10);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -94,7 +94,7 @@ namespace nil {
                         const typename FieldType::value_type x_coeff = typename FieldType::value_type(std::rand());
                         const typename FieldType::value_type y_coeff = typename FieldType::value_type(std::rand());
                         const typename FieldType::value_type val =
-                            (std::rand() % 2 == 0 ? FieldType::value_type::zero() : -FieldType::value_type::zero());
+                            (std::rand() % 2 == 0 ? FieldType::value_type::one() : -FieldType::value_type::one());
                         const typename FieldType::value_type z_coeff =
                             (val - x_coeff * full_variable_assignment[x] - y_coeff * full_variable_assignment[y]) *
                             full_variable_assignment[z].inversed();
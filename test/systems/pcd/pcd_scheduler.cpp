@@ -0,0 +1,145 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE pcd_scheduler_test
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/zk/snark/systems/pcd/r1cs_pcd/pcd_scheduler.hpp>
+
+#include <nil/actor/core/thread_pool.hpp>
+#include <nil/actor/core/parallelization_utils.hpp>
+
+using namespace nil::crypto3::zk::snark;
+
+namespace {
+    typedef pcd_scheduler<std::size_t> scheduler_type;
+
+    // Node value plus the sum of the results of the children.
+    scheduler_type::task_type sum_task(std::size_t value) {
+        return [value](const std::vector<const std::size_t *> &children_results) {
+            std::size_t result = value;
+            for (const std::size_t *child : children_results) {
+                result += *child;
+            }
+            return result;
+        };
+    }
+
+    // Complete binary tree of 2^(depth + 1) - 1 nodes with value 1 each, children first.
+    std::size_t add_binary_tree(scheduler_type &scheduler, std::size_t depth, std::size_t memory = 0) {
+        if (depth == 0) {
+            return scheduler.add_node(sum_task(1), {}, memory);
+        }
+        std::size_t left = add_binary_tree(scheduler, depth - 1, memory);
+        std::size_t right = add_binary_tree(scheduler, depth - 1, memory);
+        return scheduler.add_node(sum_task(1), {left, right}, memory);
+    }
+}    // namespace
+
+BOOST_AUTO_TEST_SUITE(pcd_scheduler_test_suite)
+
+BOOST_AUTO_TEST_CASE(pcd_scheduler_tree_test) {
+    scheduler_type scheduler;
+    std::size_t root = add_binary_tree(scheduler, 5);
+    BOOST_CHECK_EQUAL(scheduler.size(), 63);
+
+    std::vector<std::size_t> results = scheduler.run();
+    BOOST_CHECK_EQUAL(results.size(), 63);
+    BOOST_CHECK_EQUAL(results[root], 63);
+    BOOST_CHECK_EQUAL(scheduler.statistics().critical_path.size(), 6);
+    BOOST_CHECK_EQUAL(scheduler.statistics().critical_path.back(), root);
+}
+
+BOOST_AUTO_TEST_CASE(pcd_scheduler_chain_test) {
+    scheduler_type scheduler;
+    std::size_t last = scheduler.add_node(sum_task(0), {});
+    for (std::size_t i = 1; i < 10; ++i) {
+        last = scheduler.add_node(sum_task(i), {last});
+    }
+
+    std::vector<std::size_t> results = scheduler.run();
+    BOOST_CHECK_EQUAL(results[last], 45);
+    BOOST_CHECK_EQUAL(scheduler.statistics().peak_concurrency, 1);
+    BOOST_CHECK_EQUAL(scheduler.statistics().critical_path.size(), 10);
+}
+
+BOOST_AUTO_TEST_CASE(pcd_scheduler_limits_test) {
+    scheduler_type scheduler;
+    std::size_t root = add_binary_tree(scheduler, 6, 2);
+
+    std::vector<std::size_t> results = scheduler.run(0, 3);
+    BOOST_CHECK_EQUAL(results[root], 127);
+    BOOST_CHECK_LE(scheduler.statistics().peak_concurrency, 3);
+
+    results = scheduler.run(5);
+    BOOST_CHECK_EQUAL(results[root], 127);
+    BOOST_CHECK_LE(scheduler.statistics().peak_memory, 5);
+    BOOST_CHECK_LE(scheduler.statistics().peak_concurrency, 2);
+}
+
+BOOST_AUTO_TEST_CASE(pcd_scheduler_nested_parallelism_test) {
+    // Every node waits for tasks of both pool levels, as node provers do. There are more ready
+    // leaves than workers of any level, which deadlocks if the nodes run on the pool themselves.
+    std::size_t workers = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+    scheduler_type scheduler;
+    std::vector<std::size_t> leaves;
+    for (std::size_t i = 0; i < 4 * workers + 1; ++i) {
+        leaves.push_back(scheduler.add_node(
+            [](const std::vector<const std::size_t *> &) {
+                std::atomic<std::size_t> sum(0);
+                nil::crypto3::parallel_for(0, 64, [&sum](std::size_t) {
+                    std::atomic<std::size_t> inner(0);
+                    nil::crypto3::parallel_for(0, 4, [&inner](std::size_t) { ++inner; });
+                    sum += inner;
+                }, nil::crypto3::ThreadPool::PoolLevel::HIGH);
+                return sum.load();
+            },
+            {}));
+    }
+    std::size_t root = scheduler.add_node(sum_task(0), leaves);
+
+    std::vector<std::size_t> results = scheduler.run(0, 2 * workers);
+    BOOST_CHECK_EQUAL(results[root], leaves.size() * 64 * 4);
+}
+
+BOOST_AUTO_TEST_CASE(pcd_scheduler_exception_test) {
+    scheduler_type scheduler;
+    std::size_t leaf = scheduler.add_node(sum_task(1), {});
+    std::size_t failing = scheduler.add_node(
+        [](const std::vector<const std::size_t *> &) -> std::size_t { throw std::runtime_error("node failed"); },
+        {leaf});
+    scheduler.add_node(sum_task(1), {failing});
+
+    BOOST_CHECK_THROW(scheduler.run(), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
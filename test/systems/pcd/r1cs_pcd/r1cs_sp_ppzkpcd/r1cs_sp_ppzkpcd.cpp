@@ -49,4 +49,12 @@ BOOST_AUTO_TEST_CASE(r1cs_sp_ppzkpcd_test) {
     test_tally<PCD_pp>(arity, max_layer);
 }
 
+BOOST_AUTO_TEST_CASE(r1cs_sp_ppzkpcd_scheduled_test) {
+    typedef default_r1cs_ppzkpcd_pp PCD_pp;
+
+    const std::size_t wordsize = 32;
+    BOOST_CHECK(run_r1cs_sp_ppzkpcd_tally_scheduled<PCD_pp>(wordsize, 2, 2));
+    BOOST_CHECK(run_r1cs_sp_ppzkpcd_tally_scheduled<PCD_pp>(wordsize, 2, 3, 2));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -30,6 +30,7 @@
 #define CRYPTO3_RUN_R1CS_SP_PPZKPCD_HPP
 
 #include <cstddef>
+#include <mutex>
 #include <vector>
 
 #include "tally_cp.hpp"
@@ -139,6 +140,86 @@ namespace nil {
 
                     return all_accept;
                 }
+
+                /**
+                 * Same tally computation, with the whole tree proved by pcd_scheduler. Every node is
+                 * accounted for one unit of memory, so memory_limit caps the nodes proved at once.
+                 */
+                template<typename PCD_ppT>
+                bool run_r1cs_sp_ppzkpcd_tally_scheduled(std::size_t wordsize, std::size_t arity, std::size_t depth,
+                                                         std::size_t memory_limit = 0) {
+
+                    typedef algebra::Fr<typename PCD_ppT::curve_A_pp> FieldType;
+
+                    std::size_t tree_size = 0;
+                    std::size_t nodes_in_layer = 1;
+                    for (std::size_t layer = 0; layer <= depth; ++layer) {
+                        tree_size += nodes_in_layer;
+                        nodes_in_layer *= arity;
+                    }
+                    std::vector<std::size_t> tree_elems(tree_size);
+                    for (std::size_t i = 0; i < tree_size; ++i) {
+                        tree_elems[i] = std::rand() % 10;
+                    }
+
+                    const std::size_t type = 1;
+                    tally_cp_handler<FieldType> tally(type, arity, wordsize);
+                    tally.generate_r1cs_constraints();
+                    r1cs_pcd_compliance_predicate<FieldType> tally_cp = tally.get_compliance_predicate();
+
+                    r1cs_sp_ppzkpcd_keypair<PCD_ppT> keypair = r1cs_sp_ppzkpcd_generator<PCD_ppT>(tally_cp);
+                    r1cs_sp_ppzkpcd_processed_verification_key<PCD_ppT> pvk =
+                        r1cs_sp_ppzkpcd_process_vk<PCD_ppT>(keypair.vk);
+
+                    std::shared_ptr<r1cs_pcd_message<FieldType>> base_msg = tally.get_base_case_message();
+
+                    /* The tally handler keeps the witness of the last node, it is shared under a lock. */
+                    std::mutex tally_mutex;
+                    r1cs_sp_ppzkpcd_scheduler<PCD_ppT> scheduler;
+                    std::vector<std::size_t> scheduler_ids(tree_size);
+                    for (std::size_t cur_idx = tree_size; cur_idx-- > 0;) {
+                        std::vector<std::size_t> children;
+                        if (arity * cur_idx + arity < tree_size) {
+                            for (std::size_t i = 0; i < arity; ++i) {
+                                children.push_back(scheduler_ids[arity * cur_idx + i + 1]);
+                            }
+                        }
+
+                        auto witness_generator =
+                            [&tally, &tally_mutex, &tree_elems, base_msg, arity, cur_idx](
+                                const std::vector<std::shared_ptr<r1cs_pcd_message<FieldType>>> &incoming_messages) {
+                                std::vector<std::shared_ptr<r1cs_pcd_message<FieldType>>> msgs = incoming_messages;
+                                if (msgs.empty()) {
+                                    msgs.assign(arity, base_msg);
+                                }
+                                std::shared_ptr<r1cs_pcd_local_data<FieldType>> ld;
+                                ld.reset(new tally_pcd_local_data<FieldType>(tree_elems[cur_idx]));
+
+                                std::lock_guard<std::mutex> lock(tally_mutex);
+                                tally.generate_r1cs_witness(msgs, ld);
+                                return std::make_pair(
+                                    r1cs_pcd_compliance_predicate_primary_input<FieldType>(tally.get_outgoing_message()),
+                                    r1cs_pcd_compliance_predicate_auxiliary_input<FieldType>(msgs, ld,
+                                                                                             tally.get_witness()));
+                            };
+                        scheduler_ids[cur_idx] =
+                            r1cs_sp_ppzkpcd_add_node<PCD_ppT>(scheduler, keypair.pk, witness_generator, children, 1);
+                    }
+
+                    std::vector<r1cs_sp_ppzkpcd_node_output<PCD_ppT>> outputs = scheduler.run(memory_limit);
+                    const pcd_scheduler_statistics &statistics = scheduler.statistics();
+                    printf("* Tally tree, arity %zu, %zu nodes, time: %f, sequential time: %f, critical path: %zu nodes, "
+                           "%f s, peak concurrency: %zu\n",
+                           arity, tree_size, statistics.seconds, statistics.work_seconds,
+                           statistics.critical_path.size(), statistics.critical_path_seconds,
+                           statistics.peak_concurrency);
+
+                    bool all_accept = statistics.critical_path.size() == depth + 1;
+                    if (memory_limit != 0) {
+                        all_accept = all_accept && statistics.peak_memory <= memory_limit;
+                    }
+                    return all_accept && r1cs_sp_ppzkpcd_online_verifier<PCD_ppT>(pvk, outputs);
+                }
             }    // namespace snark
         }        // namespace zk
     }            // namespace crypto3
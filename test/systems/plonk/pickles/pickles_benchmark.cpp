@@ -0,0 +1,115 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+// @file Benchmark of Kimchi linearization compilation and of batched Pickles proof verification.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE pickles_benchmark
+
+#include <chrono>
+#include <iostream>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/random_element.hpp>
+
+#include <nil/crypto3/zk/snark/systems/plonk/pickles/compiled_expr.hpp>
+#include <nil/crypto3/zk/snark/systems/plonk/pickles/verifier.hpp>
+
+#include "pickles_test_data.hpp"
+
+BOOST_AUTO_TEST_SUITE(pickles_benchmark_suite)
+
+BOOST_AUTO_TEST_CASE(pickles_linearization_benchmark) {
+    constexpr static const std::size_t repetitions = 100;
+
+    zk::snark::proof_type<curve_type> proof;
+    zk::snark::verifier_index<curve_type> index;
+    fill_pickles_test_data(proof, index);
+
+    std::vector<proof_evaluation_type<scalar_field_type::value_type>> evals = {
+        proof.evals[0].combine(scalar_field_type::value_type::one()),
+        proof.evals[1].combine(scalar_field_type::value_type::one())};
+    Constants<scalar_field_type> constants = {
+        algebra::random_element<scalar_field_type>(), algebra::random_element<scalar_field_type>(),
+        algebra::random_element<scalar_field_type>(), algebra::random_element<scalar_field_type>(),
+        index.endo, index.fr_sponge_params.mds};
+    scalar_field_type::value_type zeta = algebra::random_element<scalar_field_type>();
+    math::basic_radix2_domain<scalar_field_type> domain = index.domain;
+
+    auto begin = std::chrono::high_resolution_clock::now();
+    compiled_linearization<scalar_field_type> compiled(index.linearization);
+    auto end = std::chrono::high_resolution_clock::now();
+    std::cout << "Linearization compilation, time: "
+              << std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count() << " us" << std::endl;
+
+    scalar_field_type::value_type interpreted_sum = scalar_field_type::value_type::zero();
+    begin = std::chrono::high_resolution_clock::now();
+    for (std::size_t r = 0; r < repetitions; ++r) {
+        interpreted_sum +=
+            PolishToken<scalar_field_type>::evaluate(index.linearization.constant_term, domain, zeta, evals, constants);
+        for (const auto &term : index.linearization.index_term) {
+            interpreted_sum +=
+                PolishToken<scalar_field_type>::evaluate(std::get<1>(term), domain, zeta, evals, constants);
+        }
+    }
+    end = std::chrono::high_resolution_clock::now();
+    std::cout << "Interpreted linearization x" << repetitions << ", time: "
+              << std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count() << " us" << std::endl;
+
+    scalar_field_type::value_type compiled_sum = scalar_field_type::value_type::zero();
+    begin = std::chrono::high_resolution_clock::now();
+    for (std::size_t r = 0; r < repetitions; ++r) {
+        polish_evaluation_context<scalar_field_type> context(compiled, domain, zeta, evals, constants);
+        compiled_sum += compiled.constant_term().evaluate(context);
+        for (const auto &term : compiled.index_term()) {
+            compiled_sum += std::get<1>(term).evaluate(context);
+        }
+    }
+    end = std::chrono::high_resolution_clock::now();
+    std::cout << "Compiled linearization x" << repetitions << ", time: "
+              << std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count() << " us" << std::endl;
+
+    BOOST_CHECK(interpreted_sum == compiled_sum);
+}
+
+BOOST_AUTO_TEST_CASE(pickles_batch_verify_benchmark) {
+    zk::snark::proof_type<curve_type> proof;
+    zk::snark::verifier_index<curve_type> index;
+    fill_pickles_test_data(proof, index);
+
+    group_map<curve_type> g_map;
+    for (std::size_t batch_size : {1, 4, 16, 64, 256}) {
+        std::vector<zk::snark::proof_type<curve_type>> proofs(batch_size, proof);
+
+        auto begin = std::chrono::high_resolution_clock::now();
+        BOOST_CHECK(verifier<curve_type>::batch_verify(g_map, index, proofs));
+        auto end = std::chrono::high_resolution_clock::now();
+
+        double seconds = std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count() * 1e-6;
+        std::cout << "Batch verification of " << batch_size << " proofs, time: " << seconds
+                  << " s, proofs per second: " << batch_size / seconds << std::endl;
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
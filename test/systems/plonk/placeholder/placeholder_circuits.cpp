@@ -38,9 +38,11 @@
 #include <nil/crypto3/hash/algorithm/hash.hpp>
 #include <nil/crypto3/hash/poseidon.hpp>
 
+#include <nil/crypto3/zk/transcript/duplex_sponge.hpp>
 #include <nil/crypto3/zk/test_tools/random_test_initializer.hpp>
 
 #include "circuits.hpp"
+#include "synthetic_circuit.hpp"
 #include "placeholder_test_runner.hpp"
 
 BOOST_AUTO_TEST_SUITE(placeholder_circuits)
@@ -107,6 +109,43 @@ BOOST_AUTO_TEST_CASE(circuit5)
     BOOST_CHECK(test_runner.run_test());
 }
 
+BOOST_AUTO_TEST_CASE(synthetic_out_of_core)
+{
+    test_tools::random_test_initializer<field_type> random_test_initializer;
+    synthetic_circuit_params params;
+    params.rows_log = 10;
+    params.witness_columns = 32;
+    params.lookup_tables = 0;
+    auto circuit = circuit_synthetic<field_type>(
+        params,
+        random_test_initializer.alg_random_engines.template get_alg_engine<field_type>(),
+        random_test_initializer.generic_random_engine
+    );
+    test_runner_type test_runner(circuit);
+
+    // Far below the extended evaluations of the witness columns.
+    std::size_t budget = 4 * test_runner.fri_params.D[0]->size() * sizeof(typename field_type::value_type);
+    test_runner.out_of_core_commit = zk::detail::out_of_core_commit_params(budget);
+    zk::detail::out_of_core_statistics &statistics = zk::detail::out_of_core_statistics::instance();
+    statistics.reset();
+
+    // Only the commitments are out of core, the other stages of the prover extend their columns in memory.
+    BOOST_CHECK(test_runner.run_test());
+    BOOST_CHECK(statistics.files > 0);
+    BOOST_CHECK_LE(statistics.peak_resident_bytes.load(), budget);
+}
+
+BOOST_AUTO_TEST_CASE(circuit5_duplex_transcript)
+{
+    test_tools::random_test_initializer<field_type> random_test_initializer;
+    auto circuit = circuit_test_5<field_type>(
+        random_test_initializer.alg_random_engines.template get_alg_engine<field_type>(),
+        random_test_initializer.generic_random_engine
+    );
+    placeholder_test_runner<field_type, hash_type, transcript::duplex_sponge<hash_type>> test_runner(circuit);
+    BOOST_CHECK(test_runner.run_test());
+}
+
 BOOST_AUTO_TEST_CASE(circuit6)
 {
     test_tools::random_test_initializer<field_type> random_test_initializer;
@@ -207,4 +207,93 @@ BOOST_FIXTURE_TEST_CASE(placeholder_gate_argument_test, test_tools::random_test_
     BOOST_CHECK(prover_res[0].evaluate(y) == verifier_res[0]);
 }
 
+BOOST_FIXTURE_TEST_CASE(placeholder_gate_argument_inactive_selector_test, test_tools::random_test_initializer<field_type>) {
+    auto pi0 = alg_random_engines.template get_alg_engine<field_type>()();
+    auto circuit = circuit_test_t<field_type>(
+        pi0,
+        alg_random_engines.template get_alg_engine<field_type>(),
+        generic_random_engine
+    );
+
+    // Add a gate the witness does not satisfy, on a selector which is zero on every row.
+    std::vector<plonk_column<field_type>> selectors = circuit.table.selectors();
+    std::size_t inactive_selector = selectors.size();
+    selectors.push_back(plonk_column<field_type>(circuit.table_rows, field_type::value_type::zero()));
+    circuit.table = plonk_assignment_table<field_type>(
+        circuit.table.private_table(),
+        plonk_public_assignment_table<field_type>(
+            circuit.table.public_inputs(), circuit.table.constants(), selectors));
+
+    using variable_type = plonk_variable<typename field_type::value_type>;
+    variable_type w0(0, 0, true, variable_type::column_type::witness);
+    variable_type w1_next(1, 1, true, variable_type::column_type::witness);
+    plonk_constraint<field_type> inactive_constraint;
+    inactive_constraint += w0;
+    inactive_constraint -= w1_next;
+    circuit.gates.push_back(plonk_gate<field_type, plonk_constraint<field_type>>(
+        inactive_selector, std::vector<plonk_constraint<field_type>>{inactive_constraint}));
+    // The real gate goes last, so its power of theta depends on the skipped one.
+    std::swap(circuit.gates[0], circuit.gates[1]);
+
+    plonk_table_description<field_type> desc(
+        circuit.table.witnesses().size(),
+        circuit.table.public_inputs().size(),
+        circuit.table.constants().size(),
+        circuit.table.selectors().size(),
+        circuit.usable_rows,
+        circuit.table_rows);
+
+    std::size_t table_rows_log = std::log2(desc.rows_amount);
+
+    typename policy_type::constraint_system_type constraint_system(
+        circuit.gates, circuit.copy_constraints, circuit.lookup_gates);
+    typename policy_type::variable_assignment_type assignments = circuit.table;
+
+    typename lpc_type::fri_type::params_type fri_params(1, table_rows_log, placeholder_test_params::lambda, 4);
+    lpc_scheme_type lpc_scheme(fri_params);
+
+    typename placeholder_public_preprocessor<field_type, lpc_placeholder_params_type>::preprocessed_data_type
+        preprocessed_public_data = placeholder_public_preprocessor<field_type, lpc_placeholder_params_type>::process(
+            constraint_system, assignments.public_table(), desc, lpc_scheme
+        );
+
+    typename placeholder_private_preprocessor<field_type, lpc_placeholder_params_type>::preprocessed_data_type
+        preprocessed_private_data = placeholder_private_preprocessor<field_type, lpc_placeholder_params_type>::process(
+            constraint_system, assignments.private_table(), desc
+        );
+
+    const auto &active_selectors = preprocessed_public_data.active_selectors;
+    BOOST_CHECK_EQUAL(active_selectors.size(), desc.selector_columns);
+    BOOST_CHECK(!active_selectors[inactive_selector]);
+    BOOST_CHECK(active_selectors[0]);
+
+    auto polynomial_table =
+        plonk_polynomial_dfs_table<field_type>(
+            preprocessed_private_data.private_polynomial_table, preprocessed_public_data.public_polynomial_table);
+
+    math::polynomial_dfs<typename field_type::value_type> mask_polynomial(
+        0, preprocessed_public_data.common_data.basic_domain->m,
+        typename field_type::value_type(1)
+    );
+    mask_polynomial -= preprocessed_public_data.q_last;
+    mask_polynomial -= preprocessed_public_data.q_blind;
+
+    std::vector<std::uint8_t> init_blob {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    transcript_type dense_transcript(init_blob);
+    transcript_type sparse_transcript(init_blob);
+
+    auto dense_res = placeholder_gates_argument<field_type, lpc_placeholder_params_type>::prove_eval(
+        constraint_system, polynomial_table, preprocessed_public_data.common_data.basic_domain,
+        preprocessed_public_data.common_data.max_gates_degree, mask_polynomial, dense_transcript);
+
+    auto sparse_res = placeholder_gates_argument<field_type, lpc_placeholder_params_type>::prove_eval(
+        constraint_system, polynomial_table, preprocessed_public_data.common_data.basic_domain,
+        preprocessed_public_data.common_data.max_gates_degree, mask_polynomial, sparse_transcript,
+        {}, &active_selectors);
+
+    BOOST_CHECK(dense_res[0] == sparse_res[0]);
+    BOOST_CHECK(dense_transcript.template challenge<field_type>() ==
+                sparse_transcript.template challenge<field_type>());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,139 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+// Benchmark of the gate argument on circuits with sparse selectors.
+//
+// Every selector of the synthetic circuit is enabled on 1 row of gates_amount, the gate argument is timed with
+// all gates evaluated and with the gates of all-zero selectors skipped.
+//
+
+#define BOOST_TEST_MODULE placeholder_gate_argument_benchmark
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/pallas.hpp>
+
+#include <nil/crypto3/hash/algorithm/hash.hpp>
+#include <nil/crypto3/hash/keccak.hpp>
+
+#include <nil/crypto3/zk/snark/systems/plonk/placeholder/gates_argument.hpp>
+#include <nil/crypto3/zk/test_tools/random_test_initializer.hpp>
+
+#include "synthetic_circuit.hpp"
+#include "placeholder_test_runner.hpp"
+
+using namespace nil::crypto3;
+using namespace nil::crypto3::zk;
+using namespace nil::crypto3::zk::snark;
+
+BOOST_AUTO_TEST_SUITE(placeholder_gate_argument_benchmark)
+
+using curve_type = algebra::curves::pallas;
+using field_type = typename curve_type::base_field_type;
+using hash_type = hashes::keccak_1600<256>;
+using test_runner_type = placeholder_test_runner<field_type, hash_type, hash_type>;
+using placeholder_params_type = typename test_runner_type::lpc_placeholder_params_type;
+using gates_argument_type = placeholder_gates_argument<field_type, placeholder_params_type>;
+
+// Zeroes the selectors of every zeroed_step-th gate, 0 keeps all of them.
+void run_sparse_selectors_benchmark(const std::string &name, std::size_t zeroed_step) {
+    synthetic_circuit_params params;
+    params.rows_log = 16;
+    params.gates_amount = 50;
+    params.constraints_per_gate = 4;
+    params.lookup_tables = 0;
+
+    test_tools::random_test_initializer<field_type> random_test_initializer;
+    auto circuit = circuit_synthetic<field_type>(
+        params,
+        random_test_initializer.alg_random_engines.template get_alg_engine<field_type>(),
+        random_test_initializer.generic_random_engine
+    );
+    if (zeroed_step != 0) {
+        std::vector<plonk_column<field_type>> selectors = circuit.table.selectors();
+        for (std::size_t i = 0; i < params.gates_amount; i += zeroed_step) {
+            selectors[i] = plonk_column<field_type>(selectors[i].size(), field_type::value_type::zero());
+        }
+        circuit.table = plonk_assignment_table<field_type>(
+            circuit.table.private_table(),
+            plonk_public_assignment_table<field_type>(
+                circuit.table.public_inputs(), circuit.table.constants(), selectors));
+    }
+
+    test_runner_type runner(circuit);
+    typename test_runner_type::lpc_scheme_type lpc_scheme(runner.fri_params);
+
+    auto public_data = placeholder_public_preprocessor<field_type, placeholder_params_type>::process(
+        runner.constraint_system, runner.assignments.public_table(), runner.desc, lpc_scheme
+    );
+    auto private_data = placeholder_private_preprocessor<field_type, placeholder_params_type>::process(
+        runner.constraint_system, runner.assignments.private_table(), runner.desc
+    );
+    plonk_polynomial_dfs_table<field_type> polynomial_table(
+        private_data.private_polynomial_table, public_data.public_polynomial_table);
+
+    math::polynomial_dfs<typename field_type::value_type> mask_polynomial(
+        0, public_data.common_data.basic_domain->m, field_type::value_type::one());
+    mask_polynomial -= public_data.q_last;
+    mask_polynomial -= public_data.q_blind;
+
+    std::vector<std::uint8_t> init_blob {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    typename test_runner_type::transcript_type dense_transcript(init_blob);
+    typename test_runner_type::transcript_type sparse_transcript(init_blob);
+
+    auto begin = std::chrono::high_resolution_clock::now();
+    auto dense_res = gates_argument_type::prove_eval(
+        runner.constraint_system, polynomial_table, public_data.common_data.basic_domain,
+        public_data.common_data.max_gates_degree, mask_polynomial, dense_transcript);
+    auto end = std::chrono::high_resolution_clock::now();
+    std::cout << name << ", all gates, time: "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count() << " ms" << std::endl;
+
+    begin = std::chrono::high_resolution_clock::now();
+    auto sparse_res = gates_argument_type::prove_eval(
+        runner.constraint_system, polynomial_table, public_data.common_data.basic_domain,
+        public_data.common_data.max_gates_degree, mask_polynomial, sparse_transcript,
+        {}, &public_data.active_selectors);
+    end = std::chrono::high_resolution_clock::now();
+    std::cout << name << ", active gates only, time: "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count() << " ms" << std::endl;
+
+    BOOST_CHECK(dense_res[0] == sparse_res[0]);
+}
+
+BOOST_AUTO_TEST_CASE(sparse_selectors) {
+    // Every selector is non-zero on 2% of the rows, no gate can be skipped.
+    run_sparse_selectors_benchmark("2% selector density", 0);
+}
+
+BOOST_AUTO_TEST_CASE(sparse_selectors_half_zeroed) {
+    run_sparse_selectors_benchmark("2% selector density, half of the selectors zero", 2);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -140,8 +140,43 @@ BOOST_FIXTURE_TEST_CASE(lookup_test, test_tools::random_test_initializer<field_t
     transcript_type prover_transcript(init_blob);
     transcript_type verifier_transcript(init_blob);
 
-    placeholder_lookup_argument_prover<field_type, lpc_scheme_type, lpc_placeholder_params_type> lookup_prover(
+    using lookup_prover_type = placeholder_lookup_argument_prover<field_type, lpc_scheme_type, lpc_placeholder_params_type>;
+    lookup_prover_type lookup_prover(
         constraint_system, preprocessed_public_data, polynomial_table, lpc_scheme, prover_transcript);
+
+    // Lookup columns built in one row-wise pass are the ones built polynomial by polynomial,
+    // whether the kernel extends the columns itself or gets them prepared in advance.
+    {
+        math::polynomial_dfs<typename field_type::value_type> mask_assignment =
+            math::polynomial_dfs<typename field_type::value_type>(
+                0, preprocessed_public_data.common_data.basic_domain->m, field_type::value_type::one()) -
+            preprocessed_public_data.q_last - preprocessed_public_data.q_blind;
+        auto lookup_input = lookup_prover.prepare_lookup_input();
+        auto lookup_value = lookup_prover.prepare_lookup_value(mask_assignment);
+
+        auto check_columns = [](const std::vector<math::polynomial_dfs<typename field_type::value_type>> &fused,
+                                const std::vector<math::polynomial_dfs<typename field_type::value_type>> &expected) {
+            BOOST_CHECK_EQUAL(fused.size(), expected.size());
+            for (std::size_t i = 0; i < fused.size(); i++) {
+                BOOST_CHECK_EQUAL(fused[i].size(), expected[i].size());
+                BOOST_CHECK_EQUAL(fused[i].degree(), expected[i].degree());
+                BOOST_CHECK(fused[i] == expected[i]);
+            }
+        };
+
+        auto fused = lookup_prover.prepare_lookup_columns(mask_assignment);
+        check_columns(*fused.first, *lookup_input);
+        check_columns(*fused.second, *lookup_value);
+
+        transcript_type prepared_transcript(init_blob);
+        lookup_prover_type prepared_lookup_prover(
+            constraint_system, preprocessed_public_data, polynomial_table, lpc_scheme, prepared_transcript,
+            lookup_prover_type::prepare_extended_columns(constraint_system, preprocessed_public_data, polynomial_table));
+        auto prepared = prepared_lookup_prover.prepare_lookup_columns(mask_assignment);
+        check_columns(*prepared.first, *lookup_input);
+        check_columns(*prepared.second, *lookup_value);
+    }
+
     auto prover_res = lookup_prover.prove_eval();
     auto omega = preprocessed_public_data.common_data.basic_domain->get_domain_element(1);
 
@@ -0,0 +1,141 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+// @file Test of the placeholder prover with transcript-independent work overlapped with the rounds of the
+// protocol: the proof must be byte-identical to the one of the sequential prover.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE placeholder_prover_overlap_test
+
+#include <string>
+#include <vector>
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/pallas.hpp>
+
+#include <nil/crypto3/hash/algorithm/hash.hpp>
+#include <nil/crypto3/hash/keccak.hpp>
+
+#include <nil/marshalling/status_type.hpp>
+#include <nil/marshalling/field_type.hpp>
+#include <nil/marshalling/endianness.hpp>
+#include <nil/crypto3/marshalling/zk/types/placeholder/proof.hpp>
+
+#include <nil/crypto3/zk/test_tools/random_test_initializer.hpp>
+
+#include "synthetic_circuit.hpp"
+#include "placeholder_test_runner.hpp"
+
+BOOST_AUTO_TEST_SUITE(placeholder_prover_overlap)
+
+using curve_type = algebra::curves::pallas;
+using field_type = typename curve_type::base_field_type;
+using hash_type = hashes::keccak_1600<256>;
+using test_runner_type = placeholder_test_runner<field_type, hash_type, hash_type>;
+using placeholder_params_type = typename test_runner_type::lpc_placeholder_params_type;
+using prover_type = placeholder_prover<field_type, placeholder_params_type>;
+using verifier_type = placeholder_verifier<field_type, placeholder_params_type>;
+using proof_type = placeholder_proof<field_type, placeholder_params_type>;
+using stage_latency = detail::placeholder_prover_scheduler::stage_latency;
+
+std::vector<std::uint8_t> serialize_proof(const proof_type &proof, const test_runner_type &runner) {
+    using endianness = nil::marshalling::option::big_endian;
+    auto filled_proof =
+        nil::crypto3::marshalling::types::fill_placeholder_proof<endianness, proof_type>(proof, runner.fri_params);
+    std::vector<std::uint8_t> bytes(filled_proof.length(), 0x00);
+    auto write_iter = bytes.begin();
+    BOOST_CHECK(filled_proof.write(write_iter, bytes.size()) == nil::marshalling::status_type::success);
+    return bytes;
+}
+
+bool has_stage(const std::vector<stage_latency> &stages, const std::string &name, bool is_async) {
+    for (const stage_latency &stage : stages) {
+        if (stage.name == name) {
+            return stage.is_async == is_async;
+        }
+    }
+    return false;
+}
+
+BOOST_AUTO_TEST_CASE(overlap_matches_sequential) {
+    test_tools::random_test_initializer<field_type> random_test_initializer;
+    synthetic_circuit_params params;
+    auto circuit = circuit_synthetic<field_type>(
+        params,
+        random_test_initializer.alg_random_engines.template get_alg_engine<field_type>(),
+        random_test_initializer.generic_random_engine
+    );
+    BOOST_REQUIRE(!circuit.lookup_gates.empty());
+    BOOST_REQUIRE(!circuit.copy_constraints.empty());
+
+    test_runner_type runner(circuit);
+    typename test_runner_type::lpc_scheme_type lpc_scheme(runner.fri_params);
+    auto public_data = placeholder_public_preprocessor<field_type, placeholder_params_type>::process(
+        runner.constraint_system, runner.assignments.public_table(), runner.desc, lpc_scheme);
+    auto private_data = placeholder_private_preprocessor<field_type, placeholder_params_type>::process(
+        runner.constraint_system, runner.assignments.private_table(), runner.desc);
+
+    // Both provers start from the same transcript, seeded by the verification key only.
+    prover_type overlapped_prover(public_data, private_data, runner.desc, runner.constraint_system, lpc_scheme, true);
+    proof_type overlapped_proof = overlapped_prover.process();
+    prover_type sequential_prover(public_data, private_data, runner.desc, runner.constraint_system, lpc_scheme, false);
+    proof_type sequential_proof = sequential_prover.process();
+
+    BOOST_CHECK(verifier_type::process(public_data.common_data, overlapped_proof, runner.desc,
+                                       runner.constraint_system, lpc_scheme));
+    BOOST_CHECK(overlapped_proof == sequential_proof);
+    BOOST_CHECK(serialize_proof(overlapped_proof, runner) == serialize_proof(sequential_proof, runner));
+
+    const std::vector<stage_latency> overlapped_stages = overlapped_prover.stage_latencies();
+    const std::vector<stage_latency> sequential_stages = sequential_prover.stage_latencies();
+    for (const std::string &name :
+         {"Mask polynomial", "Gates argument column extensions", "Lookup argument shifted columns"}) {
+        BOOST_CHECK(has_stage(overlapped_stages, name, true));
+        BOOST_CHECK(has_stage(sequential_stages, name, false));
+    }
+    for (const std::string &name : {"Witness commitment", "Permutation argument", "Lookup argument",
+                                    "Permutation commitment", "Gates argument", "Quotient commitment",
+                                    "Evaluation proof"}) {
+        BOOST_CHECK(has_stage(overlapped_stages, name, false));
+        BOOST_CHECK(has_stage(sequential_stages, name, false));
+    }
+
+    // Stages of the rounds are recorded in order, the evaluation proof ends the proof.
+    std::vector<stage_latency> overlapped_rounds;
+    for (const stage_latency &stage : overlapped_stages) {
+        if (!stage.is_async) {
+            overlapped_rounds.push_back(stage);
+        }
+    }
+    for (std::size_t i = 1; i < overlapped_rounds.size(); ++i) {
+        BOOST_CHECK(overlapped_rounds[i - 1].latency <= overlapped_rounds[i].latency);
+    }
+    BOOST_CHECK_EQUAL(overlapped_rounds.back().name, "Evaluation proof");
+    for (const stage_latency &stage : overlapped_stages) {
+        BOOST_CHECK(stage.latency <= overlapped_rounds.back().latency);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,245 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+// Benchmark of the placeholder preprocessor, prover and verifier on synthetic circuits.
+//
+// Every shape is timed per stage, together with the profiler scopes hit in that stage,
+// and the results are printed as JSON. Options, after "--" on the command line:
+//     --json <path>            also write the results to path
+//     --seed <n>               as in the other tests
+//     --<parameter> <value>    override a field of synthetic_circuit_params in all shapes,
+//                              e.g. --rows_log 16 --witness_columns 64
+//
+
+#define BOOST_TEST_MODULE placeholder_synthetic_benchmark
+
+// Do it manually for all performance tests
+#define ZK_PLACEHOLDER_PROFILING_ENABLED
+
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/pallas.hpp>
+
+#include <nil/crypto3/hash/algorithm/hash.hpp>
+#include <nil/crypto3/hash/keccak.hpp>
+
+#include <nil/crypto3/zk/snark/systems/plonk/placeholder/detail/placeholder_scoped_profiler.hpp>
+#include <nil/crypto3/zk/test_tools/random_test_initializer.hpp>
+
+#include "synthetic_circuit.hpp"
+#include "placeholder_test_runner.hpp"
+
+using namespace nil::crypto3;
+using namespace nil::crypto3::zk;
+using namespace nil::crypto3::zk::snark;
+
+namespace {
+
+    std::string json_escape(const std::string &value) {
+        std::string result;
+        for (char c : value) {
+            if (c == '"' || c == '\\') {
+                result.push_back('\\');
+            }
+            result.push_back(c);
+        }
+        return result;
+    }
+
+    std::string command_line_option(const std::string &name) {
+        const auto &suite = boost::unit_test::framework::master_test_suite();
+        for (int i = 0; i + 1 < suite.argc; i++) {
+            if (std::string(suite.argv[i]) == name) {
+                return suite.argv[i + 1];
+            }
+        }
+        return "";
+    }
+
+    void apply_command_line(synthetic_circuit_params &params) {
+        std::map<std::string, std::size_t *> sizes = {
+            {"--rows_log", &params.rows_log},
+            {"--witness_columns", &params.witness_columns},
+            {"--public_input_columns", &params.public_input_columns},
+            {"--public_input_rows", &params.public_input_rows},
+            {"--constant_columns", &params.constant_columns},
+            {"--gates_amount", &params.gates_amount},
+            {"--constraints_per_gate", &params.constraints_per_gate},
+            {"--gate_degree", &params.gate_degree},
+            {"--max_rotation", &params.max_rotation},
+            {"--lookup_tables", &params.lookup_tables},
+            {"--lookup_table_columns", &params.lookup_table_columns},
+            {"--lookup_table_rows", &params.lookup_table_rows},
+            {"--lookup_inputs", &params.lookup_inputs},
+        };
+        for (auto &[name, field] : sizes) {
+            std::string value = command_line_option(name);
+            if (!value.empty()) {
+                *field = std::stoul(value);
+            }
+        }
+        std::string density = command_line_option("--copy_constraint_density");
+        if (!density.empty()) {
+            params.copy_constraint_density = std::stod(density);
+        }
+    }
+
+    // Takes the profiler scopes collected since the last call and the time of the stage.
+    std::string stage_json(std::chrono::high_resolution_clock::duration elapsed) {
+        auto &stats = detail::call_stats::get_stats();
+        std::stringstream ss;
+        ss << "{\"ms\": " << std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count() / 1000.0
+           << ", \"scopes\": {";
+        bool first = true;
+        for (const auto &[name, stat] : stats.get_call_stats()) {
+            ss << (first ? "" : ", ") << "\"" << json_escape(name) << "\": {\"calls\": " << stat.calls
+               << ", \"ms\": " << stat.nanoseconds / 1000000.0 << "}";
+            first = false;
+        }
+        ss << "}, \"counters\": {";
+        first = true;
+        for (const auto &[name, value] : stats.get_counters()) {
+            ss << (first ? "" : ", ") << "\"" << json_escape(name) << "\": " << value;
+            first = false;
+        }
+        ss << "}}";
+        stats.reset();
+        return ss.str();
+    }
+
+    template<typename TestRunner>
+    std::string run_benchmark(const std::string &name, synthetic_circuit_params params, bool &verified) {
+        using field_type = typename TestRunner::field_type;
+        using placeholder_params_type = typename TestRunner::lpc_placeholder_params_type;
+
+        apply_command_line(params);
+        test_tools::random_test_initializer<field_type> random_test_initializer;
+        auto circuit = circuit_synthetic<field_type>(
+            params,
+            random_test_initializer.alg_random_engines.template get_alg_engine<field_type>(),
+            random_test_initializer.generic_random_engine
+        );
+        TestRunner runner(circuit);
+        typename TestRunner::lpc_scheme_type lpc_scheme(runner.fri_params);
+        detail::call_stats::get_stats().reset();
+
+        std::stringstream ss;
+        ss << "{\"name\": \"" << name << "\", \"params\": " << params.to_json()
+           << ", \"table_rows\": " << circuit.table_rows
+           << ", \"gates\": " << circuit.gates.size()
+           << ", \"copy_constraints\": " << circuit.copy_constraints.size()
+           << ", \"lookup_gates\": " << circuit.lookup_gates.size() << ", \"stages\": {";
+
+        auto begin = std::chrono::high_resolution_clock::now();
+        auto public_data = placeholder_public_preprocessor<field_type, placeholder_params_type>::process(
+            runner.constraint_system, runner.assignments.move_public_table(), runner.desc, lpc_scheme
+        );
+        auto private_data = placeholder_private_preprocessor<field_type, placeholder_params_type>::process(
+            runner.constraint_system, runner.assignments.move_private_table(), runner.desc
+        );
+        ss << "\"preprocess\": " << stage_json(std::chrono::high_resolution_clock::now() - begin);
+
+        begin = std::chrono::high_resolution_clock::now();
+        auto proof = placeholder_prover<field_type, placeholder_params_type>::process(
+            public_data, std::move(private_data), runner.desc, runner.constraint_system, lpc_scheme
+        );
+        ss << ", \"prove\": " << stage_json(std::chrono::high_resolution_clock::now() - begin);
+
+        begin = std::chrono::high_resolution_clock::now();
+        verified = placeholder_verifier<field_type, placeholder_params_type>::process(
+            public_data.common_data, proof, runner.desc, runner.constraint_system, lpc_scheme
+        );
+        ss << ", \"verify\": " << stage_json(std::chrono::high_resolution_clock::now() - begin);
+
+        ss << "}, \"verified\": " << (verified ? "true" : "false") << "}";
+        return ss.str();
+    }
+}    // namespace
+
+BOOST_AUTO_TEST_SUITE(placeholder_synthetic_benchmark)
+
+using curve_type = algebra::curves::pallas;
+using field_type = typename curve_type::base_field_type;
+using hash_type = hashes::keccak_1600<256>;
+using test_runner_type = placeholder_test_runner<field_type, hash_type, hash_type>;
+
+BOOST_AUTO_TEST_CASE(synthetic_shapes) {
+    std::vector<std::pair<std::string, synthetic_circuit_params>> shapes;
+
+    synthetic_circuit_params defaults;
+    shapes.push_back({"default", defaults});
+
+    synthetic_circuit_params gates_only = defaults;
+    gates_only.lookup_tables = 0;
+    gates_only.copy_constraint_density = 0;
+    shapes.push_back({"gates_only", gates_only});
+
+    synthetic_circuit_params high_degree = defaults;
+    high_degree.gate_degree = 4;
+    high_degree.max_rotation = 2;
+    high_degree.gates_amount = 4;
+    shapes.push_back({"high_degree", high_degree});
+
+    synthetic_circuit_params wide = defaults;
+    wide.witness_columns = 32;
+    wide.constant_columns = 4;
+    wide.constraints_per_gate = 8;
+    wide.copy_constraint_density = 1;
+    shapes.push_back({"wide", wide});
+
+    synthetic_circuit_params lookups = defaults;
+    lookups.lookup_tables = 4;
+    lookups.lookup_table_columns = 3;
+    lookups.lookup_inputs = 2;
+    shapes.push_back({"lookups", lookups});
+
+    std::stringstream json;
+    json << "{\"benchmarks\": [";
+    for (std::size_t i = 0; i < shapes.size(); i++) {
+        bool verified = false;
+        auto begin = std::chrono::high_resolution_clock::now();
+        json << (i == 0 ? "" : ", ") << run_benchmark<test_runner_type>(shapes[i].first, shapes[i].second, verified);
+        auto end = std::chrono::high_resolution_clock::now();
+        std::cout << "Synthetic circuit " << shapes[i].first << ", time: "
+                  << std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count() << " ms" << std::endl;
+        BOOST_CHECK(verified);
+    }
+    json << "]}";
+
+    std::cout << json.str() << std::endl;
+    std::string path = command_line_option("--json");
+    if (!path.empty()) {
+        std::ofstream(path) << json.str() << std::endl;
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
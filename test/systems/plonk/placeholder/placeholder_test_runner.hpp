@@ -31,6 +31,7 @@
 #define CRYPTO3_ZK_TEST_PLACEHOLDER_TEST_RUNNER_HPP
 
 #include <cmath>
+#include <optional>
 #include <utility>
 
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/prover.hpp>
@@ -95,6 +96,9 @@ struct placeholder_test_runner {
 
     bool run_test() {
         lpc_scheme_type lpc_scheme(fri_params);
+        if (out_of_core_commit) {
+            lpc_scheme.enable_out_of_core_commit(*out_of_core_commit);
+        }
 
         typename placeholder_public_preprocessor<field_type, lpc_placeholder_params_type>::preprocessed_data_type
             lpc_preprocessed_public_data = placeholder_public_preprocessor<field_type, lpc_placeholder_params_type>::process(
@@ -122,6 +126,8 @@ struct placeholder_test_runner {
     typename policy_type::variable_assignment_type assignments;
     std::size_t table_rows_log;
     typename lpc_type::fri_type::params_type fri_params;
+    // Commits in file-backed storage when set, the rest of the prover runs in memory.
+    std::optional<zk::detail::out_of_core_commit_params> out_of_core_commit;
 };
 
 template<
@@ -0,0 +1,304 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+// @file Generator of random satisfied circuits of a given shape, for benchmarks.
+//
+// Witness columns are split into free columns, filled with random values, and output
+// columns. Every gate constraint is
+//     out_k - prod_{j < degree} free_{a_j}[rotation_j] - const_k = 0
+// so outputs are computed once all free cells are known, whatever the rotations are.
+// Lookup inputs and copy constraints only overwrite free cells, before the outputs
+// are computed. Row 0 is never selected, it is the zero row of the lookup tables.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ZK_TEST_PLONK_SYNTHETIC_CIRCUIT_HPP
+#define CRYPTO3_ZK_TEST_PLONK_SYNTHETIC_CIRCUIT_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "circuits.hpp"
+
+namespace nil {
+    namespace crypto3 {
+        namespace zk {
+            namespace snark {
+
+                struct synthetic_circuit_params {
+                    // The table has 2^rows_log rows, the last 3 are zk padding.
+                    std::size_t rows_log = 8;
+                    std::size_t witness_columns = 8;
+                    std::size_t public_input_columns = 1;
+                    std::size_t public_input_rows = 4;
+                    // Constant columns used by the gates, lookup tables get their own.
+                    std::size_t constant_columns = 1;
+                    // Every gate has its own selector and is enabled on every gates_amount-th row.
+                    std::size_t gates_amount = 2;
+                    std::size_t constraints_per_gate = 2;
+                    // Number of free cells multiplied in every constraint.
+                    std::size_t gate_degree = 2;
+                    // Rotations of the free cells are taken from [-max_rotation, max_rotation].
+                    std::size_t max_rotation = 1;
+                    // Copy constraints per usable row.
+                    double copy_constraint_density = 0.1;
+                    // Every lookup table has an input selector and a table selector.
+                    std::size_t lookup_tables = 1;
+                    std::size_t lookup_table_columns = 2;
+                    std::size_t lookup_table_rows = 16;
+                    // Lookup constraints of the lookup gate of every table.
+                    std::size_t lookup_inputs = 1;
+
+                    std::size_t usable_rows() const {
+                        return (std::size_t(1) << rows_log) - 3;
+                    }
+
+                    std::size_t output_columns() const {
+                        return std::max<std::size_t>(1, std::min(constraints_per_gate, witness_columns / 2));
+                    }
+
+                    std::size_t free_columns() const {
+                        return witness_columns - output_columns();
+                    }
+
+                    std::size_t lookup_constant_columns() const {
+                        return lookup_tables == 0 ? 0 : lookup_table_columns;
+                    }
+
+                    std::size_t selector_columns() const {
+                        return gates_amount + 2 * lookup_tables;
+                    }
+
+                    std::string to_json() const {
+                        std::stringstream ss;
+                        ss << "{\"rows_log\": " << rows_log << ", \"witness_columns\": " << witness_columns
+                           << ", \"public_input_columns\": " << public_input_columns
+                           << ", \"public_input_rows\": " << public_input_rows
+                           << ", \"constant_columns\": " << constant_columns
+                           << ", \"selector_columns\": " << selector_columns()
+                           << ", \"gates_amount\": " << gates_amount
+                           << ", \"constraints_per_gate\": " << constraints_per_gate
+                           << ", \"gate_degree\": " << gate_degree << ", \"max_rotation\": " << max_rotation
+                           << ", \"copy_constraint_density\": " << copy_constraint_density
+                           << ", \"lookup_tables\": " << lookup_tables
+                           << ", \"lookup_table_columns\": " << lookup_table_columns
+                           << ", \"lookup_table_rows\": " << lookup_table_rows
+                           << ", \"lookup_inputs\": " << lookup_inputs << "}";
+                        return ss.str();
+                    }
+                };
+
+                template<typename FieldType>
+                circuit_description<FieldType, placeholder_circuit_params<FieldType>> circuit_synthetic(
+                    const synthetic_circuit_params &params,
+                    typename nil::crypto3::random::algebraic_engine<FieldType> alg_rnd = nil::crypto3::random::algebraic_engine<FieldType>(),
+                    boost::random::mt11213b rnd = boost::random::mt11213b()
+                ) {
+                    using assignment_type = typename FieldType::value_type;
+                    using variable_type = plonk_variable<assignment_type>;
+
+                    BOOST_ASSERT(params.rows_log >= 4);
+                    BOOST_ASSERT(params.witness_columns >= 2);
+                    BOOST_ASSERT(params.gates_amount == 0 || params.gate_degree >= 1);
+
+                    const std::size_t usable_rows = params.usable_rows();
+                    const std::size_t free_columns = params.free_columns();
+                    const std::size_t output_columns = params.output_columns();
+                    const std::size_t constraints_per_gate = std::min(params.constraints_per_gate, output_columns);
+                    const std::size_t rotation = std::min(params.max_rotation, usable_rows / 4);
+                    const std::size_t table_columns = params.lookup_constant_columns();
+                    const std::size_t lookup_inputs = table_columns == 0 ? 0 :
+                        std::max<std::size_t>(1, std::min(params.lookup_inputs, free_columns / table_columns));
+                    const std::size_t table_rows = params.lookup_tables == 0 ? 0 :
+                        std::min(params.lookup_table_rows, (usable_rows - 1) / params.lookup_tables);
+                    BOOST_ASSERT(table_columns == 0 || free_columns >= table_columns);
+                    BOOST_ASSERT(params.lookup_tables == 0 || table_rows > 0);
+
+                    typedef placeholder_circuit_params<FieldType> circuit_params;
+                    circuit_description<FieldType, circuit_params> test_circuit;
+                    test_circuit.usable_rows = usable_rows;
+
+                    std::vector<plonk_column<FieldType>> witnesses(params.witness_columns, plonk_column<FieldType>(usable_rows));
+                    std::vector<plonk_column<FieldType>> public_inputs(params.public_input_columns, plonk_column<FieldType>(usable_rows));
+                    std::vector<plonk_column<FieldType>> constants(params.constant_columns + table_columns, plonk_column<FieldType>(usable_rows));
+                    std::vector<plonk_column<FieldType>> selectors(params.selector_columns(), plonk_column<FieldType>(usable_rows));
+
+                    for (std::size_t i = 0; i < free_columns; i++) {
+                        for (std::size_t j = 1; j < usable_rows; j++) {
+                            witnesses[i][j] = alg_rnd();
+                        }
+                    }
+                    for (std::size_t i = 0; i < params.constant_columns; i++) {
+                        for (std::size_t j = 1; j < usable_rows; j++) {
+                            constants[i][j] = alg_rnd();
+                        }
+                    }
+
+                    // Free cells which already take part in a lookup or a copy constraint.
+                    std::vector<bool> used(free_columns * usable_rows, false);
+                    for (std::size_t i = 0; i < free_columns; i++) {
+                        used[i * usable_rows] = true;
+                    }
+
+                    // Lookup tables share the same constant columns, table t takes rows
+                    // [1 + t * table_rows, 1 + (t + 1) * table_rows).
+                    for (std::size_t t = 0; t < params.lookup_tables; t++) {
+                        const std::size_t input_selector = params.gates_amount + 2 * t;
+                        const std::size_t table_selector = input_selector + 1;
+                        const std::size_t first_row = 1 + t * table_rows;
+
+                        plonk_lookup_table<FieldType> lookup_table(table_columns, table_selector);
+                        std::vector<variable_type> option;
+                        for (std::size_t k = 0; k < table_columns; k++) {
+                            option.push_back(variable_type(params.constant_columns + k, 0, true, variable_type::column_type::constant));
+                            for (std::size_t j = first_row; j < first_row + table_rows; j++) {
+                                constants[params.constant_columns + k][j] = alg_rnd();
+                            }
+                        }
+                        for (std::size_t j = first_row; j < first_row + table_rows; j++) {
+                            selectors[table_selector][j] = FieldType::value_type::one();
+                        }
+                        lookup_table.append_option(option);
+                        test_circuit.lookup_tables.push_back(lookup_table);
+
+                        std::vector<plonk_lookup_constraint<FieldType>> lookup_constraints(lookup_inputs);
+                        for (std::size_t c = 0; c < lookup_inputs; c++) {
+                            lookup_constraints[c].table_id = t + 1;
+                            for (std::size_t k = 0; k < table_columns; k++) {
+                                lookup_constraints[c].lookup_input.push_back(
+                                    variable_type(c * table_columns + k, 0, true, variable_type::column_type::witness));
+                            }
+                        }
+                        test_circuit.lookup_gates.push_back(
+                            plonk_lookup_gate<FieldType, plonk_lookup_constraint<FieldType>>(input_selector, lookup_constraints));
+
+                        for (std::size_t j = 1 + t; j < usable_rows; j += params.lookup_tables) {
+                            selectors[input_selector][j] = FieldType::value_type::one();
+                            for (std::size_t c = 0; c < lookup_inputs; c++) {
+                                std::size_t table_row = first_row + rnd() % table_rows;
+                                for (std::size_t k = 0; k < table_columns; k++) {
+                                    witnesses[c * table_columns + k][j] = constants[params.constant_columns + k][table_row];
+                                    used[(c * table_columns + k) * usable_rows + j] = true;
+                                }
+                            }
+                        }
+                    }
+
+                    // Returns a random free cell which is not used yet, or false if none was found.
+                    auto take_free_cell = [&](std::size_t &column, std::size_t &row) {
+                        for (std::size_t attempt = 0; attempt < 64; attempt++) {
+                            column = rnd() % free_columns;
+                            row = 1 + rnd() % (usable_rows - 1);
+                            if (!used[column * usable_rows + row]) {
+                                used[column * usable_rows + row] = true;
+                                return true;
+                            }
+                        }
+                        return false;
+                    };
+
+                    for (std::size_t i = 0; i < params.public_input_columns; i++) {
+                        test_circuit.public_input_sizes.push_back(params.public_input_rows);
+                        for (std::size_t j = 0; j < params.public_input_rows; j++) {
+                            std::size_t column, row;
+                            if (!take_free_cell(column, row)) {
+                                break;
+                            }
+                            public_inputs[i][j] = witnesses[column][row];
+                            test_circuit.copy_constraints.push_back(plonk_copy_constraint<FieldType>(
+                                variable_type(column, row, false, variable_type::column_type::witness),
+                                variable_type(i, j, false, variable_type::column_type::public_input)));
+                        }
+                    }
+
+                    const std::size_t copy_constraints = params.copy_constraint_density * usable_rows;
+                    for (std::size_t i = 0; i < copy_constraints; i++) {
+                        std::size_t column_from, row_from, column_to, row_to;
+                        if (!take_free_cell(column_from, row_from) || !take_free_cell(column_to, row_to)) {
+                            break;
+                        }
+                        witnesses[column_to][row_to] = witnesses[column_from][row_from];
+                        test_circuit.copy_constraints.push_back(plonk_copy_constraint<FieldType>(
+                            variable_type(column_from, row_from, false, variable_type::column_type::witness),
+                            variable_type(column_to, row_to, false, variable_type::column_type::witness)));
+                    }
+
+                    // Gates, the outputs are computed last, out of the final free cells.
+                    for (std::size_t g = 0; g < params.gates_amount; g++) {
+                        std::vector<plonk_constraint<FieldType>> constraints;
+                        std::vector<std::vector<std::pair<std::size_t, int>>> factors(constraints_per_gate);
+
+                        for (std::size_t k = 0; k < constraints_per_gate; k++) {
+                            const std::size_t output = free_columns + k;
+                            std::vector<variable_type> product;
+                            for (std::size_t d = 0; d < params.gate_degree; d++) {
+                                std::size_t column = rnd() % free_columns;
+                                int shift = int(rnd() % (2 * rotation + 1)) - int(rotation);
+                                factors[k].push_back({column, shift});
+                                product.push_back(variable_type(column, shift, true, variable_type::column_type::witness));
+                            }
+
+                            plonk_constraint<FieldType> constraint;
+                            constraint += variable_type(output, 0, true, variable_type::column_type::witness);
+                            constraint -= typename plonk_constraint<FieldType>::term_type(product);
+                            if (params.constant_columns > 0) {
+                                constraint -= variable_type(k % params.constant_columns, 0, true, variable_type::column_type::constant);
+                            }
+                            constraints.push_back(constraint);
+                        }
+                        test_circuit.gates.push_back(plonk_gate<FieldType, plonk_constraint<FieldType>>(g, constraints));
+
+                        for (std::size_t j = std::max<std::size_t>(1, rotation); j + rotation < usable_rows; j++) {
+                            if (j % params.gates_amount != g) {
+                                continue;
+                            }
+                            selectors[g][j] = FieldType::value_type::one();
+                            for (std::size_t k = 0; k < constraints_per_gate; k++) {
+                                assignment_type value = FieldType::value_type::one();
+                                for (const auto &[column, shift] : factors[k]) {
+                                    value *= witnesses[column][j + shift];
+                                }
+                                if (params.constant_columns > 0) {
+                                    value += constants[k % params.constant_columns][j];
+                                }
+                                witnesses[free_columns + k][j] = value;
+                            }
+                        }
+                    }
+
+                    test_circuit.table = plonk_assignment_table<FieldType>(
+                        plonk_private_assignment_table<FieldType>(witnesses),
+                        plonk_public_assignment_table<FieldType>(public_inputs, constants, selectors));
+                    test_circuit.table_rows = zk_padding<FieldType, plonk_column<FieldType>>(test_circuit.table, alg_rnd);
+
+                    return test_circuit;
+                }
+            }    // namespace snark
+        }        // namespace zk
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ZK_TEST_PLONK_SYNTHETIC_CIRCUIT_HPP
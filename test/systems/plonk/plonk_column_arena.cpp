@@ -0,0 +1,82 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+// @file Test of the columnar arena storage of PLONK assignment tables.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE plonk_column_arena_test
+
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/pallas.hpp>
+#include <nil/crypto3/algebra/random_element.hpp>
+
+#include <nil/crypto3/zk/snark/arithmetization/plonk/assignment.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/plonk/detail/column_arena.hpp>
+
+using namespace nil::crypto3;
+using namespace nil::crypto3::zk::snark;
+
+template<typename FieldType>
+void test_column_arena(std::size_t columns_amount, std::size_t rows_amount) {
+    std::vector<plonk_column<FieldType>> columns(columns_amount, plonk_column<FieldType>(rows_amount));
+    for (auto &column : columns) {
+        for (auto &value : column) {
+            value = algebra::random_element<FieldType>();
+        }
+    }
+
+    detail::column_arena_statistics &statistics = detail::column_arena_statistics::instance();
+    statistics.reset();
+
+    detail::plonk_column_arena<FieldType> arena = detail::plonk_column_arena<FieldType>::from_columns(columns);
+
+    BOOST_CHECK_EQUAL(arena.columns_amount(), columns_amount);
+    BOOST_CHECK_EQUAL(arena.rows_amount(), rows_amount);
+    BOOST_CHECK(arena.stride() >= rows_amount);
+    BOOST_CHECK(arena.stride() * sizeof(typename FieldType::value_type) <
+                rows_amount * sizeof(typename FieldType::value_type) + 64);
+    BOOST_CHECK_EQUAL(statistics.allocations.load(), 1u);
+    BOOST_CHECK_EQUAL(statistics.bytes.load(), arena.size_in_bytes());
+    for (std::size_t i = 0; i < columns_amount; ++i) {
+        BOOST_CHECK(std::equal(columns[i].begin(), columns[i].end(), arena.column(i).begin()));
+    }
+    BOOST_CHECK(arena.to_columns() == columns);
+}
+
+BOOST_AUTO_TEST_SUITE(plonk_column_arena_test_suite)
+
+BOOST_AUTO_TEST_CASE(plonk_column_arena_small_test_case) {
+    using field_type = typename algebra::curves::pallas::base_field_type;
+    test_column_arena<field_type>(5, 1 << 4);
+}
+
+BOOST_AUTO_TEST_CASE(plonk_column_arena_padded_stride_test_case) {
+    using field_type = typename algebra::curves::pallas::base_field_type;
+    test_column_arena<field_type>(5, (1 << 3) + 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,143 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+// @file Test of the batched authentication tags of the R1CS ppzkADSNARK against the
+// per-label computation of auth_sign and auth_verify.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE r1cs_ppzkadsnark_batch_auth_test
+
+#include <vector>
+
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/curves/mnt4.hpp>
+#include <nil/crypto3/algebra/fields/mnt4/base_field.hpp>
+#include <nil/crypto3/algebra/fields/mnt4/scalar_field.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/mnt4.hpp>
+#include <nil/crypto3/algebra/curves/params/multiexp/mnt4.hpp>
+#include <nil/crypto3/algebra/curves/params/wnaf/mnt4.hpp>
+#include <nil/crypto3/algebra/random_element.hpp>
+
+#include <nil/crypto3/zk/snark/systems/ppzkadsnark/r1cs_ppzkadsnark/detail/batch_auth.hpp>
+
+using namespace nil::crypto3;
+using namespace nil::crypto3::zk::snark;
+
+namespace {
+    typedef algebra::curves::mnt4<298> curve_type;
+    typedef typename curve_type::scalar_field_type scalar_field_type;
+    typedef typename scalar_field_type::value_type scalar_value_type;
+    typedef typename curve_type::template g2_type<>::value_type g2_value_type;
+
+    // Authenticated data of a batch as produced by auth_sign, one label at a time.
+    struct auth_batch {
+        scalar_value_type i;
+        g2_value_type minusI2;
+        std::vector<scalar_value_type> data;
+        std::vector<scalar_value_type> lambdas;
+        std::vector<scalar_value_type> mus;
+        std::vector<g2_value_type> tags;
+
+        explicit auth_batch(std::size_t size) {
+            i = algebra::random_element<scalar_field_type>();
+            minusI2 = g2_value_type::zero() - i * g2_value_type::one();
+            for (std::size_t j = 0; j < size; j++) {
+                data.push_back(algebra::random_element<scalar_field_type>());
+                lambdas.push_back(algebra::random_element<scalar_field_type>());
+                mus.push_back(lambdas.back() + i * data.back());
+                tags.push_back(lambdas.back() * g2_value_type::one());
+            }
+        }
+
+        // The public tag check of auth_verify.
+        bool verify_one_by_one() const {
+            bool result = true;
+            for (std::size_t j = 0; j < data.size(); j++) {
+                result = result && (mus[j] * g2_value_type::one() == tags[j] - data[j] * minusI2);
+            }
+            return result;
+        }
+    };
+}    // namespace
+
+BOOST_AUTO_TEST_SUITE(r1cs_ppzkadsnark_batch_auth_test_suite)
+
+BOOST_AUTO_TEST_CASE(r1cs_ppzkadsnark_batch_auth_tags_test) {
+    for (std::size_t size : {1, 2, 17, 64}) {
+        auth_batch batch(size);
+        BOOST_CHECK(batch_auth_tags<curve_type>(batch.lambdas) == batch.tags);
+    }
+    BOOST_CHECK(batch_auth_tags<curve_type>({}).empty());
+}
+
+BOOST_AUTO_TEST_CASE(r1cs_ppzkadsnark_batch_auth_verify_test) {
+    for (std::size_t size : {1, 2, 17, 64}) {
+        auth_batch batch(size);
+        BOOST_CHECK(batch.verify_one_by_one());
+        BOOST_CHECK(batch_auth_tags_verify<curve_type>(batch.mus, batch.data, batch.tags, batch.minusI2));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(r1cs_ppzkadsnark_batch_auth_tampered_test) {
+    const std::size_t size = 17;
+    const std::size_t tampered = 11;
+
+    auth_batch message_tampered(size);
+    message_tampered.data[tampered] += scalar_value_type::one();
+    BOOST_CHECK(!message_tampered.verify_one_by_one());
+    BOOST_CHECK(!batch_auth_tags_verify<curve_type>(message_tampered.mus, message_tampered.data,
+                                                    message_tampered.tags, message_tampered.minusI2));
+
+    auth_batch mu_tampered(size);
+    mu_tampered.mus[tampered] += scalar_value_type::one();
+    BOOST_CHECK(!mu_tampered.verify_one_by_one());
+    BOOST_CHECK(!batch_auth_tags_verify<curve_type>(mu_tampered.mus, mu_tampered.data, mu_tampered.tags,
+                                                    mu_tampered.minusI2));
+
+    auth_batch tag_tampered(size);
+    tag_tampered.tags[tampered] = tag_tampered.tags[tampered] + g2_value_type::one();
+    BOOST_CHECK(!tag_tampered.verify_one_by_one());
+    BOOST_CHECK(!batch_auth_tags_verify<curve_type>(tag_tampered.mus, tag_tampered.data, tag_tampered.tags,
+                                                    tag_tampered.minusI2));
+
+    // Two errors which cancel out in the plain sum are still caught by the random coefficients.
+    auth_batch cancelling(size);
+    cancelling.mus[0] += scalar_value_type::one();
+    cancelling.mus[1] = cancelling.mus[1] - scalar_value_type::one();
+    BOOST_CHECK(!cancelling.verify_one_by_one());
+    BOOST_CHECK(!batch_auth_tags_verify<curve_type>(cancelling.mus, cancelling.data, cancelling.tags,
+                                                    cancelling.minusI2));
+}
+
+BOOST_AUTO_TEST_CASE(r1cs_ppzkadsnark_batch_auth_rng_test) {
+    // The coefficients come from the generator passed in, the default one is boost::random_device.
+    auth_batch batch(8);
+    boost::random::mt19937 rng(0x5eed);
+    BOOST_CHECK(batch_auth_tags_verify<curve_type>(batch.mus, batch.data, batch.tags, batch.minusI2, rng));
+    batch.data[3] += scalar_value_type::one();
+    BOOST_CHECK(!batch_auth_tags_verify<curve_type>(batch.mus, batch.data, batch.tags, batch.minusI2, rng));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,101 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+// @file Throughput of the authentication tags of the R1CS ppzkADSNARK, per label and batched.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE r1cs_ppzkadsnark_batch_auth_benchmark
+
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/curves/mnt4.hpp>
+#include <nil/crypto3/algebra/fields/mnt4/base_field.hpp>
+#include <nil/crypto3/algebra/fields/mnt4/scalar_field.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/mnt4.hpp>
+#include <nil/crypto3/algebra/curves/params/multiexp/mnt4.hpp>
+#include <nil/crypto3/algebra/curves/params/wnaf/mnt4.hpp>
+#include <nil/crypto3/algebra/random_element.hpp>
+
+#include <nil/crypto3/zk/snark/systems/ppzkadsnark/r1cs_ppzkadsnark/detail/batch_auth.hpp>
+
+using namespace nil::crypto3;
+using namespace nil::crypto3::zk::snark;
+
+BOOST_AUTO_TEST_SUITE(r1cs_ppzkadsnark_batch_auth_benchmark_suite)
+
+BOOST_AUTO_TEST_CASE(r1cs_ppzkadsnark_batch_auth_benchmark) {
+    typedef algebra::curves::mnt4<298> curve_type;
+    typedef typename curve_type::scalar_field_type scalar_field_type;
+    typedef typename scalar_field_type::value_type scalar_value_type;
+    typedef typename curve_type::template g2_type<>::value_type g2_value_type;
+
+    for (std::size_t labels_amount = 1000; labels_amount <= 100000; labels_amount *= 10) {
+        scalar_value_type i = algebra::random_element<scalar_field_type>();
+        g2_value_type minusI2 = g2_value_type::zero() - i * g2_value_type::one();
+        std::vector<scalar_value_type> data(labels_amount), lambdas(labels_amount), mus(labels_amount);
+        for (std::size_t j = 0; j < labels_amount; j++) {
+            data[j] = algebra::random_element<scalar_field_type>();
+            lambdas[j] = algebra::random_element<scalar_field_type>();
+            mus[j] = lambdas[j] + i * data[j];
+        }
+
+        auto begin = std::chrono::high_resolution_clock::now();
+        std::vector<g2_value_type> tags(labels_amount);
+        for (std::size_t j = 0; j < labels_amount; j++) {
+            tags[j] = lambdas[j] * g2_value_type::one();
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+        std::cout << "Tags one by one, " << labels_amount << " labels, time: "
+                  << std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count() << " ms" << std::endl;
+
+        begin = std::chrono::high_resolution_clock::now();
+        std::vector<g2_value_type> batch_tags = batch_auth_tags<curve_type>(lambdas);
+        end = std::chrono::high_resolution_clock::now();
+        std::cout << "Batched tags, " << labels_amount << " labels, time: "
+                  << std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count() << " ms" << std::endl;
+        BOOST_CHECK(batch_tags == tags);
+
+        begin = std::chrono::high_resolution_clock::now();
+        bool result = true;
+        for (std::size_t j = 0; j < labels_amount; j++) {
+            result = result && (mus[j] * g2_value_type::one() == tags[j] - data[j] * minusI2);
+        }
+        end = std::chrono::high_resolution_clock::now();
+        std::cout << "Tag checks one by one, " << labels_amount << " labels, time: "
+                  << std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count() << " ms" << std::endl;
+        BOOST_CHECK(result);
+
+        begin = std::chrono::high_resolution_clock::now();
+        result = batch_auth_tags_verify<curve_type>(mus, data, tags, minusI2);
+        end = std::chrono::high_resolution_clock::now();
+        std::cout << "Batched tag check, " << labels_amount << " labels, time: "
+                  << std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count() << " ms" << std::endl;
+        BOOST_CHECK(result);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
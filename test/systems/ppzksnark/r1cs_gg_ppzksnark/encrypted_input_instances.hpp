@@ -0,0 +1,140 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+// @file Synthetic encrypted-input instances for the R1CS GG-ppzkSNARK verifier.
+//
+// The ciphertexts satisfy both verification equations without an encryption scheme:
+// ct_0 = r P_0 and ct_i = r P_i + m_i gamma_ABC_i with P_0 = -\sum_i P_i, so the ciphertexts
+// sum up to the gamma_ABC accumulation of the messages, and ct_{last} = \sum_i t_i ct_i for the
+// public key t_g2 = (t_0 h, ..., t_k h).
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ZK_TEST_R1CS_GG_PPZKSNARK_ENCRYPTED_INPUT_INSTANCES_HPP
+#define CRYPTO3_ZK_TEST_R1CS_GG_PPZKSNARK_ENCRYPTED_INPUT_INSTANCES_HPP
+
+#include <vector>
+
+#include <nil/crypto3/algebra/random_element.hpp>
+
+#include <nil/crypto3/zk/snark/systems/ppzksnark/r1cs_gg_ppzksnark.hpp>
+
+#include "../r1cs_examples.hpp"
+
+namespace nil {
+    namespace crypto3 {
+        namespace zk {
+            namespace snark {
+                template<typename CurveType>
+                struct encrypted_input_test_public_key {
+                    typedef typename CurveType::template g1_type<>::value_type g1_value_type;
+                    typedef typename CurveType::template g2_type<>::value_type g2_value_type;
+
+                    std::vector<g1_value_type> delta_s_g1;
+                    std::vector<g1_value_type> t_g1;
+                    std::vector<g2_value_type> t_g2;
+                    g1_value_type gamma_inverse_sum_s_g1;
+                };
+
+                template<typename CurveType>
+                struct encrypted_input_test_instances {
+                    typedef r1cs_gg_ppzksnark<CurveType,
+                                              r1cs_gg_ppzksnark_generator<CurveType, proving_mode::encrypted_input>,
+                                              r1cs_gg_ppzksnark_prover<CurveType, proving_mode::encrypted_input>,
+                                              r1cs_gg_ppzksnark_verifier_strong_input_consistency<
+                                                  CurveType, proving_mode::encrypted_input>,
+                                              proving_mode::encrypted_input>
+                        scheme_type;
+                    typedef r1cs_gg_ppzksnark_verifier_strong_input_consistency<CurveType,
+                                                                                proving_mode::encrypted_input>
+                        verifier_type;
+
+                    typedef typename CurveType::scalar_field_type scalar_field_type;
+                    typedef typename scalar_field_type::value_type scalar_field_value_type;
+                    typedef typename CurveType::template g1_type<> g1_type;
+                    typedef typename g1_type::value_type g1_value_type;
+                    typedef typename CurveType::template g2_type<>::value_type g2_value_type;
+
+                    typedef typename scheme_type::keypair_type keypair_type;
+                    typedef typename scheme_type::primary_input_type primary_input_type;
+                    typedef typename scheme_type::proof_type proof_type;
+
+                    keypair_type keypair;
+                    encrypted_input_test_public_key<CurveType> pubkey;
+                    std::vector<std::vector<g1_value_type>> ciphertexts;
+                    std::vector<primary_input_type> unencrypted_primary_inputs;
+                    std::vector<proof_type> proofs;
+
+                    /// proofs_count proofs of one circuit, the first messages_count primary inputs encrypted
+                    encrypted_input_test_instances(std::size_t num_constraints, std::size_t input_size,
+                                                   std::size_t messages_count, std::size_t proofs_count) {
+                        r1cs_example<scalar_field_type> example =
+                            generate_r1cs_example_with_field_input<scalar_field_type>(num_constraints, input_size);
+                        keypair = scheme_type::template generate<keypair_type>(example.constraint_system);
+
+                        std::vector<g1_value_type> P(messages_count + 1);
+                        P[0] = g1_value_type::zero();
+                        for (std::size_t i = 1; i <= messages_count; ++i) {
+                            P[i] = algebra::random_element<g1_type>();
+                            P[0] = P[0] - P[i];
+                        }
+
+                        std::vector<scalar_field_value_type> t(messages_count + 1);
+                        for (std::size_t i = 0; i <= messages_count; ++i) {
+                            t[i] = algebra::random_element<scalar_field_type>();
+                            pubkey.t_g2.emplace_back(t[i] * g2_value_type::one());
+                            if (i < messages_count) {
+                                pubkey.t_g1.emplace_back(t[i] * g1_value_type::one());
+                                pubkey.delta_s_g1.emplace_back(algebra::random_element<g1_type>());
+                            }
+                        }
+                        pubkey.gamma_inverse_sum_s_g1 = g1_value_type::zero();
+
+                        for (std::size_t j = 0; j < proofs_count; ++j) {
+                            const scalar_field_value_type r = algebra::random_element<scalar_field_type>();
+
+                            std::vector<g1_value_type> ct(messages_count + 2);
+                            ct[0] = r * P[0];
+                            for (std::size_t i = 1; i <= messages_count; ++i) {
+                                ct[i] = r * P[i] +
+                                        example.primary_input[i - 1] * keypair.second.gamma_ABC_g1.rest[i - 1];
+                            }
+                            ct.back() = g1_value_type::zero();
+                            for (std::size_t i = 0; i <= messages_count; ++i) {
+                                ct.back() = ct.back() + t[i] * ct[i];
+                            }
+
+                            ciphertexts.emplace_back(std::move(ct));
+                            unencrypted_primary_inputs.emplace_back(
+                                primary_input_type(example.primary_input.begin() + messages_count,
+                                                   example.primary_input.end()));
+                            proofs.emplace_back(scheme_type::prove(keypair.first, pubkey, example.primary_input,
+                                                                   example.auxiliary_input, r));
+                        }
+                    }
+                };
+            }    // namespace snark
+        }        // namespace zk
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ZK_TEST_R1CS_GG_PPZKSNARK_ENCRYPTED_INPUT_INSTANCES_HPP
@@ -0,0 +1,129 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+// @file Benchmark of the IPP2 aggregation setup: commitments with prepared G2 keys, SRS generation
+// and serialization.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE r1cs_gg_ppzksnark_aggregation_benchmark
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/curves/params/wnaf/bls12.hpp>
+#include <nil/crypto3/algebra/pairing/bls12.hpp>
+#include <nil/crypto3/algebra/algorithms/pair.hpp>
+#include <nil/crypto3/algebra/random_element.hpp>
+
+#include <nil/crypto3/zk/commitments/polynomial/kzg_ipp2.hpp>
+#include <nil/crypto3/zk/snark/systems/ppzksnark/r1cs_gg_ppzksnark/ipp2/srs.hpp>
+
+using namespace nil::crypto3;
+using namespace nil::crypto3::algebra;
+using namespace nil::crypto3::zk;
+using namespace nil::crypto3::zk::snark;
+
+using curve_type = curves::bls12_381;
+
+using g1_type = typename curve_type::template g1_type<>;
+using g2_type = typename curve_type::template g2_type<>;
+using G1_value_type = typename g1_type::value_type;
+using G2_value_type = typename g2_type::value_type;
+
+using scalar_field_type = typename curve_type::scalar_field_type;
+using scalar_field_value_type = typename scalar_field_type::value_type;
+
+template<typename Function>
+double seconds(Function f) {
+    auto begin = std::chrono::high_resolution_clock::now();
+    f();
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count() * 1e-6;
+}
+
+BOOST_AUTO_TEST_SUITE(r1cs_gg_ppzksnark_aggregation_benchmark_suite)
+
+BOOST_AUTO_TEST_CASE(bls381_prepared_commitment_key_benchmark) {
+    using commitment_type = commitments::kzg_ipp2<curve_type>;
+
+    for (std::size_t n : {256, 1024, 4096}) {
+        scalar_field_value_type u = random_element<scalar_field_type>();
+        scalar_field_value_type v = random_element<scalar_field_type>();
+
+        typename commitment_type::vkey_type vkey {structured_generators_scalar_power<g2_type>(n, u),
+                                                  structured_generators_scalar_power<g2_type>(n, v)};
+        typename commitment_type::wkey_type wkey {structured_generators_scalar_power<g1_type>(n, u),
+                                                  structured_generators_scalar_power<g1_type>(n, v)};
+
+        std::vector<G1_value_type> a, c;
+        std::vector<G2_value_type> b;
+        for (std::size_t i = 0; i < n; ++i) {
+            a.emplace_back(random_element<g1_type>());
+            b.emplace_back(random_element<g2_type>());
+            c.emplace_back(random_element<g1_type>());
+        }
+
+        typename commitment_type::prepared_vkey_type prepared_vkey;
+        std::cout << "Num proofs " << n << std::endl;
+        std::cout << "vkey preparation, time: "
+                  << seconds([&]() { prepared_vkey = commitment_type::prepare(vkey); }) << std::endl;
+        std::cout << "com_ab (vkey), time: " << seconds([&]() {
+            commitment_type::pair(vkey, wkey, a.begin(), a.end(), b.begin(), b.end());
+        }) << std::endl;
+        std::cout << "com_ab (prepared vkey), time: " << seconds([&]() {
+            commitment_type::pair(prepared_vkey, wkey, a.begin(), a.end(), b.begin(), b.end());
+        }) << std::endl;
+        std::cout << "com_c (vkey), time: "
+                  << seconds([&]() { commitment_type::single(vkey, c.begin(), c.end()); }) << std::endl;
+        std::cout << "com_c (prepared vkey), time: "
+                  << seconds([&]() { commitment_type::single(prepared_vkey, c.begin(), c.end()); }) << std::endl;
+    }
+}
+
+BOOST_AUTO_TEST_CASE(bls381_aggregate_srs_generation_benchmark) {
+    using srs_type = r1cs_gg_ppzksnark_aggregate_srs<curve_type>;
+
+    for (std::size_t num_proofs : {1 << 8, 1 << 12}) {
+        scalar_field_value_type alpha = random_element<scalar_field_type>();
+        scalar_field_value_type beta = random_element<scalar_field_type>();
+
+        std::unique_ptr<srs_type> srs;
+        std::vector<std::uint8_t> srs_bytes;
+        std::cout << "Num proofs " << num_proofs << std::endl;
+        std::cout << "SRS generation, time: "
+                  << seconds([&]() { srs = std::make_unique<srs_type>(num_proofs, alpha, beta); }) << std::endl;
+        std::cout << "SRS serialization, time: " << seconds([&]() { srs_bytes = srs->to_bytes(); }) << std::endl;
+        std::cout << "SRS deserialization, time: " << seconds([&]() {
+            BOOST_CHECK(srs_type::from_bytes(srs_bytes.begin(), srs_bytes.end()).first);
+        }) << std::endl;
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
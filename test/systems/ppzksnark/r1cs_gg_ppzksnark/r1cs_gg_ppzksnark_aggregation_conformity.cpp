@@ -44,6 +44,7 @@
 #include <nil/crypto3/algebra/pairing/mnt4.hpp>
 #include <nil/crypto3/algebra/pairing/mnt6.hpp>
 #include <nil/crypto3/algebra/algorithms/pair.hpp>
+#include <nil/crypto3/algebra/random_element.hpp>
 
 #include <nil/crypto3/zk/commitments/polynomial/kzg_ipp2.hpp>
 #include <nil/crypto3/zk/snark/systems/ppzksnark/r1cs_gg_ppzksnark/ipp2/srs.hpp>
@@ -6127,4 +6128,67 @@ BOOST_AUTO_TEST_CASE(bls381_verification_mimc) {
     BOOST_CHECK(verify_res);
 }
 
+BOOST_AUTO_TEST_CASE(bls381_prepared_commitment_key_test) {
+    using commitment_type = commitments::kzg_ipp2<curve_type>;
+
+    for (std::size_t n : {16, 64}) {
+        scalar_field_value_type u = random_element<scalar_field_type>();
+        scalar_field_value_type v = random_element<scalar_field_type>();
+
+        typename commitment_type::vkey_type vkey {structured_generators_scalar_power<g2_type>(n, u),
+                                                  structured_generators_scalar_power<g2_type>(n, v)};
+        typename commitment_type::wkey_type wkey {structured_generators_scalar_power<g1_type>(n, u),
+                                                  structured_generators_scalar_power<g1_type>(n, v)};
+
+        std::vector<G1_value_type> a, c;
+        std::vector<G2_value_type> b;
+        for (std::size_t i = 0; i < n; ++i) {
+            a.emplace_back(random_element<g1_type>());
+            b.emplace_back(random_element<g2_type>());
+            c.emplace_back(random_element<g1_type>());
+        }
+
+        typename commitment_type::prepared_vkey_type prepared_vkey = commitment_type::prepare(vkey);
+        BOOST_CHECK(prepared_vkey.has_correct_len(n));
+
+        BOOST_CHECK(commitment_type::pair(vkey, wkey, a.begin(), a.end(), b.begin(), b.end()) ==
+                    commitment_type::pair(prepared_vkey, wkey, a.begin(), a.end(), b.begin(), b.end()));
+        BOOST_CHECK(commitment_type::single(vkey, c.begin(), c.end()) ==
+                    commitment_type::single(prepared_vkey, c.begin(), c.end()));
+    }
+}
+
+
+BOOST_AUTO_TEST_CASE(bls381_aggregate_srs_generation_test) {
+    using srs_type = r1cs_gg_ppzksnark_aggregate_srs<curve_type>;
+
+    for (std::size_t num_proofs : {16, 64}) {
+        scalar_field_value_type alpha = random_element<scalar_field_type>();
+        scalar_field_value_type beta = random_element<scalar_field_type>();
+
+        srs_type srs(num_proofs, alpha, beta);
+
+        BOOST_CHECK_EQUAL(srs.g_alpha_powers.size(), 2 * num_proofs);
+        BOOST_CHECK_EQUAL(srs.h_beta_powers.size(), 2 * num_proofs);
+        for (std::size_t i : {std::size_t(0), std::size_t(1), num_proofs + 1, 2 * num_proofs - 1}) {
+            BOOST_CHECK_EQUAL(srs.g_alpha_powers[i], G1_value_type::one() * alpha.pow(i));
+            BOOST_CHECK_EQUAL(srs.h_alpha_powers[i], G2_value_type::one() * alpha.pow(i));
+            BOOST_CHECK_EQUAL(srs.g_beta_powers[i], G1_value_type::one() * beta.pow(i));
+            BOOST_CHECK_EQUAL(srs.h_beta_powers[i], G2_value_type::one() * beta.pow(i));
+        }
+
+        std::vector<std::uint8_t> srs_bytes = srs.to_bytes();
+        std::pair<bool, srs_type> read_srs = srs_type::from_bytes(srs_bytes.begin(), srs_bytes.end());
+
+        BOOST_CHECK_EQUAL(srs_bytes.size(), srs_type::serialized_size(2 * num_proofs));
+        BOOST_CHECK(read_srs.first);
+        BOOST_CHECK(read_srs.second.g_alpha_powers == srs.g_alpha_powers);
+        BOOST_CHECK(read_srs.second.h_alpha_powers == srs.h_alpha_powers);
+        BOOST_CHECK(read_srs.second.g_beta_powers == srs.g_beta_powers);
+        BOOST_CHECK(read_srs.second.h_beta_powers == srs.h_beta_powers);
+
+        BOOST_CHECK(!srs_type::from_bytes(srs_bytes.begin(), srs_bytes.end() - 1).first);
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,130 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+// @file Test program that exercises the verifier of the R1CS GG-ppzkSNARK with encrypted input:
+// single and batched verification against processed keys, and agreement with the pairing-by-pairing
+// evaluation of both verification equations.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE r1cs_gg_ppzksnark_encrypted_input_test
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/curves/mnt4.hpp>
+#include <nil/crypto3/algebra/fields/mnt4/base_field.hpp>
+#include <nil/crypto3/algebra/fields/mnt4/scalar_field.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/mnt4.hpp>
+#include <nil/crypto3/algebra/curves/params/multiexp/mnt4.hpp>
+#include <nil/crypto3/algebra/curves/params/wnaf/mnt4.hpp>
+#include <nil/crypto3/algebra/pairing/mnt4.hpp>
+#include <nil/crypto3/algebra/algorithms/pair.hpp>
+
+#include "encrypted_input_instances.hpp"
+
+using namespace nil::crypto3::zk::snark;
+using namespace nil::crypto3::algebra;
+
+/// Both verification equations evaluated with one reduced pairing per term.
+template<typename CurveType>
+bool verify_pair_reduced(const encrypted_input_test_instances<CurveType> &instances, std::size_t j) {
+    typedef typename CurveType::template g1_type<>::value_type g1_value_type;
+    typedef typename CurveType::template g2_type<>::value_type g2_value_type;
+    typedef typename CurveType::gt_type::value_type gt_value_type;
+
+    const auto &vk = instances.keypair.second;
+    const std::vector<g1_value_type> &ct = instances.ciphertexts[j];
+    const auto &unencrypted_primary_input = instances.unencrypted_primary_inputs[j];
+    const auto &proof = instances.proofs[j];
+
+    g1_value_type acc = vk.gamma_ABC_g1.first;
+    gt_value_type sum_cipher = gt_value_type::one();
+    for (std::size_t i = 0; i < ct.size() - 1; ++i) {
+        acc = acc + ct[i];
+        sum_cipher = sum_cipher * pair_reduced<CurveType>(ct[i], instances.pubkey.t_g2[i]);
+    }
+    for (std::size_t i = ct.size() - 2; i < vk.gamma_ABC_g1.rest.size(); ++i) {
+        acc = acc + unencrypted_primary_input[i - ct.size() + 2] * vk.gamma_ABC_g1.rest[i];
+    }
+    const bool ans1 = sum_cipher == pair_reduced<CurveType>(ct.back(), g2_value_type::one());
+
+    const bool ans2 = pair_reduced<CurveType>(proof.g_A, proof.g_B) ==
+                      vk.alpha_g1_beta_g2 * pair_reduced<CurveType>(acc, vk.gamma_g2) *
+                          pair_reduced<CurveType>(proof.g_C, vk.delta_g2);
+
+    return ans1 && ans2;
+}
+
+BOOST_AUTO_TEST_SUITE(r1cs_gg_ppzksnark_encrypted_input_test_suite)
+
+BOOST_AUTO_TEST_CASE(r1cs_gg_ppzksnark_encrypted_input_process_test) {
+    using curve_type = curves::mnt4<298>;
+    using instances_type = encrypted_input_test_instances<curve_type>;
+    using verifier_type = typename instances_type::verifier_type;
+
+    instances_type instances(100, 10, 3, 4);
+    const typename verifier_type::processed_keys_type keys =
+        verifier_type::process_keys(instances.keypair.second, instances.pubkey);
+
+    for (std::size_t j = 0; j < instances.proofs.size(); ++j) {
+        const auto &ct = instances.ciphertexts[j];
+        BOOST_CHECK(verify_pair_reduced(instances, j));
+        BOOST_CHECK(verifier_type::process(ct.begin(), ct.end(), keys, instances.unencrypted_primary_inputs[j],
+                                           instances.proofs[j]));
+        BOOST_CHECK(instances_type::scheme_type::verify(ct.begin(), ct.end(), instances.keypair.second,
+                                                        instances.pubkey, instances.unencrypted_primary_inputs[j],
+                                                        instances.proofs[j]));
+    }
+
+    // a ciphertext off the public key fails the first equation only
+    std::vector<typename instances_type::g1_value_type> ct = instances.ciphertexts[0];
+    ct.back() = ct.back() + instances_type::g1_value_type::one();
+    BOOST_CHECK(!verifier_type::process(ct.begin(), ct.end(), keys, instances.unencrypted_primary_inputs[0],
+                                        instances.proofs[0]));
+}
+
+BOOST_AUTO_TEST_CASE(r1cs_gg_ppzksnark_encrypted_input_batch_test) {
+    using curve_type = curves::mnt4<298>;
+    using instances_type = encrypted_input_test_instances<curve_type>;
+    using verifier_type = typename instances_type::verifier_type;
+
+    instances_type instances(100, 10, 3, 8);
+    const typename verifier_type::processed_keys_type keys =
+        verifier_type::process_keys(instances.keypair.second, instances.pubkey);
+
+    BOOST_CHECK(instances_type::scheme_type::batch_verify(keys, instances.ciphertexts,
+                                                          instances.unencrypted_primary_inputs, instances.proofs));
+
+    std::vector<typename instances_type::proof_type> corrupted_proofs = instances.proofs;
+    corrupted_proofs[5].g_C = corrupted_proofs[5].g_C + instances_type::g1_value_type::one();
+    BOOST_CHECK(!verifier_type::process(instances.ciphertexts[5].begin(), instances.ciphertexts[5].end(), keys,
+                                        instances.unencrypted_primary_inputs[5], corrupted_proofs[5]));
+    BOOST_CHECK(!instances_type::scheme_type::batch_verify(keys, instances.ciphertexts,
+                                                           instances.unencrypted_primary_inputs, corrupted_proofs));
+
+    std::vector<std::vector<typename instances_type::g1_value_type>> corrupted_ciphertexts = instances.ciphertexts;
+    corrupted_ciphertexts[2][1] = corrupted_ciphertexts[2][1] + instances_type::g1_value_type::one();
+    BOOST_CHECK(!instances_type::scheme_type::batch_verify(keys, corrupted_ciphertexts,
+                                                           instances.unencrypted_primary_inputs, instances.proofs));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,92 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+// @file Benchmark of the encrypted-input verifier of the R1CS GG-ppzkSNARK: throughput of
+// batched verification against one-by-one verification with processed keys.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE r1cs_gg_ppzksnark_encrypted_input_benchmark
+
+#include <boost/test/unit_test.hpp>
+
+#include <chrono>
+#include <iostream>
+
+#include <nil/crypto3/algebra/curves/mnt4.hpp>
+#include <nil/crypto3/algebra/fields/mnt4/base_field.hpp>
+#include <nil/crypto3/algebra/fields/mnt4/scalar_field.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/mnt4.hpp>
+#include <nil/crypto3/algebra/curves/params/multiexp/mnt4.hpp>
+#include <nil/crypto3/algebra/curves/params/wnaf/mnt4.hpp>
+#include <nil/crypto3/algebra/pairing/mnt4.hpp>
+#include <nil/crypto3/algebra/algorithms/pair.hpp>
+
+#include "encrypted_input_instances.hpp"
+
+using namespace nil::crypto3::zk::snark;
+using namespace nil::crypto3::algebra;
+
+template<typename CurveType>
+void run_encrypted_input_batch_benchmark(std::size_t messages_count, std::size_t proofs_count) {
+    using instances_type = encrypted_input_test_instances<CurveType>;
+    using verifier_type = typename instances_type::verifier_type;
+
+    instances_type instances(100, messages_count + 10, messages_count, proofs_count);
+    const typename verifier_type::processed_keys_type keys =
+        verifier_type::process_keys(instances.keypair.second, instances.pubkey);
+
+    auto begin = std::chrono::high_resolution_clock::now();
+    bool one_by_one = true;
+    for (std::size_t j = 0; j < proofs_count; ++j) {
+        if (!verifier_type::process(instances.ciphertexts[j].begin(), instances.ciphertexts[j].end(), keys,
+                                    instances.unencrypted_primary_inputs[j], instances.proofs[j])) {
+            one_by_one = false;
+        }
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    const double one_by_one_seconds =
+        std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count() * 1e-6;
+
+    begin = std::chrono::high_resolution_clock::now();
+    const bool batched = instances_type::scheme_type::batch_verify(
+        keys, instances.ciphertexts, instances.unencrypted_primary_inputs, instances.proofs);
+    end = std::chrono::high_resolution_clock::now();
+    const double batched_seconds = std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count() * 1e-6;
+
+    std::cout << proofs_count << " proofs, " << messages_count << " encrypted inputs: one by one "
+              << proofs_count / one_by_one_seconds << " proofs/s, batched " << proofs_count / batched_seconds
+              << " proofs/s" << std::endl;
+
+    BOOST_CHECK(one_by_one);
+    BOOST_CHECK(batched);
+}
+
+BOOST_AUTO_TEST_SUITE(r1cs_gg_ppzksnark_encrypted_input_benchmark_suite)
+
+BOOST_AUTO_TEST_CASE(r1cs_gg_ppzksnark_encrypted_input_batch_benchmark) {
+    for (std::size_t proofs_count : {8, 32, 128}) {
+        run_encrypted_input_batch_benchmark<curves::mnt4<298>>(8, proofs_count);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,99 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+// @file Benchmark of the R1CS GG-ppzkSNARK prover with a prepared proving key for several
+// fixed-base table memory limits, against the prover with the plain proving key.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE r1cs_gg_ppzksnark_prepared_benchmark
+
+#include <boost/test/unit_test.hpp>
+
+#include <chrono>
+#include <iostream>
+
+#include <nil/crypto3/algebra/curves/mnt4.hpp>
+#include <nil/crypto3/algebra/fields/mnt4/base_field.hpp>
+#include <nil/crypto3/algebra/fields/mnt4/scalar_field.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/mnt4.hpp>
+#include <nil/crypto3/algebra/curves/params/multiexp/mnt4.hpp>
+#include <nil/crypto3/algebra/curves/params/wnaf/mnt4.hpp>
+#include <nil/crypto3/algebra/pairing/mnt4.hpp>
+#include <nil/crypto3/algebra/algorithms/pair.hpp>
+
+#include <nil/crypto3/zk/snark/systems/ppzksnark/r1cs_gg_ppzksnark.hpp>
+
+#include <nil/crypto3/zk/algorithms/generate.hpp>
+#include <nil/crypto3/zk/algorithms/verify.hpp>
+
+#include "../r1cs_examples.hpp"
+
+using namespace nil::crypto3::zk::snark;
+using namespace nil::crypto3::algebra;
+
+template<typename ProofSystem, typename ProvingKey, typename Example>
+double proofs_per_hour(const ProvingKey &pk, const Example &example, std::size_t proofs_count) {
+    auto begin = std::chrono::high_resolution_clock::now();
+    for (std::size_t i = 0; i < proofs_count; ++i) {
+        ProofSystem::prove(pk, example.primary_input, example.auxiliary_input);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+
+    const double seconds = std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count() * 1e-6;
+    return proofs_count * 3600.0 / seconds;
+}
+
+template<typename CurveType>
+void run_r1cs_gg_ppzksnark_prepared_benchmark(std::size_t num_constraints, std::size_t input_size,
+                                              std::size_t proofs_count) {
+    using proof_system = r1cs_gg_ppzksnark<CurveType>;
+
+    r1cs_example<typename CurveType::scalar_field_type> example =
+        generate_r1cs_example_with_binary_input<typename CurveType::scalar_field_type>(num_constraints, input_size);
+
+    typename proof_system::keypair_type keypair = nil::crypto3::zk::generate<proof_system>(example.constraint_system);
+
+    std::cout << "Proving key, proofs/hour: "
+              << proofs_per_hour<proof_system>(keypair.first, example, proofs_count) << std::endl;
+
+    for (std::size_t memory_limit : {std::size_t(0), std::size_t(16) << 20, std::size_t(64) << 20,
+                                     std::size_t(256) << 20, std::size_t(1) << 30}) {
+        auto begin = std::chrono::high_resolution_clock::now();
+        typename proof_system::prepared_proving_key_type prepared_pk(keypair.first, memory_limit);
+        auto end = std::chrono::high_resolution_clock::now();
+
+        std::cout << "Memory limit " << (memory_limit >> 20) << " MB, tables "
+                  << (prepared_pk.tables_size_in_bytes() >> 20) << " MB, preparation time "
+                  << std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count() << " ms"
+                  << ", proofs/hour: " << proofs_per_hour<proof_system>(prepared_pk, example, proofs_count)
+                  << std::endl;
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(r1cs_gg_ppzksnark_prepared_benchmark_suite)
+
+BOOST_AUTO_TEST_CASE(r1cs_gg_ppzksnark_prepared_benchmark) {
+    run_r1cs_gg_ppzksnark_prepared_benchmark<curves::mnt4<298>>(1 << 12, 10, 4);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -41,6 +41,7 @@
 #include <nil/crypto3/hash/keccak.hpp>
 
 #include <nil/crypto3/zk/transcript/fiat_shamir.hpp>
+#include <nil/crypto3/zk/transcript/duplex_sponge.hpp>
 
 using namespace nil::crypto3;
 using namespace nil::crypto3::zk;
@@ -113,3 +114,93 @@ BOOST_AUTO_TEST_CASE(zk_poseidon_transcript_no_init_test) {
 }
 
 BOOST_AUTO_TEST_SUITE_END()
+
+
+BOOST_AUTO_TEST_SUITE(zk_duplex_transcript_test_suite)
+
+BOOST_AUTO_TEST_CASE(zk_duplex_keccak_transcript_test) {
+    using field_type = algebra::curves::alt_bn128_254::scalar_field_type;
+    using transcript_type = transcript::fiat_shamir_heuristic_sequential<transcript::duplex_sponge<hashes::keccak_1600<256>>>;
+
+    std::vector<std::uint8_t> init_blob {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    std::vector<std::uint8_t> first {1, 2, 3, 4};
+    std::vector<std::uint8_t> second {5, 6, 7, 8};
+    std::vector<std::uint8_t> joined {1, 2, 3, 4, 5, 6, 7, 8};
+
+    transcript_type tr1(init_blob), tr2(init_blob), tr3(init_blob);
+    tr1(first);
+    tr1(second);
+    tr2(joined);
+    tr3(second);
+    tr3(first);
+
+    // Item boundaries and order are part of the transcript.
+    transcript_type tr1_copy = tr1;
+    auto ch1 = tr1.challenge<field_type>();
+    BOOST_CHECK(ch1 != tr2.challenge<field_type>());
+    BOOST_CHECK(ch1 != tr3.challenge<field_type>());
+
+    auto ch_n = tr1_copy.challenges<field_type, 3>();
+    BOOST_CHECK(ch_n[0] == ch1);
+    BOOST_CHECK(ch_n[1] == tr1.challenge<field_type>());
+    BOOST_CHECK(ch_n[2] == tr1.challenge<field_type>());
+    BOOST_CHECK(ch_n[1] != ch_n[2]);
+    BOOST_CHECK_EQUAL(tr1_copy.int_challenge<std::uint32_t>(), tr1.int_challenge<std::uint32_t>());
+}
+
+BOOST_AUTO_TEST_CASE(zk_duplex_poseidon_transcript_test) {
+    using curve_type = algebra::curves::pallas;
+    using field_type = typename curve_type::base_field_type;
+    using poseidon_type = hashes::poseidon<nil::crypto3::hashes::detail::mina_poseidon_policy<field_type>>;
+    using transcript_type = transcript::fiat_shamir_heuristic_sequential<transcript::duplex_sponge<poseidon_type>>;
+
+    transcript_type tr1, tr2, tr3;
+    for (std::size_t i = 0; i < 5; i++) {
+        tr1(field_type::value_type(i));
+        tr2(field_type::value_type(i));
+        tr3(field_type::value_type(4 - i));
+    }
+
+    // More challenges than the rate, so the squeeze runs more than one permutation.
+    auto ch_n = tr1.challenges<field_type, 5>();
+    for (std::size_t i = 0; i < 5; i++) {
+        BOOST_CHECK(ch_n[i] == tr2.challenge<field_type>());
+    }
+    BOOST_CHECK(ch_n[0] != ch_n[1]);
+    BOOST_CHECK(ch_n[0] != tr3.challenge<field_type>());
+
+    // Absorbing after squeezing changes the following challenges.
+    transcript_type tr4 = tr1;
+    tr1(field_type::value_type(1));
+    tr4(field_type::value_type(2));
+    BOOST_CHECK(tr1.challenge<field_type>() != tr4.challenge<field_type>());
+
+    transcript_type tr5 = tr1;
+    BOOST_CHECK_EQUAL(tr1.int_challenge<int>(), tr5.int_challenge<int>());
+}
+
+BOOST_AUTO_TEST_CASE(zk_duplex_poseidon_transcript_padding_test) {
+    using curve_type = algebra::curves::pallas;
+    using field_type = typename curve_type::base_field_type;
+    using poseidon_type = hashes::poseidon<nil::crypto3::hashes::detail::mina_poseidon_policy<field_type>>;
+    using transcript_type = transcript::fiat_shamir_heuristic_sequential<transcript::duplex_sponge<poseidon_type>>;
+    constexpr std::size_t rate = poseidon_type::policy_type::rate;
+
+    // Inputs which differ only by trailing zeros, including ones filling the rate exactly.
+    for (std::size_t length = 1; length <= 2 * rate; length++) {
+        transcript_type tr1, tr2;
+        for (std::size_t i = 0; i < length; i++) {
+            tr1(field_type::value_type(i + 1));
+            tr2(field_type::value_type(i + 1));
+        }
+        tr2(field_type::value_type::zero());
+        BOOST_CHECK(tr1.challenge<field_type>() != tr2.challenge<field_type>());
+    }
+
+    // A single zero differs from nothing absorbed.
+    transcript_type empty, zero;
+    zero(field_type::value_type::zero());
+    BOOST_CHECK(empty.challenge<field_type>() != zero.challenge<field_type>());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,105 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+// Benchmark of the sequential and duplex-sponge transcripts: absorbing and grinding.
+
+#define BOOST_TEST_MODULE zk_transcript_benchmark
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/curves/alt_bn128.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/alt_bn128.hpp>
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/pallas.hpp>
+
+#include <nil/crypto3/hash/poseidon.hpp>
+#include <nil/crypto3/hash/keccak.hpp>
+
+#include <nil/crypto3/zk/transcript/fiat_shamir.hpp>
+#include <nil/crypto3/zk/transcript/duplex_sponge.hpp>
+
+using namespace nil::crypto3;
+using namespace nil::crypto3::zk;
+
+BOOST_AUTO_TEST_SUITE(zk_transcript_benchmark_suite)
+
+template<typename Transcript, typename Field, typename Item>
+std::size_t transcript_benchmark(const std::string &name, const std::vector<Item> &items) {
+    auto begin = std::chrono::high_resolution_clock::now();
+    Transcript tr;
+    for (std::size_t i = 0; i < items.size(); i++) {
+        tr(items[i]);
+        if (i % 8 == 7) {
+            tr.template challenges<Field, 2>();
+        }
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    std::cout << name << " absorbing " << items.size() << " items, time: "
+              << std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count() << " us" << std::endl;
+
+    // The grinding loop: a copy, an absorb and an integer challenge per attempt.
+    begin = std::chrono::high_resolution_clock::now();
+    std::size_t result = 0;
+    for (std::size_t i = 0; i < 10000; i++) {
+        Transcript tmp = tr;
+        tmp(items[i % items.size()]);
+        result ^= tmp.template int_challenge<std::uint32_t>();
+    }
+    end = std::chrono::high_resolution_clock::now();
+    std::cout << name << " grinding 10000 attempts, time: "
+              << std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count() << " us" << std::endl;
+    return result;
+}
+
+BOOST_AUTO_TEST_CASE(zk_duplex_transcript_benchmark) {
+    using keccak_type = hashes::keccak_1600<256>;
+    using bn_field_type = algebra::curves::alt_bn128_254::scalar_field_type;
+    std::vector<std::vector<std::uint8_t>> commitments(1000, std::vector<std::uint8_t>(32));
+    for (std::size_t i = 0; i < commitments.size(); i++) {
+        for (std::size_t j = 0; j < 32; j++) {
+            commitments[i][j] = std::uint8_t(i * 31 + j);
+        }
+    }
+    transcript_benchmark<transcript::fiat_shamir_heuristic_sequential<keccak_type>, bn_field_type>(
+        "Keccak sequential transcript", commitments);
+    transcript_benchmark<transcript::fiat_shamir_heuristic_sequential<transcript::duplex_sponge<keccak_type>>,
+                         bn_field_type>("Keccak duplex transcript", commitments);
+
+    using field_type = algebra::curves::pallas::base_field_type;
+    using poseidon_type = hashes::poseidon<nil::crypto3::hashes::detail::mina_poseidon_policy<field_type>>;
+    std::vector<typename field_type::value_type> evaluations(1000);
+    for (std::size_t i = 0; i < evaluations.size(); i++) {
+        evaluations[i] = field_type::value_type(i * i + 1);
+    }
+    transcript_benchmark<transcript::fiat_shamir_heuristic_sequential<poseidon_type>, field_type>(
+        "Poseidon sequential transcript", evaluations);
+    transcript_benchmark<transcript::fiat_shamir_heuristic_sequential<transcript::duplex_sponge<poseidon_type>>,
+                         field_type>("Poseidon duplex transcript", evaluations);
+}
+
+BOOST_AUTO_TEST_SUITE_END()